@@ -0,0 +1,139 @@
+// This file is part of Topologic software library.
+// Copyright(C) 2019, Cardiff University and University College London
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "Utilities.h"
+#include "Topology.h"
+
+#include <BRepTools_History.hxx>
+#include <TopTools_DataMapOfShapeListOfShape.hxx>
+#include <TopTools_ListOfShape.hxx>
+#include <TopTools_MapOfShape.hxx>
+
+#include <list>
+#include <memory>
+#include <vector>
+
+namespace TopologicCore
+{
+	/// <summary>
+	/// A BooleanHistory records which Vertices, Edges, Faces and Cells of the result of a Boolean operation come from
+	/// which members of its operands. Pass it to a Boolean operation of Topology to fill it. It is built from the
+	/// history of the OCCT Boolean algorithm, so each query is a lookup instead of a geometric search.
+	/// </summary>
+	class BooleanHistory
+	{
+		friend class Topology;
+
+	public:
+		typedef std::shared_ptr<BooleanHistory> Ptr;
+
+		/// <summary>
+		/// The histories of the OCCT algorithms run by a Boolean operation. The histories in the same step are
+		/// applied to the same shapes, and the steps are applied one after another.
+		/// </summary>
+		typedef std::vector<std::vector<Handle(BRepTools_History)>> OcctHistorySteps;
+
+	public:
+		TOPOLOGIC_API BooleanHistory();
+
+		TOPOLOGIC_API virtual ~BooleanHistory();
+
+		/// <summary>
+		/// Returns the members of the result which replace a member of an operand, e.g. the parts of a split Face.
+		/// An unchanged member is not modified.
+		/// </summary>
+		/// <param name="kpInput">A Vertex, Edge, Face or Cell of an operand</param>
+		/// <param name="rModified">The members of the result</param>
+		TOPOLOGIC_API void Modified(const Topology::Ptr& kpInput, std::list<Topology::Ptr>& rModified) const;
+
+		/// <summary>
+		/// Returns the members of the result which are generated from a member of an operand but have a lower
+		/// dimension, e.g. the Edges where a Face is cut.
+		/// </summary>
+		/// <param name="kpInput">A Vertex, Edge, Face or Cell of an operand</param>
+		/// <param name="rGenerated">The members of the result</param>
+		TOPOLOGIC_API void Generated(const Topology::Ptr& kpInput, std::list<Topology::Ptr>& rGenerated) const;
+
+		/// <summary>
+		/// Checks if a member of an operand is neither in the result nor modified into any member of the result.
+		/// </summary>
+		/// <param name="kpInput">A Vertex, Edge, Face or Cell of an operand</param>
+		/// <returns name="bool">True if the member is deleted, otherwise False</returns>
+		TOPOLOGIC_API bool IsDeleted(const Topology::Ptr& kpInput) const;
+
+		/// <summary>
+		/// Returns the members of the operands which a member of the result comes from. This is the member itself if
+		/// it is unchanged.
+		/// </summary>
+		/// <param name="kpOutput">A Vertex, Edge, Face or Cell of the result</param>
+		/// <param name="rOrigins">The members of the operands</param>
+		TOPOLOGIC_API void Origins(const Topology::Ptr& kpOutput, std::list<Topology::Ptr>& rOrigins) const;
+
+		TOPOLOGIC_API void Modified(const TopoDS_Shape& rkOcctInput, TopTools_ListOfShape& rOcctModified) const;
+
+		TOPOLOGIC_API void Generated(const TopoDS_Shape& rkOcctInput, TopTools_ListOfShape& rOcctGenerated) const;
+
+		TOPOLOGIC_API bool IsDeleted(const TopoDS_Shape& rkOcctInput) const;
+
+		TOPOLOGIC_API void Origins(const TopoDS_Shape& rkOcctOutput, TopTools_ListOfShape& rOcctOrigins) const;
+
+		/// <summary>
+		/// Removes the recorded history.
+		/// </summary>
+		TOPOLOGIC_API void Clear();
+
+	protected:
+		/// <summary>
+		/// Records the history of a Boolean operation. The histories only need to cover the operands which are passed
+		/// to the OCCT algorithms; the other members are unchanged if they are in the result and deleted otherwise.
+		/// </summary>
+		/// <param name="rkOcctOperands">The operands</param>
+		/// <param name="rkOcctHistorySteps">The histories of the OCCT algorithms</param>
+		/// <param name="rkOcctResult">The result, can be null</param>
+		void Build(const TopTools_ListOfShape& rkOcctOperands, const OcctHistorySteps& rkOcctHistorySteps, const TopoDS_Shape& rkOcctResult);
+
+		/// <summary>
+		/// Adds the images of a shape through the histories of a step, i.e. the shapes it is modified into, or the shape
+		/// itself if it is kept.
+		/// </summary>
+		static void AddImages(const TopoDS_Shape& rkOcctShape, const std::vector<Handle(BRepTools_History)>& rkOcctHistories,
+			TopTools_MapOfShape& rOcctVisitedImages, TopTools_ListOfShape& rOcctImages);
+
+		/// <summary>
+		/// The steps of the recorded operation, kept so that they can be composed with the steps of an enclosing
+		/// operation
+		/// </summary>
+		OcctHistorySteps m_occtHistorySteps;
+
+		/// <summary>
+		/// The modified and generated members of the result, keyed by the members of the operands
+		/// </summary>
+		TopTools_DataMapOfShapeListOfShape m_occtModified;
+		TopTools_DataMapOfShapeListOfShape m_occtGenerated;
+
+		/// <summary>
+		/// The members of the operands, keyed by the members of the result
+		/// </summary>
+		TopTools_DataMapOfShapeListOfShape m_occtOrigins;
+
+		/// <summary>
+		/// The deleted members of the operands
+		/// </summary>
+		TopTools_MapOfShape m_occtDeleted;
+	};
+}
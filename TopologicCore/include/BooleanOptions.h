@@ -0,0 +1,96 @@
+// This file is part of Topologic software library.
+// Copyright(C) 2019, Cardiff University and University College London
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "Utilities.h"
+#include "ProgressMonitor.h"
+
+#include <BOPAlgo_Builder.hxx>
+#include <BOPAlgo_GlueEnum.hxx>
+#include <BOPAlgo_PaveFiller.hxx>
+#include <BRepAlgoAPI_BuilderAlgo.hxx>
+
+namespace TopologicCore
+{
+	/// <summary>
+	/// The options of the OCCT Boolean algorithms used by the Boolean operations of Topology. The default options
+	/// reproduce the default behaviour of the operations.
+	/// </summary>
+	struct BooleanOptions
+	{
+		TOPOLOGIC_API BooleanOptions();
+
+		/// <summary>
+		/// Applies the options to a non-regular Boolean algorithm (e.g. BOPAlgo_CellsBuilder or BOPAlgo_MakerVolume).
+		/// </summary>
+		/// <param name="rOcctBuilder">An OCCT Boolean algorithm</param>
+		TOPOLOGIC_API void Apply(BOPAlgo_Builder& rOcctBuilder) const;
+
+		/// <summary>
+		/// Applies the options to a regular Boolean operation (e.g. BRepAlgoAPI_Fuse).
+		/// </summary>
+		/// <param name="rOcctBooleanOperation">An OCCT Boolean operation</param>
+		TOPOLOGIC_API void Apply(BRepAlgoAPI_BuilderAlgo& rOcctBooleanOperation) const;
+
+		/// <summary>
+		/// Applies the options to an intersection which is shared by several Boolean algorithms.
+		/// </summary>
+		/// <param name="rOcctPaveFiller">An OCCT intersection algorithm</param>
+		TOPOLOGIC_API void Apply(BOPAlgo_PaveFiller& rOcctPaveFiller) const;
+
+		/// <summary>
+		/// The fuzzy tolerance, added to the tolerances of the arguments. 0 keeps the default tolerance of the operation.
+		/// </summary>
+		double fuzzyValue;
+
+		/// <summary>
+		/// The gluing mode for arguments which share coincident sub-shapes: BOPAlgo_GlueOff, BOPAlgo_GlueShift or
+		/// BOPAlgo_GlueFull. Gluing skips most intersection tests, so it is only valid if the arguments do not interfere.
+		/// </summary>
+		BOPAlgo_GlueEnum glue;
+
+		/// <summary>
+		/// If True, the arguments are not modified by the non-regular operations. The regular operations (e.g. Union)
+		/// are always non-destructive.
+		/// </summary>
+		bool nonDestructive;
+
+		/// <summary>
+		/// If True, the oriented bounding boxes of the arguments are used to filter out the pairs which do not interfere.
+		/// </summary>
+		bool useOBB;
+
+		/// <summary>
+		/// If True, the binary Boolean operations of Topology compare the bounding boxes of the operands (their
+		/// sub-topologies if they are containers) first, and only intersect the operands which may interact. The other
+		/// operands are copied to the result as they are, keeping their dictionaries. False by default.
+		/// </summary>
+		bool prefilter;
+
+		/// <summary>
+		/// If True, SelfMerge splits the members of the Topology into tiles which do not interact, by comparing their
+		/// bounding boxes, and self-merges the tiles in parallel. The result is the same as the one of a single pass.
+		/// </summary>
+		bool tiledSelfMerge;
+
+		/// <summary>
+		/// If not null, receives the progress of the operation, which stops when the monitor is cancelled or its time
+		/// limit is reached.
+		/// </summary>
+		ProgressMonitor::Ptr progressMonitor;
+	};
+}
@@ -0,0 +1,176 @@
+// This file is part of Topologic software library.
+// Copyright(C) 2019, Cardiff University and University College London
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "Utilities.h"
+#include "Topology.h"
+
+#include <BOPAlgo_CellsBuilder.hxx>
+#include <BOPAlgo_PaveFiller.hxx>
+#include <TopTools_DataMapOfShapeShape.hxx>
+#include <TopTools_ListOfShape.hxx>
+
+#include <list>
+#include <memory>
+
+namespace TopologicCore
+{
+	/// <summary>
+	/// A BooleanSession intersects two Topologies once, then computes any number of Boolean operations between them from
+	/// the shared intersection. Use it when several Boolean results of the same operands are needed, e.g. in design-option
+	/// studies. The results are the same as those of the Topology methods with the same names, except that Intersect does not
+	/// repeat the Section parts which bound the Common parts. The results of one session are built from the same split
+	/// operands, so they share their sub-shapes (TShapes): a dictionary transferred to a sub-topology of one result is
+	/// also visible in the other results.
+	/// </summary>
+	class BooleanSession
+	{
+	public:
+		typedef std::shared_ptr<BooleanSession> Ptr;
+
+	public:
+		/// <summary>
+		/// Creates a session and intersects the Topologies.
+		/// </summary>
+		/// <param name="kpTopologyA">The first Topology</param>
+		/// <param name="kpTopologyB">The second Topology (the tool)</param>
+		/// <param name="kFixOperands">If True, fix the Faces, Shells and Cells of the operands before intersecting them</param>
+		/// <param name="rkOptions">The options of the OCCT Boolean algorithms</param>
+		TOPOLOGIC_API BooleanSession(const Topology::Ptr& kpTopologyA, const Topology::Ptr& kpTopologyB, const bool kFixOperands = false, const BooleanOptions& rkOptions = BooleanOptions());
+
+		TOPOLOGIC_API virtual ~BooleanSession();
+
+		/// <summary>
+		/// Returns the parts of the first Topology which are not in the second Topology.
+		/// </summary>
+		/// <param name="kTransferDictionary">If True, transfer the dictionaries of the Topologies to the result</param>
+		/// <returns name="Topology">The result</returns>
+		TOPOLOGIC_API Topology::Ptr Difference(const bool kTransferDictionary = false);
+
+		/// <summary>
+		/// Imposes the second Topology on the first Topology.
+		/// </summary>
+		/// <param name="kTransferDictionary">If True, transfer the dictionaries of the Topologies to the result</param>
+		/// <returns name="Topology">The result</returns>
+		TOPOLOGIC_API Topology::Ptr Impose(const bool kTransferDictionary = false);
+
+		/// <summary>
+		/// Imprints the second Topology on the first Topology.
+		/// </summary>
+		/// <param name="kTransferDictionary">If True, transfer the dictionaries of the Topologies to the result</param>
+		/// <returns name="Topology">The result</returns>
+		TOPOLOGIC_API Topology::Ptr Imprint(const bool kTransferDictionary = false);
+
+		/// <summary>
+		/// Returns the parts which are shared by both Topologies.
+		/// </summary>
+		/// <param name="kTransferDictionary">If True, transfer the dictionaries of the Topologies to the result</param>
+		/// <returns name="Topology">The result</returns>
+		TOPOLOGIC_API Topology::Ptr Intersect(const bool kTransferDictionary = false);
+
+		/// <summary>
+		/// Merges the Topologies, keeping all their parts.
+		/// </summary>
+		/// <param name="kTransferDictionary">If True, transfer the dictionaries of the Topologies to the result</param>
+		/// <returns name="Topology">The result</returns>
+		TOPOLOGIC_API Topology::Ptr Merge(const bool kTransferDictionary = false);
+
+		/// <summary>
+		/// Slices the first Topology by the second Topology.
+		/// </summary>
+		/// <param name="kTransferDictionary">If True, transfer the dictionaries of the Topologies to the result</param>
+		/// <returns name="Topology">The result</returns>
+		TOPOLOGIC_API Topology::Ptr Slice(const bool kTransferDictionary = false);
+
+		/// <summary>
+		/// Unions the Topologies.
+		/// </summary>
+		/// <param name="kTransferDictionary">If True, transfer the dictionaries of the Topologies to the result</param>
+		/// <returns name="Topology">The result</returns>
+		TOPOLOGIC_API Topology::Ptr Union(const bool kTransferDictionary = false);
+
+		/// <summary>
+		/// Returns the parts which are only in one of the Topologies.
+		/// </summary>
+		/// <param name="kTransferDictionary">If True, transfer the dictionaries of the Topologies to the result</param>
+		/// <returns name="Topology">The result</returns>
+		TOPOLOGIC_API Topology::Ptr XOR(const bool kTransferDictionary = false);
+
+	protected:
+		/// <summary>
+		/// Returns the fixed version of an operand. Each operand is only fixed once per session.
+		/// </summary>
+		/// <param name="rkOcctOperand">An operand</param>
+		/// <returns name="TopoDS_Shape">The fixed operand</returns>
+		TopoDS_Shape FixedOperand(const TopoDS_Shape& rkOcctOperand);
+
+		/// <summary>
+		/// Returns the operands of both Topologies.
+		/// </summary>
+		/// <param name="rOcctArguments">The operands</param>
+		void Arguments(TopTools_ListOfShape& rOcctArguments) const;
+
+		/// <summary>
+		/// Returns the CellsBuilder split from the shared intersection, with an empty result.
+		/// </summary>
+		/// <returns name="BOPAlgo_CellsBuilder">The CellsBuilder</returns>
+		BOPAlgo_CellsBuilder& CellsBuilder();
+
+		/// <summary>
+		/// Splits the operands in a CellsBuilder from the shared intersection.
+		/// </summary>
+		/// <param name="rOcctCellsBuilder">The CellsBuilder</param>
+		void BuildCells(BOPAlgo_CellsBuilder& rOcctCellsBuilder);
+
+		/// <summary>
+		/// Builds the result of a non-regular operation from the parts added to the CellsBuilder.
+		/// </summary>
+		Topology::Ptr CellsBuilderResult(BOPAlgo_CellsBuilder& rOcctCellsBuilder, const bool kTransferContentsB, const bool kTransferDictionary);
+
+		/// <summary>
+		/// The Topologies of the session
+		/// </summary>
+		Topology::Ptr m_pTopologyA;
+		Topology::Ptr m_pTopologyB;
+
+		/// <summary>
+		/// The operands of each Topology (its sub-topologies if it is a container)
+		/// </summary>
+		TopTools_ListOfShape m_occtArgumentsA;
+		TopTools_ListOfShape m_occtArgumentsB;
+
+		/// <summary>
+		/// The cache of the fixed operands
+		/// </summary>
+		TopTools_DataMapOfShapeShape m_occtMapOperandToFixedOperand;
+
+		/// <summary>
+		/// The options of the OCCT Boolean algorithms
+		/// </summary>
+		BooleanOptions m_options;
+
+		/// <summary>
+		/// The shared intersection of the operands
+		/// </summary>
+		BOPAlgo_PaveFiller m_occtPaveFiller;
+
+		/// <summary>
+		/// The CellsBuilder shared by the operations which do not use materials, created on first use
+		/// </summary>
+		std::unique_ptr<BOPAlgo_CellsBuilder> m_pOcctCellsBuilder;
+	};
+}
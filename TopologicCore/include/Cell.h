@@ -59,12 +59,25 @@ namespace TopologicCore
 		/// <param name="rAdjacentCells">>A list of Cells adjacent to the Cell</param>
 		TOPOLOGIC_API void AdjacentCells(const Topology::Ptr& kpHostTopology, std::list<std::shared_ptr<Cell>>& rAdjacentCells) const;
 
+		// The vector overloads of the navigation methods below are inherited from Topology.
+		using Topology::Shells;
+		using Topology::Edges;
+		using Topology::Faces;
+		using Topology::Vertices;
+		using Topology::Wires;
+
 		/// <summary>
 		/// Returns the CellComplexes which contain the Cell.
 		/// </summary>
 		/// <param name="rCellComplexes">A list of CellComplexes containing the Cell</param>
 		TOPOLOGIC_API void CellComplexes(const Topology::Ptr& kpHostTopology, std::list<std::shared_ptr<CellComplex>>& rCellComplexes) const;
 
+		/// <summary>
+		/// Returns the CellComplexes which contain the Cell, stored contiguously.
+		/// </summary>
+		/// <param name="rCellComplexes">A vector of CellComplexes containing the Cell</param>
+		TOPOLOGIC_API void CellComplexes(const Topology::Ptr& kpHostTopology, std::vector<std::shared_ptr<CellComplex>>& rCellComplexes) const;
+
 		/// <summary>
 		/// Returns the Shells constituent to the Cell.
 		/// </summary>
@@ -19,8 +19,10 @@
 #include "Topology.h"
 
 #include <list>
+#include <vector>
 
 #include <TopoDS_CompSolid.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
 
 namespace TopologicCore
 {
@@ -53,6 +55,14 @@ namespace TopologicCore
 
 		TOPOLOGIC_API virtual ~CellComplex();
 
+		// The vector overloads of the navigation methods below are inherited from Topology.
+		using Topology::Shells;
+		using Topology::Edges;
+		using Topology::Faces;
+		using Topology::Vertices;
+		using Topology::Wires;
+		using Topology::Cells;
+
 		/// <summary>
 		/// Returns the Cells constituent to the CellComplex.
 		/// </summary>
@@ -107,8 +117,9 @@ namespace TopologicCore
 		/// Creates a CellComplex from the space enclosed by a set of Faces. Parts of the Faces which do not enclose any space will be discarded.
 		/// </summary>
 		/// <param name="rkFaces">A set of Faces</param>
+		/// <param name="rkOptions">The options of the OCCT Boolean algorithms. A positive fuzzy value overrides the tolerance.</param>
 		/// <returns name="CellComplex">The created CellComplex</returns> 
-		TOPOLOGIC_API static std::shared_ptr<CellComplex> ByFaces(const std::list<std::shared_ptr<Face>>& rkFaces, const double kTolerance, const bool kCopyAttributes = false);
+		TOPOLOGIC_API static std::shared_ptr<CellComplex> ByFaces(const std::list<std::shared_ptr<Face>>& rkFaces, const double kTolerance, const bool kCopyAttributes = false, const BooleanOptions& rkOptions = BooleanOptions());
 
 		/// <summary>
 		/// Returns the external boundary (Cell) of the CellComplex.
@@ -122,6 +133,40 @@ namespace TopologicCore
 		/// <param name="rkInternalFaces">The internal boundaries (Faces) of the CellComplex</param>
 		TOPOLOGIC_API void InternalBoundaries(std::list<std::shared_ptr<Face>>& rInternalFaces) const;
 
+		/// <summary>
+		/// Computes the adjacency of all Cells in the CellComplex in one pass over its Faces. The result is stored in a compressed
+		/// sparse row layout: the entries of the i-th Cell are in [rAdjacencyOffsets[i], rAdjacencyOffsets[i + 1]). Each entry
+		/// stores an adjacent Cell index and the index of the shared Face, so a pair of Cells sharing n Faces has n entries.
+		/// </summary>
+		/// <param name="rCells">The Cells of the CellComplex, in index order</param>
+		/// <param name="rSharedFaces">The Faces shared by two or more Cells, in index order</param>
+		/// <param name="rAdjacencyOffsets">The offsets of each Cell's entries (number of Cells + 1 items)</param>
+		/// <param name="rAdjacentCellIndices">The indices of the adjacent Cells</param>
+		/// <param name="rSharedFaceIndices">The indices of the shared Faces</param>
+		TOPOLOGIC_API void CellAdjacency(
+			std::vector<std::shared_ptr<Cell>>& rCells,
+			std::vector<std::shared_ptr<Face>>& rSharedFaces,
+			std::vector<int>& rAdjacencyOffsets,
+			std::vector<int>& rAdjacentCellIndices,
+			std::vector<int>& rSharedFaceIndices) const;
+
+		/// <summary>
+		/// Computes the adjacency of all OCCT Solids in an OCCT shape. See the non-static overload for the layout.
+		/// </summary>
+		/// <param name="rkOcctShape">An OCCT shape</param>
+		/// <param name="rOcctCells">The OCCT Solids; the (1-based) map index minus one is the Cell index</param>
+		/// <param name="rOcctSharedFaces">The OCCT Faces shared by two or more Solids; the (1-based) map index minus one is the Face index</param>
+		/// <param name="rAdjacencyOffsets">The offsets of each Solid's entries (number of Solids + 1 items)</param>
+		/// <param name="rAdjacentCellIndices">The indices of the adjacent Solids</param>
+		/// <param name="rSharedFaceIndices">The indices of the shared Faces</param>
+		TOPOLOGIC_API static void CellAdjacency(
+			const TopoDS_Shape& rkOcctShape,
+			TopTools_IndexedMapOfShape& rOcctCells,
+			TopTools_IndexedMapOfShape& rOcctSharedFaces,
+			std::vector<int>& rAdjacencyOffsets,
+			std::vector<int>& rAdjacentCellIndices,
+			std::vector<int>& rSharedFaceIndices);
+
 		/// <summary>
 		/// Returns True if this CellComplex is a manifold, otherwise a False.
 		/// </summary>
@@ -117,6 +117,15 @@ namespace TopologicCore
 		/// <param name="rOcctGeometries">The created geometry</param>
 		TOPOLOGIC_API virtual void Geometry(std::list<Handle(Geom_Geometry)>& rOcctGeometries) const;
 
+		// The vector overloads of the navigation methods below are inherited from Topology.
+		using Topology::Shells;
+		using Topology::Edges;
+		using Topology::Faces;
+		using Topology::Vertices;
+		using Topology::Wires;
+		using Topology::Cells;
+		using Topology::CellComplexes;
+
 		/// <summary>
 		/// Returns the Shells constituent to the Cluster.
 		/// </summary>
@@ -19,6 +19,7 @@
 #include "Utilities.h"
 
 #include <TopoDS_Shape.hxx>
+#include <TopTools_ListOfShape.hxx>
 
 #include <list>
 #include <map>
@@ -65,6 +66,26 @@ namespace TopologicCore
 		/// <returns name="bool">Returns True if the Topology has contents, otherwise False</returns>
 		bool Find(const TopoDS_Shape& rkOcctShape, std::list<std::shared_ptr<Topology>>& rContents);
 
+		/// <summary>
+		/// Returns the contents of a OCCT shape without copying them. The returned list is empty if the shape has no contents,
+		/// and is only valid until the contents of the shape are modified.
+		/// </summary>
+		/// <param name="rkOcctShape">An OCCT shape</param>
+		/// <returns name="std::list<Topology::Ptr>">The contents</returns>
+		const std::list<std::shared_ptr<Topology>>& Find(const TopoDS_Shape& rkOcctShape) const;
+
+		/// <summary>
+		/// Returns the OCCT shapes which have at least one content.
+		/// </summary>
+		/// <param name="rOcctShapes">The OCCT shapes which have contents</param>
+		void ShapesWithContents(TopTools_ListOfShape& rOcctShapes) const;
+
+		/// <summary>
+		/// Returns True if no OCCT shape has contents, otherwise False.
+		/// </summary>
+		/// <returns name="bool">True if no OCCT shape has contents, otherwise False</returns>
+		bool IsEmpty() const;
+
 		/// <summary>
 		/// Returns True if the OCCT shape contains the content Topology, otherwise False
 		/// </summary>
@@ -86,7 +107,8 @@ namespace TopologicCore
 
 	protected:
 		/// <summary>
-		/// The map which pairs an OCCT shape with a list of contents
+		/// The map which pairs an OCCT shape with a list of contents. Only the shapes which have contents are stored, so the keys
+		/// are also the index of the shapes with contents.
 		/// </summary>
 		std::map<TopoDS_Shape, std::list<std::shared_ptr<Topology>>, OcctShapeComparator> m_occtShapeToContentsMap;
 	};
@@ -61,6 +61,14 @@ namespace TopologicCore
 		/// <param name="rContexts">Contexts</param>
 		bool Find(const TopoDS_Shape& rkOcctShape, std::list<std::shared_ptr<Context>>& rContexts);
 
+		/// <summary>
+		/// Returns the Contexts of a Topology without copying them. The returned list is empty if the shape has no Contexts,
+		/// and is only valid until the Contexts of the shape are modified.
+		/// </summary>
+		/// <param name="rkOcctShape">An OCCT shape</param>
+		/// <returns name="std::list<Context::Ptr>">The Contexts</returns>
+		const std::list<std::shared_ptr<Context>>& Find(const TopoDS_Shape& rkOcctShape) const;
+
 		/// <summary>
 		/// Clear the contexts of an OCCT shape.
 		/// </summary>
@@ -74,7 +82,7 @@ namespace TopologicCore
 
 	protected:
 		/// <summary>
-		/// The map which pairs an OCCT shape with a list of Contexts
+		/// The map which pairs an OCCT shape with a list of Contexts. Only the shapes which have Contexts are stored.
 		/// </summary>
 		std::map<TopoDS_Shape, std::list<std::shared_ptr<Context>>, OcctShapeComparator> m_occtShapeToContextsMap;
 	};
@@ -86,12 +86,23 @@ namespace TopologicCore
 		/// <returns name="Vertex">The end Vertex of the Edge</returns>
 		TOPOLOGIC_API std::shared_ptr<Vertex> EndVertex() const;
 
+		// The vector overloads of the navigation methods below are inherited from Topology.
+		using Topology::Faces;
+		using Topology::Vertices;
+		using Topology::Wires;
+
 		/// <summary>
 		/// Returns the Vertices at the ends of the Edge.
 		/// </summary>
 		/// <param name="rVertices">A list of Vertices at the ends of the Edge</param>
 		TOPOLOGIC_API void Vertices(const Topology::Ptr& kpHostTopology, std::list<std::shared_ptr<Vertex>>& rVertices) const;
 
+		/// <summary>
+		/// Returns the Vertices at the ends of the Edge, stored contiguously.
+		/// </summary>
+		/// <param name="rVertices">The Vertices at the ends of the Edge</param>
+		TOPOLOGIC_API void Vertices(const Topology::Ptr& kpHostTopology, std::vector<std::shared_ptr<Vertex>>& rVertices) const;
+
 		/// <summary>
 		/// Returns the Wires incident to the Edge.
 		/// </summary>
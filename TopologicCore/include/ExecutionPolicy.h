@@ -0,0 +1,122 @@
+// This file is part of Topologic software library.
+// Copyright(C) 2019, Cardiff University and University College London
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "Utilities.h"
+
+#include <BOPAlgo_Options.hxx>
+
+#include <atomic>
+#include <memory>
+
+namespace TopologicCore
+{
+	/// <summary>
+	/// ExecutionPolicy stores the library-wide settings which control how the OCCT algorithms are run, e.g. whether the
+	/// Boolean and volume-making operations use several threads.
+	/// </summary>
+	class TOPOLOGIC_API ExecutionPolicy
+	{
+	public:
+		typedef std::shared_ptr<ExecutionPolicy> Ptr;
+
+	public:
+		static ExecutionPolicy& GetInstance()
+		{
+			static ExecutionPolicy instance;
+			return instance;
+		}
+
+		/// <summary>
+		/// Enables or disables the parallel mode of the OCCT algorithms.
+		/// </summary>
+		/// <param name="kRunParallel">True to run the OCCT algorithms in parallel, otherwise False</param>
+		void SetRunParallel(const bool kRunParallel);
+
+		/// <summary>
+		/// Returns True if the OCCT algorithms run in parallel, otherwise False.
+		/// </summary>
+		/// <returns name="bool">True if the OCCT algorithms run in parallel, otherwise False</returns>
+		bool GetRunParallel() const;
+
+		/// <summary>
+		/// Sets the number of threads used by the OCCT algorithms in parallel mode, and by the tiled SelfMerge and the
+		/// Graph centralities. A positive number resizes the default OCCT thread pool and switches OSD_Parallel to it, since
+		/// the TBB backend ignores the pool size. A non-positive number uses all logical processors and leaves the backend unchanged.
+		/// </summary>
+		/// <param name="kNumberOfThreads">The number of threads</param>
+		void SetNumberOfThreads(const int kNumberOfThreads);
+
+		/// <summary>
+		/// Returns the number of threads used by the OCCT algorithms in parallel mode.
+		/// </summary>
+		/// <returns name="int">The number of threads</returns>
+		int GetNumberOfThreads() const;
+
+		/// <summary>
+		/// Selects the backend of OSD_Parallel: the OCCT thread pool, or TBB if OCCT was built with it. This is a
+		/// process-wide OCCT setting.
+		/// </summary>
+		/// <param name="kUseOcctThreads">True to use the OCCT thread pool, otherwise False</param>
+		void SetUseOcctThreads(const bool kUseOcctThreads);
+
+		/// <summary>
+		/// Returns True if OSD_Parallel uses the OCCT thread pool, otherwise False.
+		/// </summary>
+		/// <returns name="bool">True if OSD_Parallel uses the OCCT thread pool, otherwise False</returns>
+		bool GetUseOcctThreads() const;
+
+		/// <summary>
+		/// Applies the policy to an OCCT algorithm (e.g. BOPAlgo_CellsBuilder, BOPAlgo_MakerVolume or
+		/// BRepAlgoAPI_BooleanOperation) before it is performed.
+		/// </summary>
+		/// <param name="rOcctAlgorithm">An OCCT algorithm</param>
+		void Apply(BOPAlgo_Options& rOcctAlgorithm) const;
+
+		/// <summary>
+		/// Enables or disables the trusted-input mode. In this mode, the constructors of the Topologies and SelfMerge do
+		/// not run the OCCT shape fixers, e.g. ShapeFix_Shape and ShapeFix_Face, on the shapes they create. Use it when the
+		/// input is known to be valid, and check the result once with Topology::Validate.
+		/// </summary>
+		/// <param name="kTrustInput">True to skip the shape fixers, otherwise False</param>
+		void SetTrustInput(const bool kTrustInput);
+
+		/// <summary>
+		/// Returns True if the shape fixers are skipped, otherwise False.
+		/// </summary>
+		/// <returns name="bool">True if the shape fixers are skipped, otherwise False</returns>
+		bool GetTrustInput() const;
+
+	protected:
+		ExecutionPolicy();
+
+		/// <summary>
+		/// Whether the OCCT algorithms run in parallel. It is read by the worker threads of the parallel operations.
+		/// </summary>
+		std::atomic<bool> m_runParallel;
+
+		/// <summary>
+		/// The number of threads used in parallel mode. It is read by the worker threads of the parallel operations.
+		/// </summary>
+		std::atomic<int> m_numberOfThreads;
+
+		/// <summary>
+		/// Whether the shape fixers are skipped. It is read by the worker threads of the parallel operations.
+		/// </summary>
+		std::atomic<bool> m_trustInput;
+	};
+}
@@ -70,6 +70,13 @@ namespace TopologicCore
 		/// <param name="rFaces"></param>
 		TOPOLOGIC_API void AdjacentFaces(const Topology::Ptr& kpHostTopology, std::list<std::shared_ptr<Face>>& rFaces) const;
 
+		// The vector overloads of the navigation methods below are inherited from Topology.
+		using Topology::Shells;
+		using Topology::Edges;
+		using Topology::Vertices;
+		using Topology::Wires;
+		using Topology::Cells;
+
 		/// <summary>
 		/// 
 		/// </summary>
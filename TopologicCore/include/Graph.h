@@ -17,11 +17,20 @@
 #pragma once
 
 #include "Dictionary.h"
+#include "ProgressMonitor.h"
 #include "Utilities.h"
 #include "Vertex.h"
 #include "Edge.h"
 
+#include <gp_Pnt.hxx>
+#include <TopTools_DataMapOfShapeInteger.hxx>
+
+#include <cstdint>
+#include <functional>
 #include <list>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
 #include <chrono>
 
 namespace TopologicCore
@@ -40,6 +49,12 @@ namespace TopologicCore
 	public:
 		typedef std::shared_ptr<Graph> Ptr;
 
+		/// <summary>
+		/// Receives a path as the indices of its Vertices in the order of Vertices(), and returns False to stop the
+		/// search.
+		/// </summary>
+		typedef std::function<bool(const std::vector<int>& rkPathVertexIndices)> PathCallback;
+
 	public:
 		TOPOLOGIC_API static Graph::Ptr ByVerticesEdges(const std::list<Vertex::Ptr>& rkVertices, const std::list<Edge::Ptr>& rkEdges);
 
@@ -51,7 +66,8 @@ namespace TopologicCore
 			const bool kToExteriorTopologies, 
 			const bool kToExteriorApertures,
 			const bool useFaceInternalVertex,
-			const double kTolerance);
+			const double kTolerance,
+			const ProgressMonitor::Ptr& kpProgressMonitor = nullptr);
 
 		TOPOLOGIC_API Graph(const std::list<Vertex::Ptr>& rkVertices, const std::list<Edge::Ptr>& rkEdges);
 
@@ -62,6 +78,10 @@ namespace TopologicCore
 		//TOPOLOGIC_API Topology::Ptr Topology() const;
 		TOPOLOGIC_API TopologicCore::Topology::Ptr Topology() const;
 
+		TOPOLOGIC_API int NumberOfVertices() const;
+
+		TOPOLOGIC_API int NumberOfEdges() const;
+
 		TOPOLOGIC_API void Vertices(std::list<std::shared_ptr<Vertex>>& rVertices) const;
 
 		TOPOLOGIC_API void Edges(std::list<std::shared_ptr<Edge>>& rEdges, const double kTolerance = 0.0001) const;
@@ -71,6 +91,15 @@ namespace TopologicCore
 			const double kTolerance,
 			std::list<std::shared_ptr<Edge>>& rEdges) const;
 
+		TOPOLOGIC_API void Vertices(std::vector<std::shared_ptr<Vertex>>& rVertices) const;
+
+		TOPOLOGIC_API void Edges(std::vector<std::shared_ptr<Edge>>& rEdges, const double kTolerance = 0.0001) const;
+
+		TOPOLOGIC_API void Edges(
+			const std::vector<std::shared_ptr<Vertex>>& rkVertices,
+			const double kTolerance,
+			std::vector<std::shared_ptr<Edge>>& rEdges) const;
+
 		TOPOLOGIC_API void AddVertices(const std::list<std::shared_ptr<Vertex>>& rkVertices, const double kTolerance);
 
 		TOPOLOGIC_API void AddEdges(const std::list<std::shared_ptr<Edge>>& rkEdges, const double kTolerance);
@@ -121,6 +150,25 @@ namespace TopologicCore
 			std::list<Vertex::Ptr>& rPath,
 			std::list<std::shared_ptr<Wire>>& rPaths) const;
 
+		/// <summary>
+		/// Enumerates the paths without repeated Vertices between two Vertices by Depth-First Search, and passes each
+		/// to a callback as it is found, without making a Wire of it.
+		/// </summary>
+		/// <param name="kpStartVertex">The start Vertex</param>
+		/// <param name="kpEndVertex">The end Vertex</param>
+		/// <param name="kMaxNumberOfPaths">The largest number of paths, or 0 for no limit</param>
+		/// <param name="kMaxNumberOfEdges">The largest number of Edges of a path, or 0 for no limit</param>
+		/// <param name="kTimeLimitInSeconds">The time after which the search stops, or 0 for no limit</param>
+		/// <param name="rkCallback">Receives the paths</param>
+		/// <returns name="int">The number of paths passed to the callback</returns>
+		TOPOLOGIC_API int AllPaths(
+			const Vertex::Ptr& kpStartVertex,
+			const Vertex::Ptr& kpEndVertex,
+			const int kMaxNumberOfPaths,
+			const int kMaxNumberOfEdges,
+			const double kTimeLimitInSeconds,
+			const PathCallback& rkCallback) const;
+
 		TOPOLOGIC_API std::shared_ptr<Wire> Path(
 			const Vertex::Ptr& kpStartVertex,
 			const Vertex::Ptr& kpEndVertex) const;
@@ -160,8 +208,121 @@ namespace TopologicCore
 			const int kTimeLimitInSeconds,
 			std::list<std::shared_ptr<Wire>>& rPaths) const;
 
+		/// <summary>
+		/// Finds the cheapest paths without repeated Vertices between two Vertices by Yen's algorithm, by increasing
+		/// cost. Paths of the same cost are returned in a deterministic order. The costs are those of ShortestPath.
+		/// </summary>
+		/// <param name="kpStartVertex">The start Vertex</param>
+		/// <param name="kpEndVertex">The end Vertex</param>
+		/// <param name="rkVertexKey">The key of the Vertex costs, can be empty</param>
+		/// <param name="rkEdgeKey">The key of the Edge costs, can be empty</param>
+		/// <param name="kMaxNumberOfPaths">The largest number of paths</param>
+		/// <param name="kMaxCost">The largest cost of a path, or a negative value for no limit</param>
+		/// <param name="rPathVertexIndices">The paths, as the indices of their Vertices in the order of Vertices(). The found
+		/// paths replace the content.</param>
+		/// <param name="rPathCosts">The costs of the paths</param>
+		TOPOLOGIC_API void KShortestPaths(
+			const Vertex::Ptr& kpStartVertex,
+			const Vertex::Ptr& kpEndVertex,
+			const std::string& rkVertexKey,
+			const std::string& rkEdgeKey,
+			const int kMaxNumberOfPaths,
+			const double kMaxCost,
+			std::vector<std::vector<int>>& rPathVertexIndices,
+			std::vector<double>& rPathCosts) const;
+
+		/// <summary>
+		/// Finds the cheapest paths without repeated Vertices between two Vertices, as Wires.
+		/// </summary>
+		TOPOLOGIC_API void KShortestPaths(
+			const Vertex::Ptr& kpStartVertex,
+			const Vertex::Ptr& kpEndVertex,
+			const std::string& rkVertexKey,
+			const std::string& rkEdgeKey,
+			const int kMaxNumberOfPaths,
+			const double kMaxCost,
+			std::list<std::shared_ptr<Wire>>& rPaths) const;
+
 		TOPOLOGIC_API int Diameter() const;
 
+		/// <summary>
+		/// Computes the eccentricity of each Vertex, i.e. the largest number of Edges between it and another Vertex. The
+		/// Breadth-First Searches from the Vertices run 64 at a time, and in parallel if ExecutionPolicy allows it. The
+		/// eccentricities are infinite (the largest int) if the Graph is disconnected.
+		/// </summary>
+		/// <param name="rEccentricities">The eccentricities, in the order of Vertices()</param>
+		/// <param name="rDiameter">The largest eccentricity, 0 if the Graph is empty</param>
+		/// <param name="rRadius">The smallest eccentricity, 0 if the Graph is empty</param>
+		/// <param name="rCenterVertices">The Vertices whose eccentricity is the radius</param>
+		TOPOLOGIC_API void Eccentricities(std::list<int>& rEccentricities, int& rDiameter, int& rRadius, std::list<Vertex::Ptr>& rCenterVertices) const;
+
+		TOPOLOGIC_API int Radius() const;
+
+		TOPOLOGIC_API void Center(std::list<Vertex::Ptr>& rCenterVertices) const;
+
+		/// <summary>
+		/// Computes the costs of the shortest paths from some Vertices to all the Vertices, with the costs of
+		/// ShortestPath. Without keys, the costs are the numbers of Edges, which are found by Breadth-First Search;
+		/// otherwise Dijkstra's algorithm is used. The searches run in parallel if ExecutionPolicy allows it.
+		/// </summary>
+		/// <param name="rkSourceVertices">The source Vertices, or an empty list for all the Vertices</param>
+		/// <param name="rkVertexKey">The key of the Vertex costs, can be empty</param>
+		/// <param name="rkEdgeKey">The key of the Edge costs, can be empty</param>
+		/// <param name="rDistances">The costs in row-major order, with a row per source and a column per Vertex in the
+		/// order of Vertices(). The cost to an unreachable Vertex is infinite.</param>
+		TOPOLOGIC_API void DistanceMatrix(
+			const std::list<Vertex::Ptr>& rkSourceVertices,
+			const std::string& rkVertexKey,
+			const std::string& rkEdgeKey,
+			std::vector<double>& rDistances) const;
+
+		/// <summary>
+		/// Computes the distance matrix in single precision, which halves its memory.
+		/// </summary>
+		TOPOLOGIC_API void DistanceMatrix(
+			const std::list<Vertex::Ptr>& rkSourceVertices,
+			const std::string& rkVertexKey,
+			const std::string& rkEdgeKey,
+			std::vector<float>& rDistances) const;
+
+		/// <summary>
+		/// Computes the betweenness centrality of each Vertex, i.e. how many shortest paths between two other Vertices
+		/// pass through it, each pair contributing the fraction of its shortest paths which do, by Brandes' algorithm.
+		/// The costs are those of ShortestPath. The searches from the sources run in parallel if ExecutionPolicy allows
+		/// it.
+		/// </summary>
+		/// <param name="rkVertexKey">The key of the Vertex costs, can be empty</param>
+		/// <param name="rkEdgeKey">The key of the Edge costs, can be empty</param>
+		/// <param name="kNormalize">If True, divides the centralities by the number of pairs of the other Vertices</param>
+		/// <param name="kNumberOfSamples">The number of sources, picked with a fixed seed, from which the centralities
+		/// are estimated, or 0 to use all the Vertices</param>
+		/// <param name="rkDictionaryKey">If not empty, the centralities are also stored under this key in the
+		/// dictionaries of the Vertices</param>
+		/// <param name="rCentralities">The centralities, in the order of Vertices()</param>
+		TOPOLOGIC_API void BetweennessCentrality(
+			const std::string& rkVertexKey,
+			const std::string& rkEdgeKey,
+			const bool kNormalize,
+			const int kNumberOfSamples,
+			const std::string& rkDictionaryKey,
+			std::vector<double>& rCentralities) const;
+
+		/// <summary>
+		/// Computes the closeness centrality of each Vertex, i.e. the inverse of the average cost of the shortest paths
+		/// to the Vertices which it reaches, times the fraction of the other Vertices which it reaches. The costs are
+		/// those of ShortestPath. The searches run in parallel if ExecutionPolicy allows it.
+		/// </summary>
+		/// <param name="rkVertexKey">The key of the Vertex costs, can be empty</param>
+		/// <param name="rkEdgeKey">The key of the Edge costs, can be empty</param>
+		/// <param name="rkDictionaryKey">If not empty, the centralities are also stored under this key in the
+		/// dictionaries of the Vertices</param>
+		/// <param name="rCentralities">The centralities, in the order of Vertices(), 0 for an isolated Vertex</param>
+		TOPOLOGIC_API void ClosenessCentrality(
+			const std::string& rkVertexKey,
+			const std::string& rkEdgeKey,
+			const std::string& rkDictionaryKey,
+			std::vector<double>& rCentralities) const;
+
 		TOPOLOGIC_API int TopologicalDistance(const std::shared_ptr<Vertex>& kpStartVertex, const std::shared_ptr<Vertex>& kpEndVertex, const double kTolerance = 0.0001) const;
 
 		TOPOLOGIC_API int TopologicalDistance(const TopoDS_Vertex& rkOcctStartVertex, const TopoDS_Vertex& rkOcctEndVertex, const double kTolerance = 0.0001) const;
@@ -189,7 +350,17 @@ namespace TopologicCore
 
 	protected:
 
-		typedef std::map<TopoDS_Vertex, TopTools_MapOfShape, OcctShapeComparator> GraphMap;
+		/// <summary>
+		/// The adjacency of the Graph in compressed sparse row form. The Vertex with the ID i is adjacent to the Vertices
+		/// adjacentVertexIds[offsets[i]] to adjacentVertexIds[offsets[i + 1] - 1], through the Edges with the IDs at the
+		/// same positions in edgeIds.
+		/// </summary>
+		struct CompactAdjacency
+		{
+			std::vector<int> offsets;
+			std::vector<int> adjacentVertexIds;
+			std::vector<int> edgeIds;
+		};
 
 		static Graph::Ptr ByVertex(
 			const std::shared_ptr<Vertex> kpVertex,
@@ -238,7 +409,8 @@ namespace TopologicCore
 			const bool kToExteriorTopologies,
 			const bool kToExteriorApertures,
 			const bool kUseFaceInternalVertex,
-			const double kTolerance);
+			const double kTolerance,
+			const ProgressMonitor::Ptr& kpProgressMonitor);
 
 		static Graph::Ptr ByCluster(const std::shared_ptr<Cluster> kpCluster,
 			const bool kDirect,
@@ -247,7 +419,8 @@ namespace TopologicCore
 			const bool kToExteriorTopologies,
 			const bool kToExteriorApertures,
 			const bool kUseFaceInternalVertex,
-			const double kTolerance);
+			const double kTolerance,
+			const ProgressMonitor::Ptr& kpProgressMonitor);
 
 		std::shared_ptr<Wire> ConstructPath(const std::list<Vertex::Ptr>& rkPathVertices) const;
 
@@ -257,6 +430,37 @@ namespace TopologicCore
 			const int kTimeLimitInSeconds,
 			const std::chrono::system_clock::time_point& rkStartingTime) const;
 
+		std::shared_ptr<Wire> ConstructPath(const std::vector<int>& rkPathVertexIds) const;
+
+		/// <summary>
+		/// Enumerates the paths without repeated Vertices from a Vertex to another by Depth-First Search, with an
+		/// explicit stack of the positions reached in the adjacencies of the Vertices of the current path.
+		/// </summary>
+		/// <param name="kStartVertexId">The ID of the start Vertex</param>
+		/// <param name="kEndVertexId">The ID of the end Vertex</param>
+		/// <param name="kMaxNumberOfPaths">The largest number of paths, or 0 for no limit</param>
+		/// <param name="kMaxNumberOfEdges">The largest number of Edges from the start Vertex, or 0 for no limit</param>
+		/// <param name="kUseTimeLimit">If True, the search stops after the time limit</param>
+		/// <param name="kTimeLimitInSeconds">The time limit in seconds</param>
+		/// <param name="rkStartingTime">The time from which the time limit is measured</param>
+		/// <param name="rIsOnPath">Whether each Vertex is on the path, indexed by the Vertex IDs. The Vertices which
+		/// are already on it are avoided. It is restored before returning.</param>
+		/// <param name="rPathVertexIds">The IDs of the Vertices before the start Vertex, which are passed to the
+		/// callback with the rest of each path. It is restored before returning.</param>
+		/// <param name="rkCallback">Receives the paths, as Vertex IDs</param>
+		/// <returns name="int">The number of paths passed to the callback</returns>
+		int EnumeratePaths(
+			const int kStartVertexId,
+			const int kEndVertexId,
+			const int kMaxNumberOfPaths,
+			const int kMaxNumberOfEdges,
+			const bool kUseTimeLimit,
+			const double kTimeLimitInSeconds,
+			const std::chrono::system_clock::time_point& rkStartingTime,
+			std::vector<bool>& rIsOnPath,
+			std::vector<int>& rPathVertexIds,
+			const PathCallback& rkCallback) const;
+
 		bool IsDegreeSequence(const std::list<int>& rkSequence) const;
 
 		TopoDS_Vertex GetCoincidentVertex(const TopoDS_Vertex& rkVertex, const double kTolerance) const;
@@ -264,12 +468,265 @@ namespace TopologicCore
 		double ComputeCost(const TopoDS_Vertex& rkVertex1, const TopoDS_Vertex& rkVertex2, const std::string& rkVertexKey, const std::string& rkEdgeKey) const;
 		double ComputeVertexCost(const TopoDS_Vertex& rkVertex, const std::string& rkVertexKey) const;
 		double ComputeEdgeCost(const TopoDS_Vertex& rkVertex1, const TopoDS_Vertex& rkVertex2, const std::string& rkEdgeKey) const;
+		double ComputeEdgeCost(const int kEdgeId, const std::string& rkEdgeKey) const;
+
+		/// <summary>
+		/// Computes the cost of entering each Vertex, indexed by the Vertex IDs.
+		/// </summary>
+		void VertexCosts(const std::string& rkVertexKey, std::vector<double>& rVertexCosts) const;
+
+		/// <summary>
+		/// Computes the cost of traversing each Edge, indexed by the Edge IDs.
+		/// </summary>
+		void EdgeCosts(const std::string& rkEdgeKey, std::vector<double>& rEdgeCosts) const;
 
 		TopoDS_Edge FindEdge(const TopoDS_Vertex& rkVertex1, const TopoDS_Vertex& rkVertex2, const double kTolerance = 0.0001) const;
 		static bool IsCoincident(const TopoDS_Vertex& rkVertex1, const TopoDS_Vertex& rkVertex2, const double kTolerance = 0.0001);
 
-		GraphMap m_graphDictionary;
-		TopTools_MapOfShape m_occtEdges;
+		/// <summary>
+		/// Returns the ID of a Vertex of the Graph which is the same as or coincident with an OCCT vertex.
+		/// </summary>
+		/// <returns name="int">The Vertex ID, or -1 if there is no such Vertex</returns>
+		int FindVertexId(const TopoDS_Vertex& rkOcctVertex, const double kTolerance) const;
+
+		/// <summary>
+		/// Returns the ID of the Vertex of the Graph which is coincident with a point. If there are several, the lowest
+		/// ID is returned.
+		/// </summary>
+		/// <returns name="int">The Vertex ID, or -1 if there is no such Vertex</returns>
+		int FindCoincidentVertexId(const gp_Pnt& rkOcctPoint, const double kTolerance) const;
+
+		/// <summary>
+		/// Finds the Vertices of the Graph which are closer to a point than a tolerance.
+		/// </summary>
+		/// <param name="rVertexIds">The IDs of the Vertices, in ascending order</param>
+		void FindCoincidentVertexIds(const gp_Pnt& rkOcctPoint, const double kTolerance, std::vector<int>& rVertexIds) const;
+
+		/// <summary>
+		/// Sets the size of the cells of m_vertexGrid and rebuilds it.
+		/// </summary>
+		void SetVertexGridCellSize(const double kCellSize);
+
+		/// <summary>
+		/// Returns the key of a cell of m_vertexGrid.
+		/// </summary>
+		static std::uint64_t VertexGridKey(const long long kX, const long long kY, const long long kZ);
+
+		/// <summary>
+		/// Returns the ID of the Edge connecting two Vertices.
+		/// </summary>
+		/// <returns name="int">The Edge ID, or -1 if the Vertices are not adjacent</returns>
+		int FindEdgeId(const int kVertexId1, const int kVertexId2) const;
+
+		/// <summary>
+		/// Returns the key of an unordered pair of Vertices in m_edgeIds.
+		/// </summary>
+		static std::uint64_t VertexPairKey(const int kVertexId1, const int kVertexId2);
+
+		int AddVertex(const TopoDS_Vertex& rkOcctVertex);
+
+		int AddEdge(const int kVertexId1, const int kVertexId2, const TopoDS_Edge& rkOcctEdge);
+
+		/// <summary>
+		/// Removes Vertices, with their incident Edges, and Edges, then renumbers the remaining ones.
+		/// </summary>
+		void RemoveIds(const std::vector<bool>& rkIsVertexRemoved, const std::vector<bool>& rkIsEdgeRemoved);
+
+		int VertexDegree(const int kVertexId) const;
+
+		/// <summary>
+		/// Counts the Edges between a Vertex and the others by Breadth-First Search.
+		/// </summary>
+		/// <param name="kStartVertexId">The ID of the start Vertex</param>
+		/// <param name="kEndVertexId">The ID of a Vertex at which the search stops, or -1 to reach all the Vertices</param>
+		/// <param name="rDistances">The distances, indexed by the Vertex IDs, -1 for the unreached Vertices</param>
+		void TopologicalDistances(const int kStartVertexId, const int kEndVertexId, std::vector<int>& rDistances) const;
+
+		/// <summary>
+		/// Computes the costs of the shortest paths from a Vertex by Dijkstra's algorithm. The cost of a step is the
+		/// cost of the Edge plus the cost of the Vertex which it enters. With an end Vertex and a heuristic scale, the
+		/// search is A*, which orders the Vertices by their costs plus their straight-line distances to the end Vertex
+		/// times the scale, so that the costs are only final for the Vertices on the way to the end Vertex.
+		/// </summary>
+		/// <param name="kStartVertexId">The ID of the start Vertex</param>
+		/// <param name="kEndVertexId">The ID of a Vertex at which the search stops, or -1 to reach all the Vertices</param>
+		/// <param name="rkVertexCosts">The costs of the Vertices, indexed by their IDs</param>
+		/// <param name="rkEdgeCosts">The costs of the Edges, indexed by their IDs</param>
+		/// <param name="rDistances">The costs, indexed by the Vertex IDs, the largest double for the unreached Vertices</param>
+		/// <param name="rParentVertexIds">The previous Vertex on the shortest path to each Vertex, -1 if there is none</param>
+		/// <param name="kHeuristicScale">The scale of the A* heuristic from HeuristicScale(), or 0 for Dijkstra's algorithm</param>
+		void ShortestDistances(
+			const int kStartVertexId,
+			const int kEndVertexId,
+			const std::vector<double>& rkVertexCosts,
+			const std::vector<double>& rkEdgeCosts,
+			std::vector<double>& rDistances,
+			std::vector<int>& rParentVertexIds,
+			const double kHeuristicScale = 0.0) const;
+
+		/// <summary>
+		/// Returns the largest scale of the straight-line distances which does not exceed the cost of any path, i.e.
+		/// the smallest ratio of the cost of an Edge to the distance between its Vertices. It makes the A* heuristic
+		/// of ShortestDistances() consistent.
+		/// </summary>
+		/// <param name="rkVertexCosts">The costs of the Vertices, indexed by their IDs</param>
+		/// <param name="rkEdgeCosts">The costs of the Edges, indexed by their IDs</param>
+		/// <returns name="double">The scale, 0 if a cost is negative</returns>
+		double HeuristicScale(const std::vector<double>& rkVertexCosts, const std::vector<double>& rkEdgeCosts) const;
+
+		/// <summary>
+		/// Finds the cheapest paths without repeated Vertices between two Vertices by Yen's algorithm. Each spur path
+		/// is found by ShortestDistances() with the Edges which must be avoided made untraversable.
+		/// </summary>
+		/// <param name="kStartVertexId">The ID of the start Vertex</param>
+		/// <param name="kEndVertexId">The ID of the end Vertex</param>
+		/// <param name="rkVertexCosts">The costs of the Vertices, indexed by their IDs</param>
+		/// <param name="rkEdgeCosts">The costs of the Edges, indexed by their IDs</param>
+		/// <param name="kMaxNumberOfPaths">The largest number of paths</param>
+		/// <param name="kMaxCost">The largest cost of a path, or a negative value for no limit</param>
+		/// <param name="kUseTimeLimit">If True, the search stops after the time limit</param>
+		/// <param name="kTimeLimitInSeconds">The time limit in seconds</param>
+		/// <param name="rPathVertexIds">The IDs of the Vertices of the paths, by increasing cost. The found paths replace
+		/// the content.</param>
+		/// <param name="rPathCosts">The costs of the paths</param>
+		void YenShortestPaths(
+			const int kStartVertexId,
+			const int kEndVertexId,
+			const std::vector<double>& rkVertexCosts,
+			const std::vector<double>& rkEdgeCosts,
+			const int kMaxNumberOfPaths,
+			const double kMaxCost,
+			const bool kUseTimeLimit,
+			const int kTimeLimitInSeconds,
+			std::vector<std::vector<int>>& rPathVertexIds,
+			std::vector<double>& rPathCosts) const;
+
+		/// <summary>
+		/// Receives the Vertex which a batch of Breadth-First Searches reaches at a distance. Bit i of kSourceBits
+		/// stands for the search from the source kFirstSourceIndex + i.
+		/// </summary>
+		typedef std::function<void(const int kFirstSourceIndex, const int kVertexId, const std::uint64_t kSourceBits, const int kDistance)> BreadthFirstSearchVisitor;
+
+		/// <summary>
+		/// Runs a Breadth-First Search from each source. The searches run in batches of 64 which share their frontiers,
+		/// one bit per search, and the batches run in parallel if ExecutionPolicy allows it. The visitor is called once
+		/// per Vertex and distance in each batch, so it may be called concurrently for different batches.
+		/// </summary>
+		/// <param name="rkSourceVertexIds">The IDs of the source Vertices</param>
+		/// <param name="rkVisitor">Receives the reached Vertices, including the sources at distance 0</param>
+		void MultiSourceBreadthFirstSearch(const std::vector<int>& rkSourceVertexIds, const BreadthFirstSearchVisitor& rkVisitor) const;
+
+		/// <summary>
+		/// Computes the eccentricities of some Vertices.
+		/// </summary>
+		/// <param name="rkSourceVertexIds">The IDs of the Vertices</param>
+		/// <param name="rEccentricities">The eccentricities, in the order of the IDs, the largest int if a Vertex does not reach all the others</param>
+		void ComputeEccentricities(const std::vector<int>& rkSourceVertexIds, std::vector<int>& rEccentricities) const;
+
+		/// <summary>
+		/// Returns the IDs of the source Vertices of a matrix, all the IDs if the list is empty. Throws if a Vertex
+		/// is not in the Graph.
+		/// </summary>
+		void SourceVertexIds(const std::list<Vertex::Ptr>& rkSourceVertices, std::vector<int>& rSourceVertexIds) const;
+
+		/// <summary>
+		/// Runs the search from a source in Brandes' algorithm and computes the dependencies of the source on the
+		/// Vertices which it reaches, i.e. the sums of the fractions of its shortest paths to the other Vertices which
+		/// pass through them.
+		/// </summary>
+		/// <param name="kSourceVertexId">The ID of the source Vertex</param>
+		/// <param name="rkVertexCosts">The costs of the Vertices, indexed by their IDs</param>
+		/// <param name="rkEdgeCosts">The costs of the Edges, indexed by their IDs</param>
+		/// <param name="kIsWeighted">False if all the Vertex costs are 0 and all the Edge costs are 1, in which case
+		/// Breadth-First Search is used instead of Dijkstra's algorithm</param>
+		/// <param name="rReachedVertexIds">The IDs of the reached Vertices by increasing cost, starting with the source</param>
+		/// <param name="rDependencies">The dependencies, indexed by the Vertex IDs</param>
+		void ComputeDependencies(
+			const int kSourceVertexId,
+			const std::vector<double>& rkVertexCosts,
+			const std::vector<double>& rkEdgeCosts,
+			const bool kIsWeighted,
+			std::vector<int>& rReachedVertexIds,
+			std::vector<double>& rDependencies) const;
+
+		/// <summary>
+		/// Stores a value in the dictionary of each Vertex.
+		/// </summary>
+		/// <param name="rkKey">The key of the values</param>
+		/// <param name="rkValues">The values, indexed by the Vertex IDs</param>
+		void SetVertexValues(const std::string& rkKey, const std::vector<double>& rkValues) const;
+
+		template <typename T>
+		void ComputeDistanceMatrix(
+			const std::list<Vertex::Ptr>& rkSourceVertices,
+			const std::string& rkVertexKey,
+			const std::string& rkEdgeKey,
+			std::vector<T>& rDistances) const;
+
+		/// <summary>
+		/// Returns the compressed sparse row form of the adjacency, building it if the Graph has changed.
+		/// </summary>
+		const CompactAdjacency& GetCompactAdjacency() const;
+
+		std::shared_ptr<Vertex> GetVertex(const int kVertexId) const;
+
+		std::shared_ptr<TopologicCore::Edge> GetEdge(const int kEdgeId) const;
+
+		/// <summary>
+		/// The OCCT vertices, indexed by their IDs
+		/// </summary>
+		std::vector<TopoDS_Vertex> m_occtVertices;
+
+		/// <summary>
+		/// The X, Y and Z coordinates of the vertices, indexed by three times their IDs
+		/// </summary>
+		std::vector<double> m_vertexCoordinates;
+
+		/// <summary>
+		/// The IDs of the OCCT vertices
+		/// </summary>
+		TopTools_DataMapOfShapeInteger m_occtVertexIds;
+
+		/// <summary>
+		/// The IDs of the adjacent vertices and of the connecting edges of each vertex, in the order of the edge IDs.
+		/// A self-loop is stored once.
+		/// </summary>
+		std::vector<std::vector<std::pair<int, int>>> m_adjacency;
+
+		/// <summary>
+		/// The OCCT edges, indexed by their IDs
+		/// </summary>
+		std::vector<TopoDS_Edge> m_occtEdges;
+
+		/// <summary>
+		/// The IDs of the vertices of each edge
+		/// </summary>
+		std::vector<std::pair<int, int>> m_edgeVertexIds;
+
+		/// <summary>
+		/// The length of each edge, which is its cost for the "distance" and "length" keys
+		/// </summary>
+		std::vector<double> m_edgeLengths;
+
+		/// <summary>
+		/// The IDs of the edges, by the keys of the unordered pairs of their vertex IDs
+		/// </summary>
+		std::unordered_map<std::uint64_t, int> m_edgeIds;
+
+		/// <summary>
+		/// A uniform grid over the vertex coordinates, from the keys of its cells to the IDs of the vertices in them
+		/// </summary>
+		std::unordered_map<std::uint64_t, std::vector<int>> m_vertexGrid;
+
+		/// <summary>
+		/// The size of the cells of m_vertexGrid, at least the largest tolerance used to add vertices
+		/// </summary>
+		double m_vertexGridCellSize;
+
+		mutable CompactAdjacency m_compactAdjacency;
+		mutable bool m_isCompactAdjacencyValid;
+		mutable std::mutex m_compactAdjacencyMutex;
+
 		std::string m_guid;
 	};
-}
+}
\ No newline at end of file
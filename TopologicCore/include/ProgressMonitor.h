@@ -0,0 +1,161 @@
+// This file is part of Topologic software library.
+// Copyright(C) 2019, Cardiff University and University College London
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "Utilities.h"
+
+#include <Message_ProgressIndicator.hxx>
+#include <Message_ProgressRange.hxx>
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace TopologicCore
+{
+	/// <summary>
+	/// A ProgressMonitor reports the progress of long operations (Boolean operations, SelfMerge, CellComplex::ByFaces
+	/// and Graph::ByTopology) and stops them when it is cancelled or when its time limit is reached. Pass it to an
+	/// operation in BooleanOptions, or as an argument of Graph::ByTopology. A stopped operation throws a
+	/// std::runtime_error.
+	/// </summary>
+	class ProgressMonitor
+	{
+	public:
+		typedef std::shared_ptr<ProgressMonitor> Ptr;
+
+		/// <summary>
+		/// Receives the name of the current stage and its progress in percent.
+		/// </summary>
+		typedef std::function<void(const std::string& rkStage, const double kPercent)> Callback;
+
+	public:
+		TOPOLOGIC_API ProgressMonitor();
+
+		TOPOLOGIC_API virtual ~ProgressMonitor();
+
+		/// <summary>
+		/// Sets the function which receives the progress. It is only called from the thread which runs the operation,
+		/// not from the worker threads of the OCCT algorithms.
+		/// </summary>
+		/// <param name="rkCallback">The function, can be empty</param>
+		TOPOLOGIC_API void SetCallback(const Callback& rkCallback);
+
+		/// <summary>
+		/// Sets a time limit, measured from now. The running operation stops when it is reached.
+		/// </summary>
+		/// <param name="kSeconds">The time limit in seconds. A non-positive value removes the limit.</param>
+		TOPOLOGIC_API void SetTimeLimit(const double kSeconds);
+
+		/// <summary>
+		/// Requests the running operation to stop. Can be called from any thread, e.g. from the callback.
+		/// </summary>
+		TOPOLOGIC_API void Cancel();
+
+		/// <summary>
+		/// Clears the cancellation so that the monitor can be used again. The time limit is kept.
+		/// </summary>
+		TOPOLOGIC_API void Reset();
+
+		/// <summary>
+		/// Checks if the monitor is cancelled or its time limit is reached.
+		/// </summary>
+		/// <returns name="bool">True if the running operation must stop, otherwise False</returns>
+		TOPOLOGIC_API bool IsCancelled() const;
+
+		/// <summary>
+		/// Starts a stage which is run by an OCCT algorithm. The returned range is passed to the Perform method of the
+		/// algorithm, which reports its progress and polls the cancellation through it.
+		/// </summary>
+		/// <param name="rkStage">The name of the stage</param>
+		/// <returns name="Message_ProgressRange">The progress range of the OCCT algorithm</returns>
+		TOPOLOGIC_API Message_ProgressRange Start(const std::string& rkStage);
+
+		/// <summary>
+		/// Reports the progress of a stage which is run by Topologic itself.
+		/// </summary>
+		/// <param name="rkStage">The name of the stage</param>
+		/// <param name="kPercent">The progress of the stage, from 0 to 100</param>
+		TOPOLOGIC_API void Report(const std::string& rkStage, const double kPercent);
+
+		/// <summary>
+		/// Throws a std::runtime_error if the monitor is cancelled or its time limit is reached.
+		/// </summary>
+		TOPOLOGIC_API void Check() const;
+
+		/// <summary>
+		/// Starts a stage on an optional monitor.
+		/// </summary>
+		/// <param name="kpProgressMonitor">The monitor, can be null</param>
+		/// <param name="rkStage">The name of the stage</param>
+		/// <returns name="Message_ProgressRange">The progress range of the OCCT algorithm, empty if there is no monitor</returns>
+		TOPOLOGIC_API static Message_ProgressRange Start(const ProgressMonitor::Ptr& kpProgressMonitor, const std::string& rkStage);
+
+		/// <summary>
+		/// Checks an optional monitor.
+		/// </summary>
+		/// <param name="kpProgressMonitor">The monitor, can be null</param>
+		TOPOLOGIC_API static void Check(const ProgressMonitor::Ptr& kpProgressMonitor);
+
+	protected:
+		friend class OcctProgressIndicator;
+
+		/// <summary>
+		/// Calls the callback if the current thread runs the operation.
+		/// </summary>
+		void Notify(const std::string& rkStage, const double kPercent);
+
+		/// <summary>
+		/// The OCCT indicator which forwards the progress of the OCCT algorithms to this monitor
+		/// </summary>
+		Handle(Message_ProgressIndicator) m_pOcctProgressIndicator;
+
+		/// <summary>
+		/// The function which receives the progress
+		/// </summary>
+		Callback m_callback;
+
+		/// <summary>
+		/// The name of the current stage
+		/// </summary>
+		std::string m_stage;
+
+		/// <summary>
+		/// The thread which runs the operation, i.e. the one which started the current stage
+		/// </summary>
+		std::thread::id m_operationThreadId;
+
+		/// <summary>
+		/// Guards the callback, the stage and the operation thread, which are read by the OCCT worker threads
+		/// </summary>
+		std::mutex m_mutex;
+
+		/// <summary>
+		/// Whether the monitor is cancelled
+		/// </summary>
+		std::atomic<bool> m_isCancelled;
+
+		/// <summary>
+		/// The deadline in ticks of std::chrono::steady_clock, 0 if there is no time limit
+		/// </summary>
+		std::atomic<std::chrono::steady_clock::rep> m_deadlineTicks;
+	};
+}
@@ -57,6 +57,13 @@ namespace TopologicCore
 
 		TOPOLOGIC_API virtual ~Shell();
 
+		// The vector overloads of the navigation methods below are inherited from Topology.
+		using Topology::Edges;
+		using Topology::Faces;
+		using Topology::Vertices;
+		using Topology::Wires;
+		using Topology::Cells;
+
 		/// <summary>
 		/// 
 		/// </summary>
@@ -17,6 +17,7 @@
 #pragma once
 
 #include "Utilities.h"
+#include "BooleanOptions.h"
 #include "TopologicalQuery.h"
 #include "Dictionary.h"
 
@@ -28,6 +29,7 @@
 #include <BRepAlgoAPI_BooleanOperation.hxx>
 #include <BRepBuilderAPI_MakeShape.hxx>
 #include <BRepAlgoAPI_Check.hxx>
+#include <BRepTools_History.hxx>
 #include <Standard_Handle.hxx>
 #include <Geom_Geometry.hxx>
 #include <TopoDS_Edge.hxx>
@@ -37,6 +39,7 @@
 #include <TopExp.hxx>
 #include <TopExp_Explorer.hxx>
 #include <TopTools_IndexedDataMapOfShapeListOfShape.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
 #include <TopTools_MapOfShape.hxx>
 #include <TopTools_FormatVersion.hxx>
 
@@ -63,12 +66,17 @@ namespace TopologicCore
 	class Context;
 	class Aperture;
 	class TopologyFactory;
+	class TopologyIndex;
+	class BooleanSession;
+	class BooleanHistory;
 
 	/// <summary>
 	/// A Topology is an abstract superclass that constructors, properties and methods used by other subclasses that extend it.
 	/// </summary>
 	class Topology : public TopologicalQuery, public std::enable_shared_from_this<Topology>
 	{
+		friend class BooleanSession;
+
 	public:
 		typedef std::shared_ptr<Topology> Ptr;
 
@@ -187,6 +195,24 @@ namespace TopologicCore
 		/// <param name="rSharedTopologies"></param>
 		TOPOLOGIC_API void SharedTopologies(const Topology::Ptr& kpTopology, const int kFilterType, std::list<Topology::Ptr>& rSharedTopologies) const;
 
+		/// <summary>
+		/// Returns the shared Topologies between every pair of the input Topologies which share any, in one pass.
+		/// Each member is visited once per input Topology, instead of once per pair.
+		/// </summary>
+		/// <param name="rkTopologies">A list of Topologies</param>
+		/// <param name="kFilterType">The types of the shared Topologies</param>
+		/// <param name="rSharedTopologies">The shared Topologies, keyed by the pairs (i, j), i &lt; j, of indices in the input list</param>
+		static TOPOLOGIC_API void PairwiseSharedTopologies(const std::list<Topology::Ptr>& rkTopologies, const int kFilterType, std::map<std::pair<int, int>, std::list<Topology::Ptr>>& rSharedTopologies);
+
+		/// <summary>
+		/// Returns the members of a type shared by two OCCT shapes. The members of the second shape are hashed, so this is linear in the number of members.
+		/// </summary>
+		/// <param name="rkOcctShape1">An OCCT shape</param>
+		/// <param name="rkOcctShape2">Another OCCT shape</param>
+		/// <param name="rkShapeEnum">The type of the members</param>
+		/// <param name="rOcctSharedMembers">The shared members</param>
+		static TOPOLOGIC_API void SharedMembers(const TopoDS_Shape& rkOcctShape1, const TopoDS_Shape& rkOcctShape2, const TopAbs_ShapeEnum& rkShapeEnum, TopTools_ListOfShape& rOcctSharedMembers);
+
 		/// <summary>
 		/// 
 		/// </summary>
@@ -229,78 +255,133 @@ namespace TopologicCore
 		/// </summary>
 		/// <param name="kpOtherTopology"></param>
 		/// <param name="kTransferDictionary"></param>
+		/// <param name="rkOptions"></param>
+		/// <param name="kpHistory">If not null, filled with the history of the operation</param>
 		/// <returns></returns>
-		TOPOLOGIC_API Topology::Ptr Difference(const Topology::Ptr& kpOtherTopology = nullptr, const bool kTransferDictionary = false);
+		TOPOLOGIC_API Topology::Ptr Difference(const Topology::Ptr& kpOtherTopology = nullptr, const bool kTransferDictionary = false, const BooleanOptions& rkOptions = BooleanOptions(), const std::shared_ptr<BooleanHistory>& kpHistory = nullptr);
 
 		/// <summary>
 		/// 
 		/// </summary>
 		/// <param name="kpTool"></param>
 		/// <param name="kTransferDictionary"></param>
+		/// <param name="rkOptions"></param>
+		/// <param name="kpHistory">If not null, filled with the history of the operation</param>
 		/// <returns></returns>
-		TOPOLOGIC_API Topology::Ptr Impose(const Topology::Ptr& kpTool = nullptr, const bool kTransferDictionary = false);
+		TOPOLOGIC_API Topology::Ptr Impose(const Topology::Ptr& kpTool = nullptr, const bool kTransferDictionary = false, const BooleanOptions& rkOptions = BooleanOptions(), const std::shared_ptr<BooleanHistory>& kpHistory = nullptr);
 
 		/// <summary>
 		/// 
 		/// </summary>
 		/// <param name="kpTool"></param>
 		/// <param name="kTransferDictionary"></param>
+		/// <param name="rkOptions"></param>
+		/// <param name="kpHistory">If not null, filled with the history of the operation</param>
 		/// <returns></returns>
-		TOPOLOGIC_API Topology::Ptr Imprint(const Topology::Ptr& kpTool = nullptr, const bool kTransferDictionary = false);
+		TOPOLOGIC_API Topology::Ptr Imprint(const Topology::Ptr& kpTool = nullptr, const bool kTransferDictionary = false, const BooleanOptions& rkOptions = BooleanOptions(), const std::shared_ptr<BooleanHistory>& kpHistory = nullptr);
 		
 		/// <summary>
 		/// 
 		/// </summary>
 		/// <param name="kpOtherTopology"></param>
 		/// <param name="kTransferDictionary"></param>
+		/// <param name="rkOptions"></param>
+		/// <param name="kpHistory">If not null, filled with the history of the operation</param>
 		/// <returns></returns>
-		TOPOLOGIC_API Topology::Ptr Intersect(const Topology::Ptr& kpOtherTopology = nullptr, const bool kTransferDictionary = false);
+		TOPOLOGIC_API Topology::Ptr Intersect(const Topology::Ptr& kpOtherTopology = nullptr, const bool kTransferDictionary = false, const BooleanOptions& rkOptions = BooleanOptions(), const std::shared_ptr<BooleanHistory>& kpHistory = nullptr);
 
 		/// <summary>
 		/// 
 		/// </summary>
 		/// <param name="kpOtherTopology"></param>
 		/// <param name="kTransferDictionary"></param>
+		/// <param name="rkOptions"></param>
+		/// <param name="kpHistory">If not null, filled with the history of the operation</param>
 		/// <returns></returns>
-		TOPOLOGIC_API Topology::Ptr Merge(const Topology::Ptr& kpOtherTopology = nullptr, const bool kTransferDictionary = false);
+		TOPOLOGIC_API Topology::Ptr Merge(const Topology::Ptr& kpOtherTopology = nullptr, const bool kTransferDictionary = false, const BooleanOptions& rkOptions = BooleanOptions(), const std::shared_ptr<BooleanHistory>& kpHistory = nullptr);
 
 		/// <summary>
 		/// 
 		/// </summary>
+		/// <param name="rkOptions"></param>
 		/// <returns></returns>
-		TOPOLOGIC_API Topology::Ptr SelfMerge();
+		TOPOLOGIC_API Topology::Ptr SelfMerge(const BooleanOptions& rkOptions = BooleanOptions());
 
 		/// <summary>
 		/// 
 		/// </summary>
 		/// <param name="kpTool"></param>
 		/// <param name="kTransferDictionary"></param>
+		/// <param name="rkOptions"></param>
+		/// <param name="kpHistory">If not null, filled with the history of the operation</param>
 		/// <returns></returns>
-		TOPOLOGIC_API Topology::Ptr Slice(const Topology::Ptr& kpTool = nullptr, const bool kTransferDictionary = false);
+		TOPOLOGIC_API Topology::Ptr Slice(const Topology::Ptr& kpTool = nullptr, const bool kTransferDictionary = false, const BooleanOptions& rkOptions = BooleanOptions(), const std::shared_ptr<BooleanHistory>& kpHistory = nullptr);
 
 		/// <summary>
 		/// 
 		/// </summary>
 		/// <param name="kpOtherTopology"></param>
 		/// <param name="kTransferDictionary"></param>
+		/// <param name="rkOptions"></param>
+		/// <param name="kpHistory">If not null, filled with the history of the operation</param>
 		/// <returns></returns>
-		TOPOLOGIC_API Topology::Ptr Union(const Topology::Ptr& kpOtherTopology = nullptr, const bool kTransferDictionary = false);
+		TOPOLOGIC_API Topology::Ptr Union(const Topology::Ptr& kpOtherTopology = nullptr, const bool kTransferDictionary = false, const BooleanOptions& rkOptions = BooleanOptions(), const std::shared_ptr<BooleanHistory>& kpHistory = nullptr);
 
 		/// <summary>
 		/// 
 		/// </summary>
 		/// <param name="kpOtherTopology"></param>
 		/// <param name="kTransferDictionary"></param>
+		/// <param name="rkOptions"></param>
+		/// <param name="kpHistory">If not null, filled with the history of the operation</param>
 		/// <returns></returns>
-		TOPOLOGIC_API Topology::Ptr XOR(const Topology::Ptr& kpOtherTopology = nullptr, const bool kTransferDictionary = false);
+		TOPOLOGIC_API Topology::Ptr XOR(const Topology::Ptr& kpOtherTopology = nullptr, const bool kTransferDictionary = false, const BooleanOptions& rkOptions = BooleanOptions(), const std::shared_ptr<BooleanHistory>& kpHistory = nullptr);
 
 		/// <summary>
 		/// 
 		/// </summary>
 		/// <param name="kpTool"></param>
 		/// <param name="kTransferDictionary"></param>
+		/// <param name="rkOptions"></param>
 		/// <returns></returns>
-		TOPOLOGIC_API Topology::Ptr Divide(const Topology::Ptr& kpTool = nullptr, const bool kTransferDictionary = false);
+		TOPOLOGIC_API Topology::Ptr Divide(const Topology::Ptr& kpTool = nullptr, const bool kTransferDictionary = false, const BooleanOptions& rkOptions = BooleanOptions());
+
+		/// <summary>
+		/// Merges several Topologies in a single Boolean operation. All parts of all Topologies are kept.
+		/// </summary>
+		/// <param name="rkTopologies">A list of Topologies</param>
+		/// <param name="kTransferDictionary">If True, transfer the dictionaries of the Topologies to the result</param>
+		/// <param name="rkOptions">The options of the OCCT Boolean algorithms</param>
+		/// <returns name="Topology">The merged Topology</returns>
+		TOPOLOGIC_API static Topology::Ptr MergeMany(const std::list<Topology::Ptr>& rkTopologies, const bool kTransferDictionary = false, const BooleanOptions& rkOptions = BooleanOptions());
+
+		/// <summary>
+		/// Unions several Topologies in a single Boolean operation. The internal boundaries between the parts are removed.
+		/// </summary>
+		/// <param name="rkTopologies">A list of Topologies</param>
+		/// <param name="kTransferDictionary">If True, transfer the dictionaries of the Topologies to the result</param>
+		/// <param name="rkOptions">The options of the OCCT Boolean algorithms</param>
+		/// <returns name="Topology">The union of the Topologies</returns>
+		TOPOLOGIC_API static Topology::Ptr UnionMany(const std::list<Topology::Ptr>& rkTopologies, const bool kTransferDictionary = false, const BooleanOptions& rkOptions = BooleanOptions());
+
+		/// <summary>
+		/// Imposes several Topologies in a single Boolean operation. Each Topology is imposed on the ones before it in the list,
+		/// as if Impose were called successively.
+		/// </summary>
+		/// <param name="rkTopologies">A list of Topologies. The first one is the host.</param>
+		/// <param name="kTransferDictionary">If True, transfer the dictionaries of the Topologies to the result</param>
+		/// <param name="rkOptions">The options of the OCCT Boolean algorithms</param>
+		/// <returns name="Topology">The imposed Topology</returns>
+		TOPOLOGIC_API static Topology::Ptr ImposeMany(const std::list<Topology::Ptr>& rkTopologies, const bool kTransferDictionary = false, const BooleanOptions& rkOptions = BooleanOptions());
+
+		/// <summary>
+		/// Slices the first Topology by all other Topologies in a single Boolean operation.
+		/// </summary>
+		/// <param name="rkTopologies">A list of Topologies. The first one is sliced, the others are the tools.</param>
+		/// <param name="kTransferDictionary">If True, transfer the dictionaries of the Topologies to the result</param>
+		/// <param name="rkOptions">The options of the OCCT Boolean algorithms</param>
+		/// <returns name="Topology">The sliced Topology</returns>
+		TOPOLOGIC_API static Topology::Ptr SliceMany(const std::list<Topology::Ptr>& rkTopologies, const bool kTransferDictionary = false, const BooleanOptions& rkOptions = BooleanOptions());
 
 		/// <summary>
 		/// 
@@ -400,6 +481,21 @@ namespace TopologicCore
 		/// <returns></returns>
 		TOPOLOGIC_API std::string Analyze();
 
+		/// <summary>
+		/// Checks if the Topology is valid with BRepCheck_Analyzer.
+		/// </summary>
+		/// <returns name="bool">True if the Topology is valid, otherwise False</returns>
+		TOPOLOGIC_API bool IsValid() const;
+
+		/// <summary>
+		/// Checks several Topologies with a single BRepCheck_Analyzer, e.g. once at the end of a script which runs in
+		/// the trusted-input mode of ExecutionPolicy instead of fixing every created Topology.
+		/// </summary>
+		/// <param name="rkTopologies">The Topologies</param>
+		/// <param name="rInvalidTopologies">The Vertices, Edges, Wires, Faces, Shells and Cells which are invalid or have invalid parts</param>
+		/// <returns name="bool">True if all Topologies are valid, otherwise False</returns>
+		TOPOLOGIC_API static bool Validate(const std::list<Topology::Ptr>& rkTopologies, std::list<Topology::Ptr>& rInvalidTopologies);
+
 		/// <summary>
 		/// 
 		/// </summary>
@@ -482,6 +578,48 @@ namespace TopologicCore
 		/// <param name="rCellComplexes"></param>
 		TOPOLOGIC_API void CellComplexes(const Topology::Ptr& kpHostTopology, std::list<std::shared_ptr<CellComplex>>& rCellComplexes) const;
 
+		/// <summary>
+		/// Same as the list overload, but stores the result contiguously.
+		/// </summary>
+		/// <param name="rShells"></param>
+		TOPOLOGIC_API void Shells(const Topology::Ptr& kpHostTopology, std::vector<std::shared_ptr<Shell>>& rShells) const;
+
+		/// <summary>
+		/// Same as the list overload, but stores the result contiguously.
+		/// </summary>
+		/// <param name="rEdges"></param>
+		TOPOLOGIC_API void Edges(const Topology::Ptr& kpHostTopology, std::vector<std::shared_ptr<Edge>>& rEdges) const;
+
+		/// <summary>
+		/// Same as the list overload, but stores the result contiguously.
+		/// </summary>
+		/// <param name="rFaces"></param>
+		TOPOLOGIC_API void Faces(const Topology::Ptr& kpHostTopology, std::vector<std::shared_ptr<Face>>& rFaces) const;
+
+		/// <summary>
+		/// Same as the list overload, but stores the result contiguously.
+		/// </summary>
+		/// <param name="rVertices"></param>
+		TOPOLOGIC_API virtual void Vertices(const Topology::Ptr& kpHostTopology, std::vector<std::shared_ptr<Vertex>>& rVertices) const;
+
+		/// <summary>
+		/// Same as the list overload, but stores the result contiguously.
+		/// </summary>
+		/// <param name="rWires"></param>
+		TOPOLOGIC_API void Wires(const Topology::Ptr& kpHostTopology, std::vector<std::shared_ptr<Wire>>& rWires) const;
+
+		/// <summary>
+		/// Same as the list overload, but stores the result contiguously.
+		/// </summary>
+		/// <param name="rCells"></param>
+		TOPOLOGIC_API void Cells(const Topology::Ptr& kpHostTopology, std::vector<std::shared_ptr<Cell>>& rCells) const;
+
+		/// <summary>
+		/// Same as the list overload, but stores the result contiguously.
+		/// </summary>
+		/// <param name="rCellComplexes"></param>
+		TOPOLOGIC_API void CellComplexes(const Topology::Ptr& kpHostTopology, std::vector<std::shared_ptr<CellComplex>>& rCellComplexes) const;
+
 		/// <summary>
 		/// 
 		/// </summary>
@@ -490,6 +628,9 @@ namespace TopologicCore
 		template <class Subclass>
 		void Navigate(const Topology::Ptr& kpHostTopology, std::list<std::shared_ptr<Subclass>>& rMembers) const;
 
+		template <class Subclass>
+		void Navigate(const Topology::Ptr& kpHostTopology, std::vector<std::shared_ptr<Subclass>>& rMembers) const;
+
 		/// <summary>
 		/// 
 		/// </summary>
@@ -498,6 +639,9 @@ namespace TopologicCore
 		template <class Subclass>
 		void UpwardNavigation(const TopoDS_Shape& rkOcctHostTopology, std::list<std::shared_ptr<Subclass>>& rAncestors) const;
 
+		template <class Subclass>
+		void UpwardNavigation(const TopoDS_Shape& rkOcctHostTopology, std::vector<std::shared_ptr<Subclass>>& rAncestors) const;
+
 		void UpwardNavigation(const TopoDS_Shape& rkOcctHostTopology, const int kTopologyType, std::list<std::shared_ptr<Topology>>& rAncestors) const;
 
 		/// <summary>
@@ -507,6 +651,13 @@ namespace TopologicCore
 		template <class Subclass>
 		void DownwardNavigation(std::list<std::shared_ptr<Subclass>>& rMembers) const;
 
+		/// <summary>
+		/// Same as the list overload; the members are counted first so that the vector is allocated once.
+		/// </summary>
+		/// <param name="rMembers"></param>
+		template <class Subclass>
+		void DownwardNavigation(std::vector<std::shared_ptr<Subclass>>& rMembers) const;
+
 		/// <summary>
 		/// 
 		/// </summary>
@@ -549,6 +700,21 @@ namespace TopologicCore
 		/// <param name="rkOcctNewSubshape"></param>
 		TOPOLOGIC_API void ReplaceSubentity(const TopoDS_Shape& rkOcctOriginalSubshape, const TopoDS_Shape& rkOcctNewSubshape);
 
+		/// <summary>
+		/// Returns the modification stamp of the OCCT shape of the Topology, shared by every Topology wrapping the same shape.
+		/// A new stamp is assigned by Cluster::AddTopology/RemoveTopology, and carried over to the new shape when such a
+		/// Cluster is rebuilt by ReplaceSubentity. Other Topologies have the stamp 0.
+		/// </summary>
+		/// <returns name="unsigned long long">The modification stamp of the Topology</returns>
+		TOPOLOGIC_API unsigned long long GetModificationStamp() const;
+
+		/// <summary>
+		/// Returns the index of the members of the Topology, shared by every Topology wrapping the same OCCT shape, or nullptr
+		/// if it has none. An index is built by the first in-place edit of a Cluster, and then patched by the edits above.
+		/// </summary>
+		/// <returns name="TopologyIndex::Ptr">The index of the members of the Topology</returns>
+		TOPOLOGIC_API std::shared_ptr<TopologyIndex> Index() const;
+
 		/// <summary>
 		/// 
 		/// </summary>
@@ -715,6 +881,96 @@ namespace TopologicCore
 			TopTools_ListOfShape& rOcctCellsBuildersOperandsA,
 			TopTools_ListOfShape& rOcctCellsBuildersOperandsB);
 
+		/// <summary>
+		/// Appends the shapes of a list to another list. Unlike NCollection_List::Append(list), it does not empty the
+		/// first list.
+		/// </summary>
+		/// <param name="rkAList">The shapes to append</param>
+		/// <param name="rAnotherList">The list to which the shapes are appended</param>
+		static void AddOcctListShapeToAnotherList(const TopTools_ListOfShape& rkAList, TopTools_ListOfShape& rAnotherList);
+
+		/// <summary>
+		/// Moves the operands whose bounding boxes do not interact with the bounding box of any other operand from the
+		/// operand lists to the untouched lists. Does nothing if the prefilter is disabled in the options.
+		/// </summary>
+		/// <param name="kpOtherTopology">The other Topology</param>
+		/// <param name="kTestClusterOperands">If True, the operands of a Cluster are also tested against each other, as they may overlap</param>
+		/// <param name="rkOptions">The Boolean options</param>
+		/// <param name="rOcctOperandsA">The operands of this Topology; only the interacting ones are kept</param>
+		/// <param name="rOcctOperandsB">The operands of the other Topology; only the interacting ones are kept</param>
+		/// <param name="rOcctUntouchedOperandsA">The operands of this Topology which do not interact</param>
+		/// <param name="rOcctUntouchedOperandsB">The operands of the other Topology which do not interact</param>
+		void PartitionBooleanOperands(
+			const Topology::Ptr& kpOtherTopology,
+			const bool kTestClusterOperands,
+			const BooleanOptions& rkOptions,
+			TopTools_ListOfShape& rOcctOperandsA,
+			TopTools_ListOfShape& rOcctOperandsB,
+			TopTools_ListOfShape& rOcctUntouchedOperandsA,
+			TopTools_ListOfShape& rOcctUntouchedOperandsB) const;
+
+		/// <summary>
+		/// Adds untouched operands to the result shape of a Boolean operation, then groups the Cells, Faces and Edges
+		/// into CellComplexes, Shells and Wires by connexity as BOPAlgo_CellsBuilder::MakeContainers does.
+		/// </summary>
+		/// <param name="rkOcctResultShape">The result shape, can be null</param>
+		/// <param name="rkOcctUntouchedOperands">The untouched operands</param>
+		/// <returns name="TopoDS_Shape">The spliced result shape</returns>
+		static TopoDS_Shape SpliceBooleanResult(
+			const TopoDS_Shape& rkOcctResultShape,
+			const TopTools_ListOfShape& rkOcctUntouchedOperands);
+
+		/// <summary>
+		/// Splices the untouched operands, postprocesses the result shape of a binary Boolean operation, then transfers
+		/// the contents and the dictionaries. The dictionaries of the untouched operands are kept as they are.
+		/// </summary>
+		/// <param name="rOcctResultShape">The result shape</param>
+		/// <param name="rkOcctUntouchedOperands">The untouched operands</param>
+		/// <param name="kpOtherTopology">The other Topology</param>
+		/// <param name="kTransferContentsOfOther">If True, also transfer the contents of the other Topology</param>
+		/// <param name="kTransferDictionary">If True, transfer the dictionaries</param>
+		/// <param name="kpOcctHistory">The history of the OCCT algorithm, can be null</param>
+		/// <param name="kpHistory">If not null, filled with the history of the operation</param>
+		/// <returns name="Topology">The result</returns>
+		Topology::Ptr BinaryBooleanResult(
+			TopoDS_Shape& rOcctResultShape,
+			const TopTools_ListOfShape& rkOcctUntouchedOperands,
+			const Topology::Ptr& kpOtherTopology,
+			const bool kTransferContentsOfOther,
+			const bool kTransferDictionary,
+			const Handle(BRepTools_History)& kpOcctHistory,
+			const std::shared_ptr<BooleanHistory>& kpHistory);
+
+		/// <summary>
+		/// Runs the self-merge pipeline on the members of a Topology. Only uses OCCT, so it can be run on several sets of
+		/// members in parallel.
+		/// </summary>
+		/// <param name="rkOcctShapes">The members</param>
+		/// <param name="rkOptions">The Boolean options</param>
+		/// <param name="kRunParallel">If True, the OCCT algorithms follow the execution policy, otherwise they run serially</param>
+		/// <param name="rIsComplete">False if the pipeline stopped early, in which case no attributes are transferred</param>
+		/// <returns name="TopoDS_Shape">The merged shape</returns>
+		static TopoDS_Shape SelfMergeShapes(
+			const TopTools_ListOfShape& rkOcctShapes,
+			const BooleanOptions& rkOptions,
+			const bool kRunParallel,
+			bool& rIsComplete);
+
+		/// <summary>
+		/// Splits members into tiles which can be self-merged separately. The members whose bounding boxes interact,
+		/// directly or through other members, are put in the same tile; these groups are then assigned to the tiles by
+		/// a k-d split of their centres.
+		/// </summary>
+		/// <param name="rkOcctShapes">The members</param>
+		/// <param name="kNumberOfTiles">The maximum number of tiles</param>
+		/// <param name="rkOptions">The Boolean options</param>
+		/// <param name="rOcctTiles">The members of each tile</param>
+		static void SelfMergeTiles(
+			const TopTools_ListOfShape& rkOcctShapes,
+			const int kNumberOfTiles,
+			const BooleanOptions& rkOptions,
+			std::vector<TopTools_ListOfShape>& rOcctTiles);
+
 		/// <summary>
 		/// 
 		/// </summary>
@@ -741,7 +997,50 @@ namespace TopologicCore
 		static void NonRegularBooleanOperation(
 			const TopTools_ListOfShape& rkOcctArgumentsA,
 			const TopTools_ListOfShape& rkOcctArgumentsB,
-			BOPAlgo_CellsBuilder& rOcctCellsBuilder);
+			BOPAlgo_CellsBuilder& rOcctCellsBuilder,
+			const BooleanOptions& rkOptions = BooleanOptions());
+
+		/// <summary>
+		/// Splits several Topologies in a single CellsBuilder pass. The operands of each Topology (its sub-topologies
+		/// if it is a container) are returned in the same order as the Topologies.
+		/// </summary>
+		/// <param name="rkTopologies">A list of Topologies</param>
+		/// <param name="rOcctOperands">The operands of each Topology</param>
+		/// <param name="rOcctCellsBuilder">The CellsBuilder</param>
+		static void NonRegularBooleanOperation(
+			const std::list<Topology::Ptr>& rkTopologies,
+			std::vector<TopTools_ListOfShape>& rOcctOperands,
+			BOPAlgo_CellsBuilder& rOcctCellsBuilder,
+			const BooleanOptions& rkOptions);
+
+		/// <summary>
+		/// Builds the result of an n-ary Boolean operation from the parts added to the CellsBuilder, then transfers
+		/// the contents and the dictionaries once.
+		/// </summary>
+		/// <param name="rOcctCellsBuilder">The CellsBuilder</param>
+		/// <param name="rkContentOrigins">The Topologies whose contents are transferred</param>
+		/// <param name="rkDictionaryOrigins">The Topologies whose dictionaries are transferred</param>
+		/// <param name="kTransferDictionary">If True, transfer the dictionaries</param>
+		/// <returns name="Topology">The result</returns>
+		static Topology::Ptr NaryBooleanResult(
+			BOPAlgo_CellsBuilder& rOcctCellsBuilder,
+			const std::list<Topology::Ptr>& rkContentOrigins,
+			const std::list<Topology::Ptr>& rkDictionaryOrigins,
+			const bool kTransferDictionary);
+
+		/// <summary>
+		/// Postprocesses the result shape of a Boolean operation, then transfers the contents and the dictionaries once.
+		/// </summary>
+		/// <param name="rOcctResultShape">The result shape</param>
+		/// <param name="rkContentOrigins">The Topologies whose contents are transferred</param>
+		/// <param name="rkDictionaryOrigins">The Topologies whose dictionaries are transferred</param>
+		/// <param name="kTransferDictionary">If True, transfer the dictionaries</param>
+		/// <returns name="Topology">The result</returns>
+		static Topology::Ptr BooleanResult(
+			TopoDS_Shape& rOcctResultShape,
+			const std::list<Topology::Ptr>& rkContentOrigins,
+			const std::list<Topology::Ptr>& rkDictionaryOrigins,
+			const bool kTransferDictionary);
 
 		/// <summary>
 		/// 
@@ -752,14 +1051,15 @@ namespace TopologicCore
 		static void RegularBooleanOperation(
 			const TopTools_ListOfShape& rkOcctArgumentsA,
 			const TopTools_ListOfShape& rkOcctArgumentsB,
-			BRepAlgoAPI_BooleanOperation& rOcctBooleanOperation);
+			BRepAlgoAPI_BooleanOperation& rOcctBooleanOperation,
+			const BooleanOptions& rkOptions = BooleanOptions());
 
 		/// <summary>
 		/// 
 		/// </summary>
 		/// <param name="rOcctBooleanResult"></param>
 		/// <returns></returns>
-		TopoDS_Shape PostprocessBooleanResult(
+		static TopoDS_Shape PostprocessBooleanResult(
 			TopoDS_Shape& rOcctBooleanResult
 		);
 
@@ -782,14 +1082,14 @@ namespace TopologicCore
 		/// </summary>
 		/// <param name="rkOcctShape"></param>
 		/// <returns></returns>
-		TopoDS_Shape FixBooleanOperandCell(const TopoDS_Shape& rkOcctShape);
+		static TopoDS_Shape FixBooleanOperandCell(const TopoDS_Shape& rkOcctShape);
 
 		/// <summary>
 		/// 
 		/// </summary>
 		/// <param name="rkOcctShape"></param>
 		/// <returns></returns>
-		TopoDS_Shape FixBooleanOperandShell(const TopoDS_Shape& rkOcctShape);
+		static TopoDS_Shape FixBooleanOperandShell(const TopoDS_Shape& rkOcctShape);
 
 		/// <summary>
 		/// 
@@ -797,9 +1097,9 @@ namespace TopologicCore
 		/// <param name="rkOcctShape"></param>
 		/// <param name="rMapFaceToFixedFace"></param>
 		/// <returns></returns>
-		TopoDS_Shape FixBooleanOperandFace(const TopoDS_Shape& rkOcctShape, TopTools_DataMapOfShapeShape& rMapFaceToFixedFace);
+		static TopoDS_Shape FixBooleanOperandFace(const TopoDS_Shape& rkOcctShape, TopTools_DataMapOfShapeShape& rMapFaceToFixedFace);
 
-		TopoDS_Shape FixBooleanOperandFace(const TopoDS_Shape& rkOcctShape);
+		static TopoDS_Shape FixBooleanOperandFace(const TopoDS_Shape& rkOcctShape);
 
 		void GetDeletedBooleanSubtopologies(const TopoDS_Shape& rkOcctShape, BOPAlgo_CellsBuilder& rOcctCellsBuilder, TopTools_ListOfShape& rOcctDeletedShapes);
 
@@ -900,6 +1200,81 @@ namespace TopologicCore
 		}
 	}
 
+	template<class Subclass>
+	void Topology::Navigate(const Topology::Ptr& kpHostTopology, std::vector<std::shared_ptr<Subclass>>& rMembers) const
+	{
+		if (Subclass::Type() > GetType())
+		{
+			if (kpHostTopology)
+			{
+				UpwardNavigation(kpHostTopology->GetOcctShape(), rMembers);
+			}
+			else
+			{
+				throw std::runtime_error("Host Topology cannot be NULL when searching for ancestors.");
+			}
+		}
+		else if (Subclass::Type() < GetType())
+		{
+			DownwardNavigation(rMembers);
+		}
+		else
+		{
+			rMembers.push_back(TopologicalQuery::Downcast<Subclass>(ByOcctShape(GetOcctShape(), GetInstanceGUID())));
+		}
+	}
+
+	template<class Subclass>
+	inline void Topology::UpwardNavigation(const TopoDS_Shape& rkOcctHostTopology, std::vector<std::shared_ptr<Subclass>>& rAncestors) const
+	{
+		static_assert(std::is_base_of<Topology, Subclass>::value, "Subclass not derived from Topology");
+		TopAbs_ShapeEnum occtShapeType = CheckOcctShapeType<Subclass>();
+		if (rkOcctHostTopology.IsNull())
+		{
+			throw std::runtime_error("Host Topology cannot be NULL when searching for ancestors.");
+		}
+		TopTools_IndexedDataMapOfShapeListOfShape occtShapeMap;
+		TopExp::MapShapesAndUniqueAncestors(
+			rkOcctHostTopology,
+			GetOcctShape().ShapeType(),
+			occtShapeType,
+			occtShapeMap);
+
+		int occtShapeIndex = occtShapeMap.FindIndex(GetOcctShape());
+		if (occtShapeIndex == 0)
+		{
+			return;
+		}
+
+		// The ancestors are already unique.
+		const TopTools_ListOfShape& rkOcctAncestors = occtShapeMap.FindFromIndex(occtShapeIndex);
+		rAncestors.reserve(rAncestors.size() + rkOcctAncestors.Extent());
+		for (TopTools_ListIteratorOfListOfShape occtAncestorIterator(rkOcctAncestors);
+			occtAncestorIterator.More();
+			occtAncestorIterator.Next())
+		{
+			Topology::Ptr pTopology = ByOcctShape(occtAncestorIterator.Value(), "");
+			rAncestors.push_back(Downcast<Subclass>(pTopology));
+		}
+	}
+
+	template <class Subclass>
+	void Topology::DownwardNavigation(std::vector<std::shared_ptr<Subclass>>& rMembers) const
+	{
+		static_assert(std::is_base_of<Topology, Subclass>::value, "Subclass not derived from Topology");
+
+		TopAbs_ShapeEnum occtShapeType = CheckOcctShapeType<Subclass>();
+		TopTools_IndexedMapOfShape occtShapes;
+		TopExp::MapShapes(GetOcctShape(), occtShapeType, occtShapes);
+
+		rMembers.reserve(rMembers.size() + occtShapes.Extent());
+		for (int i = 1; i <= occtShapes.Extent(); ++i)
+		{
+			Topology::Ptr pChildTopology = ByOcctShape(occtShapes(i), "");
+			rMembers.push_back(Downcast<Subclass>(pChildTopology));
+		}
+	}
+
 	template <class Subclass>
 	//static TopAbs_ShapeEnum Topology::CheckOcctShapeType()
 	TopAbs_ShapeEnum Topology::CheckOcctShapeType()
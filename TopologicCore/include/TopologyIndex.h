@@ -0,0 +1,163 @@
+// This file is part of Topologic software library.
+// Copyright(C) 2019, Cardiff University and University College London
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "Utilities.h"
+
+#include <TopoDS_Shape.hxx>
+#include <TopTools_DataMapOfShapeListOfShape.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
+#include <TopTools_ListOfShape.hxx>
+#include <TopTools_MapOfShape.hxx>
+
+#include <memory>
+
+namespace TopologicCore
+{
+	/// <summary>
+	/// A TopologyIndex stores the members of an OCCT shape by type, and the parents of each member. It is patched
+	/// when the shape is edited, so that only the incidences of the affected members are recomputed.
+	/// </summary>
+	class TopologyIndex
+	{
+	public:
+		typedef std::shared_ptr<TopologyIndex> Ptr;
+
+	public:
+		TOPOLOGIC_API TopologyIndex(const TopoDS_Shape& rkOcctShape);
+
+		TOPOLOGIC_API virtual ~TopologyIndex();
+
+		/// <summary>
+		/// Returns the indexed OCCT shape.
+		/// </summary>
+		/// <returns name="TopoDS_Shape">The indexed OCCT shape</returns>
+		TOPOLOGIC_API const TopoDS_Shape& GetOcctShape() const { return m_occtShape; }
+
+		/// <summary>
+		/// Returns the modification stamp of the index. It changes every time the index is patched.
+		/// </summary>
+		/// <returns name="unsigned long long">The modification stamp of the index</returns>
+		TOPOLOGIC_API unsigned long long GetModificationStamp() const { return m_modificationStamp; }
+
+		/// <summary>
+		/// Returns True if the OCCT shape is a member of the indexed shape (or the indexed shape itself), otherwise False.
+		/// </summary>
+		/// <param name="rkOcctShape">An OCCT shape</param>
+		/// <returns name="bool">True if the OCCT shape is indexed, otherwise False</returns>
+		TOPOLOGIC_API bool Contains(const TopoDS_Shape& rkOcctShape) const;
+
+		/// <summary>
+		/// Returns the number of members of a type.
+		/// </summary>
+		/// <param name="kOcctShapeType">The type of the members</param>
+		/// <returns name="int">The number of members of the type</returns>
+		TOPOLOGIC_API int NumberOfMembers(const TopAbs_ShapeEnum kOcctShapeType) const;
+
+		/// <summary>
+		/// Returns the members of a type, in the order they were indexed.
+		/// </summary>
+		/// <param name="kOcctShapeType">The type of the members</param>
+		/// <param name="rOcctMembers">The members of the type</param>
+		TOPOLOGIC_API void Members(const TopAbs_ShapeEnum kOcctShapeType, TopTools_ListOfShape& rOcctMembers) const;
+
+		/// <summary>
+		/// Returns the direct parents of a member.
+		/// </summary>
+		/// <param name="rkOcctShape">A member</param>
+		/// <param name="rOcctParents">The direct parents of the member</param>
+		TOPOLOGIC_API void Parents(const TopoDS_Shape& rkOcctShape, TopTools_ListOfShape& rOcctParents) const;
+
+		/// <summary>
+		/// Returns the ancestors of a type of a member, by walking up from the member.
+		/// </summary>
+		/// <param name="rkOcctShape">A member</param>
+		/// <param name="kOcctAncestorType">The type of the ancestors</param>
+		/// <param name="rOcctAncestors">The ancestors of the member</param>
+		TOPOLOGIC_API void Ancestors(const TopoDS_Shape& rkOcctShape, const TopAbs_ShapeEnum kOcctAncestorType, TopTools_ListOfShape& rOcctAncestors) const;
+
+		/// <summary>
+		/// Patches the index after a member has been added in place to a parent (e.g. by BRep_Builder::Add).
+		/// </summary>
+		/// <param name="rkOcctParent">The parent</param>
+		/// <param name="rkOcctMember">The added member</param>
+		TOPOLOGIC_API void AddMember(const TopoDS_Shape& rkOcctParent, const TopoDS_Shape& rkOcctMember);
+
+		/// <summary>
+		/// Patches the index after a member has been removed in place from a parent (e.g. by BRep_Builder::Remove).
+		/// </summary>
+		/// <param name="rkOcctParent">The parent</param>
+		/// <param name="rkOcctMember">The removed member</param>
+		TOPOLOGIC_API void RemoveMember(const TopoDS_Shape& rkOcctParent, const TopoDS_Shape& rkOcctMember);
+
+		/// <summary>
+		/// Patches the index after the indexed shape has been rebuilt as a new shape, where only the given members
+		/// and their ancestors were modified (e.g. by ShapeBuild_ReShape). The members of the new shape which are
+		/// already indexed are kept.
+		/// </summary>
+		/// <param name="rkOcctModifiedMembers">The modified members of the indexed shape</param>
+		/// <param name="rkOcctNewShape">The new shape</param>
+		TOPOLOGIC_API void Update(const TopTools_ListOfShape& rkOcctModifiedMembers, const TopoDS_Shape& rkOcctNewShape);
+
+		/// <summary>
+		/// Returns a new modification stamp, larger than all previous ones.
+		/// </summary>
+		/// <returns name="unsigned long long">A new modification stamp</returns>
+		TOPOLOGIC_API static unsigned long long NewModificationStamp();
+
+	protected:
+		/// <summary>
+		/// Indexes a shape under a parent, and its members if the shape is not indexed yet.
+		/// </summary>
+		void Insert(const TopoDS_Shape& rkOcctShape, const TopoDS_Shape& rkOcctParent);
+
+		/// <summary>
+		/// Removes a shape from the index if it has no parent left, and its members if they become orphans.
+		/// </summary>
+		void Erase(const TopoDS_Shape& rkOcctShape);
+
+		/// <summary>
+		/// Removes one parent link from a shape.
+		/// </summary>
+		void Unlink(const TopoDS_Shape& rkOcctParent, const TopoDS_Shape& rkOcctShape);
+
+		/// <summary>
+		/// Clears the index and indexes a new shape.
+		/// </summary>
+		void Rebuild(const TopoDS_Shape& rkOcctShape);
+
+		/// <summary>
+		/// The indexed shape
+		/// </summary>
+		TopoDS_Shape m_occtShape;
+
+		/// <summary>
+		/// The map from each member to its direct parents (one entry per occurrence)
+		/// </summary>
+		TopTools_DataMapOfShapeListOfShape m_occtParents;
+
+		/// <summary>
+		/// The members by type
+		/// </summary>
+		TopTools_IndexedMapOfShape m_occtMembers[TopAbs_SHAPE + 1];
+
+		/// <summary>
+		/// The modification stamp of the index
+		/// </summary>
+		unsigned long long m_modificationStamp;
+	};
+}
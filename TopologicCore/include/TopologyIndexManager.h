@@ -0,0 +1,134 @@
+// This file is part of Topologic software library.
+// Copyright(C) 2019, Cardiff University and University College London
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+#pragma once
+
+#include "Utilities.h"
+
+#include <TopoDS_Shape.hxx>
+#include <TopTools_ListOfShape.hxx>
+
+#include <map>
+#include <memory>
+#include <mutex>
+
+namespace TopologicCore
+{
+	class TopologyIndex;
+
+	/// <summary>
+	/// TopologyIndexManager keeps the modification stamps and the indices of the Clusters edited in place, keyed by their TShapes,
+	/// so that every Topology wrapping the same OCCT shape sees the same stamp and shares the same index. Entries are only created
+	/// by Cluster::AddTopology/RemoveTopology, at most kMaxNumberOfIndices indices are kept (the least recently used ones are
+	/// evicted), and the entries of a Cluster are removed when it is destroyed.
+	/// </summary>
+	class TopologyIndexManager
+	{
+	public:
+		typedef std::shared_ptr<TopologyIndexManager> Ptr;
+		typedef std::map<TopoDS_Shape, unsigned long long, TopologicCore::OcctShapeComparator> ShapeToStampMap;
+		typedef std::map<TopoDS_Shape, std::pair<std::shared_ptr<TopologyIndex>, unsigned long long>, TopologicCore::OcctShapeComparator> ShapeToIndexMap;
+
+		static const int kMaxNumberOfIndices = 64;
+
+	public:
+		TOPOLOGIC_API static TopologyIndexManager& GetInstance();
+
+		/// <summary>
+		/// Returns the modification stamp of an OCCT shape. It is 0 unless the shape has been edited in place.
+		/// </summary>
+		/// <param name="rkOcctShape">An OCCT shape</param>
+		/// <returns name="unsigned long long">The modification stamp of the OCCT shape</returns>
+		TOPOLOGIC_API unsigned long long GetModificationStamp(const TopoDS_Shape& rkOcctShape);
+
+		/// <summary>
+		/// Returns the index of an OCCT shape, or nullptr if it has none. Looking up an index never creates one.
+		/// </summary>
+		/// <param name="rkOcctShape">An OCCT shape</param>
+		/// <returns name="TopologyIndex::Ptr">The index of the OCCT shape</returns>
+		TOPOLOGIC_API std::shared_ptr<TopologyIndex> Find(const TopoDS_Shape& rkOcctShape);
+
+		/// <summary>
+		/// Records that a member has been added in place to a compound (e.g. by BRep_Builder::Add). The compound gets a new stamp
+		/// and its index is patched, or built if it has none. The other indices containing the compound are removed.
+		/// </summary>
+		/// <param name="rkOcctParent">The compound</param>
+		/// <param name="rkOcctMember">The added member</param>
+		TOPOLOGIC_API void AddMember(const TopoDS_Shape& rkOcctParent, const TopoDS_Shape& rkOcctMember);
+
+		/// <summary>
+		/// Records that a member has been removed in place from a compound (e.g. by BRep_Builder::Remove). The compound gets
+		/// a new stamp and its index is patched, or built if it has none. The other indices containing the compound are removed.
+		/// </summary>
+		/// <param name="rkOcctParent">The compound</param>
+		/// <param name="rkOcctMember">The removed member</param>
+		TOPOLOGIC_API void RemoveMember(const TopoDS_Shape& rkOcctParent, const TopoDS_Shape& rkOcctMember);
+
+		/// <summary>
+		/// Records that an OCCT shape has been rebuilt as a new shape, where only the given members and their ancestors were
+		/// modified (e.g. by ShapeBuild_ReShape). If the original shape has entries, they are moved to the new shape, which gets
+		/// a new stamp, and the index is patched. Shapes without entries are left untracked.
+		/// </summary>
+		/// <param name="rkOcctOriginalShape">The original shape</param>
+		/// <param name="rkOcctModifiedMembers">The modified members of the original shape</param>
+		/// <param name="rkOcctNewShape">The new shape</param>
+		TOPOLOGIC_API void Replace(const TopoDS_Shape& rkOcctOriginalShape, const TopTools_ListOfShape& rkOcctModifiedMembers, const TopoDS_Shape& rkOcctNewShape);
+
+		/// <summary>
+		/// Removes the stamp and the index of an OCCT shape.
+		/// </summary>
+		/// <param name="rkOcctShape">An OCCT shape</param>
+		TOPOLOGIC_API void ClearOne(const TopoDS_Shape& rkOcctShape);
+
+		/// <summary>
+		/// Removes all stamps and indices.
+		/// </summary>
+		TOPOLOGIC_API void ClearAll();
+
+	protected:
+		TopologyIndexManager();
+
+		/// <summary>
+		/// Gives a compound a new stamp, and removes the indices of the other shapes containing it.
+		/// </summary>
+		void Modified(const TopoDS_Shape& rkOcctShape);
+
+		/// <summary>
+		/// Stores an index, evicting the least recently used one if there are too many.
+		/// </summary>
+		void Insert(const TopoDS_Shape& rkOcctShape, const std::shared_ptr<TopologyIndex>& kpIndex);
+
+		/// <summary>
+		/// The modification stamps of the OCCT shapes which have been edited
+		/// </summary>
+		ShapeToStampMap m_occtShapeToStampMap;
+
+		/// <summary>
+		/// The indices of the OCCT shapes, with the time they were last used
+		/// </summary>
+		ShapeToIndexMap m_occtShapeToIndexMap;
+
+		/// <summary>
+		/// The clock used to find the least recently used index
+		/// </summary>
+		unsigned long long m_useClock;
+
+		/// <summary>
+		/// Guards both maps
+		/// </summary>
+		std::mutex m_mutex;
+	};
+}
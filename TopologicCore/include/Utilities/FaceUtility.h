@@ -102,6 +102,8 @@ namespace TopologicUtilities
 
 		static TOPOLOGIC_API void Triangulate(const TopologicCore::Face::Ptr& kpFace, const double kDeflection, std::list<TopologicCore::Face::Ptr>& rTriangles);
 
+		static TOPOLOGIC_API void Triangulate(const TopologicCore::Face::Ptr& kpFace, const double kDeflection, std::vector<TopologicCore::Face::Ptr>& rTriangles);
+
 		/// <summary>
 		/// 
 		/// </summary>
@@ -39,6 +39,16 @@ namespace TopologicUtilities
 			TopologicCore::Topology const * const kpkParentTopology,
 			std::list<TopologicCore::Edge::Ptr>& rCoreAdjacentEdges);
 
+		static TOPOLOGIC_API void AdjacentEdges(
+			const TopologicCore::Vertex::Ptr & kpVertex,
+			const TopologicCore::Topology::Ptr & kpParentTopology,
+			std::vector<TopologicCore::Edge::Ptr>& rCoreAdjacentEdges);
+
+		static TOPOLOGIC_API void AdjacentEdges(
+			const TopologicCore::Vertex::Ptr & kpVertex,
+			TopologicCore::Topology const * const kpkParentTopology,
+			std::vector<TopologicCore::Edge::Ptr>& rCoreAdjacentEdges);
+
 		/// <summary>
 		/// 
 		/// </summary>
@@ -73,6 +73,9 @@ namespace TopologicCore
 		/// <returns></returns>
 		static TOPOLOGIC_API std::shared_ptr<Vertex> ByCoordinates(const double kX, const double kY, const double kZ);
 
+		// The vector overloads of the navigation methods below are inherited from Topology.
+		using Topology::Edges;
+
 		/// <summary>
 		/// Returns the list of edges of which this vertex is a constituent member.
 		/// </summary>
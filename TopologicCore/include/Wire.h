@@ -54,12 +54,23 @@ namespace TopologicCore
 
 		TOPOLOGIC_API virtual ~Wire();
 
+		// The vector overloads of the navigation methods below are inherited from Topology.
+		using Topology::Edges;
+		using Topology::Faces;
+		using Topology::Vertices;
+
 		/// <summary>
 		/// 
 		/// </summary>
 		/// <param name="rEdges"></param>
 		void TOPOLOGIC_API Edges(const Topology::Ptr& kpHostTopology, std::list<std::shared_ptr<Edge>>& rEdges) const;
 
+		/// <summary>
+		/// Same as the list overload, but stores the result contiguously.
+		/// </summary>
+		/// <param name="rEdges"></param>
+		void TOPOLOGIC_API Edges(const Topology::Ptr& kpHostTopology, std::vector<std::shared_ptr<Edge>>& rEdges) const;
+
 		/// <summary>
 		/// 
 		/// </summary>
@@ -79,6 +90,12 @@ namespace TopologicCore
 		/// <param name="rVertices"></param>
 		virtual void TOPOLOGIC_API Vertices(const Topology::Ptr& kpHostTopology, std::list<std::shared_ptr<Vertex>>& rVertices) const;
 
+		/// <summary>
+		/// Same as the list overload, but stores the result contiguously.
+		/// </summary>
+		/// <param name="rVertices"></param>
+		virtual void TOPOLOGIC_API Vertices(const Topology::Ptr& kpHostTopology, std::vector<std::shared_ptr<Vertex>>& rVertices) const;
+
 		/// <summary>
 		/// 
 		/// </summary>
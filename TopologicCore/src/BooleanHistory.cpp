@@ -0,0 +1,288 @@
+// This file is part of Topologic software library.
+// Copyright(C) 2019, Cardiff University and University College London
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+#include "BooleanHistory.h"
+
+#include <TopExp.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
+
+namespace TopologicCore
+{
+	void AddHistoryShapes(const TopTools_DataMapOfShapeListOfShape& rkOcctMap, const TopoDS_Shape& rkOcctKey, TopTools_ListOfShape& rOcctShapes)
+	{
+		if (!rkOcctMap.IsBound(rkOcctKey))
+		{
+			return;
+		}
+
+		for (TopTools_ListIteratorOfListOfShape occtShapeIterator(rkOcctMap.Find(rkOcctKey));
+			occtShapeIterator.More();
+			occtShapeIterator.Next())
+		{
+			rOcctShapes.Append(occtShapeIterator.Value());
+		}
+	}
+
+	void AddHistoryTopologies(const TopTools_ListOfShape& rkOcctShapes, std::list<Topology::Ptr>& rTopologies)
+	{
+		for (TopTools_ListIteratorOfListOfShape occtShapeIterator(rkOcctShapes);
+			occtShapeIterator.More();
+			occtShapeIterator.Next())
+		{
+			rTopologies.push_back(Topology::ByOcctShape(occtShapeIterator.Value(), ""));
+		}
+	}
+
+	BooleanHistory::BooleanHistory()
+	{
+
+	}
+
+	BooleanHistory::~BooleanHistory()
+	{
+
+	}
+
+	void BooleanHistory::Modified(const Topology::Ptr& kpInput, std::list<Topology::Ptr>& rModified) const
+	{
+		TopTools_ListOfShape occtModified;
+		Modified(kpInput->GetOcctShape(), occtModified);
+		AddHistoryTopologies(occtModified, rModified);
+	}
+
+	void BooleanHistory::Generated(const Topology::Ptr& kpInput, std::list<Topology::Ptr>& rGenerated) const
+	{
+		TopTools_ListOfShape occtGenerated;
+		Generated(kpInput->GetOcctShape(), occtGenerated);
+		AddHistoryTopologies(occtGenerated, rGenerated);
+	}
+
+	bool BooleanHistory::IsDeleted(const Topology::Ptr& kpInput) const
+	{
+		return IsDeleted(kpInput->GetOcctShape());
+	}
+
+	void BooleanHistory::Origins(const Topology::Ptr& kpOutput, std::list<Topology::Ptr>& rOrigins) const
+	{
+		TopTools_ListOfShape occtOrigins;
+		Origins(kpOutput->GetOcctShape(), occtOrigins);
+		AddHistoryTopologies(occtOrigins, rOrigins);
+	}
+
+	void BooleanHistory::Modified(const TopoDS_Shape& rkOcctInput, TopTools_ListOfShape& rOcctModified) const
+	{
+		AddHistoryShapes(m_occtModified, rkOcctInput, rOcctModified);
+	}
+
+	void BooleanHistory::Generated(const TopoDS_Shape& rkOcctInput, TopTools_ListOfShape& rOcctGenerated) const
+	{
+		AddHistoryShapes(m_occtGenerated, rkOcctInput, rOcctGenerated);
+	}
+
+	bool BooleanHistory::IsDeleted(const TopoDS_Shape& rkOcctInput) const
+	{
+		return m_occtDeleted.Contains(rkOcctInput);
+	}
+
+	void BooleanHistory::Origins(const TopoDS_Shape& rkOcctOutput, TopTools_ListOfShape& rOcctOrigins) const
+	{
+		AddHistoryShapes(m_occtOrigins, rkOcctOutput, rOcctOrigins);
+	}
+
+	void BooleanHistory::Clear()
+	{
+		m_occtHistorySteps.clear();
+		m_occtModified.Clear();
+		m_occtGenerated.Clear();
+		m_occtOrigins.Clear();
+		m_occtDeleted.Clear();
+	}
+
+	void BooleanHistory::Build(const TopTools_ListOfShape& rkOcctOperands, const OcctHistorySteps& rkOcctHistorySteps, const TopoDS_Shape& rkOcctResult)
+	{
+		Clear();
+		m_occtHistorySteps = rkOcctHistorySteps;
+
+		TopTools_IndexedMapOfShape occtResultMembers;
+		if (!rkOcctResult.IsNull())
+		{
+			TopExp::MapShapes(rkOcctResult, occtResultMembers);
+		}
+
+		TopTools_IndexedMapOfShape occtInputs;
+		for (TopTools_ListIteratorOfListOfShape occtOperandIterator(rkOcctOperands);
+			occtOperandIterator.More();
+			occtOperandIterator.Next())
+		{
+			TopExp::MapShapes(occtOperandIterator.Value(), occtInputs);
+		}
+
+		for (int i = 1; i <= occtInputs.Extent(); ++i)
+		{
+			const TopoDS_Shape& rkOcctInput = occtInputs(i);
+			TopAbs_ShapeEnum occtInputType = rkOcctInput.ShapeType();
+			if (occtInputType != TopAbs_VERTEX && occtInputType != TopAbs_EDGE &&
+				occtInputType != TopAbs_FACE && occtInputType != TopAbs_SOLID)
+			{
+				continue;
+			}
+
+			// 1. Follow the input through the steps. The generated shapes of a step are followed through the later steps.
+			TopTools_ListOfShape occtImages;
+			occtImages.Append(rkOcctInput);
+			TopTools_ListOfShape occtGenerated;
+			for (const std::vector<Handle(BRepTools_History)>& rkOcctHistories : rkOcctHistorySteps)
+			{
+				TopTools_MapOfShape occtVisitedImages;
+				TopTools_ListOfShape occtNextImages;
+				TopTools_MapOfShape occtVisitedGenerated;
+				TopTools_ListOfShape occtNextGenerated;
+				for (TopTools_ListIteratorOfListOfShape occtImageIterator(occtImages);
+					occtImageIterator.More();
+					occtImageIterator.Next())
+				{
+					AddImages(occtImageIterator.Value(), rkOcctHistories, occtVisitedImages, occtNextImages);
+					for (const Handle(BRepTools_History)& kpOcctHistory : rkOcctHistories)
+					{
+						if (kpOcctHistory.IsNull())
+						{
+							continue;
+						}
+
+						for (TopTools_ListIteratorOfListOfShape occtGeneratedIterator(kpOcctHistory->Generated(occtImageIterator.Value()));
+							occtGeneratedIterator.More();
+							occtGeneratedIterator.Next())
+						{
+							if (occtVisitedGenerated.Add(occtGeneratedIterator.Value()))
+							{
+								occtNextGenerated.Append(occtGeneratedIterator.Value());
+							}
+						}
+					}
+				}
+
+				for (TopTools_ListIteratorOfListOfShape occtGeneratedIterator(occtGenerated);
+					occtGeneratedIterator.More();
+					occtGeneratedIterator.Next())
+				{
+					AddImages(occtGeneratedIterator.Value(), rkOcctHistories, occtVisitedGenerated, occtNextGenerated);
+				}
+
+				occtImages = occtNextImages;
+				occtGenerated = occtNextGenerated;
+			}
+
+			// 2. Only keep the shapes which are in the result.
+			bool isKept = false;
+			TopTools_ListOfShape occtModified;
+			for (TopTools_ListIteratorOfListOfShape occtImageIterator(occtImages);
+				occtImageIterator.More();
+				occtImageIterator.Next())
+			{
+				const TopoDS_Shape& rkOcctImage = occtImageIterator.Value();
+				if (!occtResultMembers.Contains(rkOcctImage))
+				{
+					continue;
+				}
+
+				if (rkOcctImage.IsSame(rkOcctInput))
+				{
+					isKept = true;
+				}
+				else
+				{
+					occtModified.Append(rkOcctImage);
+				}
+
+				if (!m_occtOrigins.IsBound(rkOcctImage))
+				{
+					m_occtOrigins.Bind(rkOcctImage, TopTools_ListOfShape());
+				}
+				m_occtOrigins.ChangeFind(rkOcctImage).Append(rkOcctInput);
+			}
+
+			TopTools_ListOfShape occtResultGenerated;
+			for (TopTools_ListIteratorOfListOfShape occtGeneratedIterator(occtGenerated);
+				occtGeneratedIterator.More();
+				occtGeneratedIterator.Next())
+			{
+				const TopoDS_Shape& rkOcctGenerated = occtGeneratedIterator.Value();
+				if (!occtResultMembers.Contains(rkOcctGenerated))
+				{
+					continue;
+				}
+
+				occtResultGenerated.Append(rkOcctGenerated);
+				if (!m_occtOrigins.IsBound(rkOcctGenerated))
+				{
+					m_occtOrigins.Bind(rkOcctGenerated, TopTools_ListOfShape());
+				}
+				m_occtOrigins.ChangeFind(rkOcctGenerated).Append(rkOcctInput);
+			}
+
+			if (!occtModified.IsEmpty())
+			{
+				m_occtModified.Bind(rkOcctInput, occtModified);
+			}
+			if (!occtResultGenerated.IsEmpty())
+			{
+				m_occtGenerated.Bind(rkOcctInput, occtResultGenerated);
+			}
+			if (!isKept && occtModified.IsEmpty())
+			{
+				m_occtDeleted.Add(rkOcctInput);
+			}
+		}
+	}
+
+	void BooleanHistory::AddImages(const TopoDS_Shape& rkOcctShape, const std::vector<Handle(BRepTools_History)>& rkOcctHistories,
+		TopTools_MapOfShape& rOcctVisitedImages, TopTools_ListOfShape& rOcctImages)
+	{
+		// The histories of a step are applied to the same shapes, so a shape is kept if any of them keeps it.
+		bool hasHistory = false;
+		bool isKept = false;
+		for (const Handle(BRepTools_History)& kpOcctHistory : rkOcctHistories)
+		{
+			if (kpOcctHistory.IsNull())
+			{
+				continue;
+			}
+			hasHistory = true;
+
+			const TopTools_ListOfShape& rkOcctModified = kpOcctHistory->Modified(rkOcctShape);
+			if (rkOcctModified.IsEmpty())
+			{
+				isKept = isKept || !kpOcctHistory->IsRemoved(rkOcctShape);
+				continue;
+			}
+
+			for (TopTools_ListIteratorOfListOfShape occtModifiedIterator(rkOcctModified);
+				occtModifiedIterator.More();
+				occtModifiedIterator.Next())
+			{
+				if (rOcctVisitedImages.Add(occtModifiedIterator.Value()))
+				{
+					rOcctImages.Append(occtModifiedIterator.Value());
+				}
+			}
+		}
+
+		if ((!hasHistory || isKept) && rOcctVisitedImages.Add(rkOcctShape))
+		{
+			rOcctImages.Append(rkOcctShape);
+		}
+	}
+}
@@ -0,0 +1,64 @@
+// This file is part of Topologic software library.
+// Copyright(C) 2019, Cardiff University and University College London
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+#include "BooleanOptions.h"
+
+namespace TopologicCore
+{
+	BooleanOptions::BooleanOptions()
+		: fuzzyValue(0.0)
+		, glue(BOPAlgo_GlueOff)
+		, nonDestructive(false)
+		, useOBB(false)
+		, prefilter(false)
+		, tiledSelfMerge(false)
+	{
+
+	}
+
+	void BooleanOptions::Apply(BOPAlgo_Builder& rOcctBuilder) const
+	{
+		if (fuzzyValue > 0.0)
+		{
+			rOcctBuilder.SetFuzzyValue(fuzzyValue);
+		}
+		rOcctBuilder.SetGlue(glue);
+		rOcctBuilder.SetNonDestructive(nonDestructive);
+		rOcctBuilder.SetUseOBB(useOBB);
+	}
+
+	void BooleanOptions::Apply(BRepAlgoAPI_BuilderAlgo& rOcctBooleanOperation) const
+	{
+		if (fuzzyValue > 0.0)
+		{
+			rOcctBooleanOperation.SetFuzzyValue(fuzzyValue);
+		}
+		rOcctBooleanOperation.SetGlue(glue);
+		rOcctBooleanOperation.SetNonDestructive(true);
+		rOcctBooleanOperation.SetUseOBB(useOBB);
+	}
+
+	void BooleanOptions::Apply(BOPAlgo_PaveFiller& rOcctPaveFiller) const
+	{
+		if (fuzzyValue > 0.0)
+		{
+			rOcctPaveFiller.SetFuzzyValue(fuzzyValue);
+		}
+		rOcctPaveFiller.SetGlue(glue);
+		rOcctPaveFiller.SetNonDestructive(nonDestructive);
+		rOcctPaveFiller.SetUseOBB(useOBB);
+	}
+}
@@ -0,0 +1,364 @@
+// This file is part of Topologic software library.
+// Copyright(C) 2019, Cardiff University and University College London
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+#include "BooleanSession.h"
+#include "ExecutionPolicy.h"
+
+#include <BRep_Builder.hxx>
+#include <BRepAlgoAPI_Common.hxx>
+#include <BRepAlgoAPI_Fuse.hxx>
+#include <BRepAlgoAPI_Section.hxx>
+#include <Standard_Failure.hxx>
+#include <TopExp.hxx>
+#include <TopoDS_Compound.hxx>
+#include <TopoDS_Iterator.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
+
+#include <sstream>
+
+namespace TopologicCore
+{
+	BooleanSession::BooleanSession(const Topology::Ptr& kpTopologyA, const Topology::Ptr& kpTopologyB, const bool kFixOperands, const BooleanOptions& rkOptions)
+		: m_pTopologyA(kpTopologyA)
+		, m_pTopologyB(kpTopologyB)
+		, m_options(rkOptions)
+	{
+		if (kpTopologyA == nullptr || kpTopologyB == nullptr)
+		{
+			throw std::runtime_error("Fails to create a Boolean session because one of the Topologies is null.");
+		}
+
+		TopTools_ListOfShape occtArgumentsA;
+		TopTools_ListOfShape occtArgumentsB;
+		kpTopologyA->AddBooleanOperands(kpTopologyB, occtArgumentsA, occtArgumentsB);
+		if (kFixOperands)
+		{
+			for (TopTools_ListIteratorOfListOfShape occtArgumentIterator(occtArgumentsA);
+				occtArgumentIterator.More();
+				occtArgumentIterator.Next())
+			{
+				m_occtArgumentsA.Append(FixedOperand(occtArgumentIterator.Value()));
+			}
+			for (TopTools_ListIteratorOfListOfShape occtArgumentIterator(occtArgumentsB);
+				occtArgumentIterator.More();
+				occtArgumentIterator.Next())
+			{
+				m_occtArgumentsB.Append(FixedOperand(occtArgumentIterator.Value()));
+			}
+		}
+		else
+		{
+			m_occtArgumentsA = occtArgumentsA;
+			m_occtArgumentsB = occtArgumentsB;
+		}
+
+		// Intersect the operands once. The operands are shared by all operations, so they must not be modified.
+		TopTools_ListOfShape occtArguments;
+		Arguments(occtArguments);
+		m_occtPaveFiller.SetArguments(occtArguments);
+		m_options.Apply(m_occtPaveFiller);
+		m_occtPaveFiller.SetNonDestructive(true);
+		ExecutionPolicy::GetInstance().Apply(m_occtPaveFiller);
+
+		try {
+			m_occtPaveFiller.Perform(ProgressMonitor::Start(m_options.progressMonitor, "BooleanSession: Intersecting"));
+		}
+		catch (Standard_Failure&)
+		{
+		}
+		ProgressMonitor::Check(m_options.progressMonitor);
+
+		if (m_occtPaveFiller.HasErrors())
+		{
+			std::ostringstream errorStream;
+			m_occtPaveFiller.DumpErrors(errorStream);
+			throw std::runtime_error(errorStream.str().c_str());
+		}
+	}
+
+	BooleanSession::~BooleanSession()
+	{
+
+	}
+
+	Topology::Ptr BooleanSession::Difference(const bool kTransferDictionary)
+	{
+		BOPAlgo_CellsBuilder& rOcctCellsBuilder = CellsBuilder();
+
+		TopTools_ListOfShape occtListToTake;
+		for (TopTools_ListIteratorOfListOfShape kOcctShapeIteratorA(m_occtArgumentsA);
+			kOcctShapeIteratorA.More();
+			kOcctShapeIteratorA.Next())
+		{
+			occtListToTake.Clear();
+			occtListToTake.Append(kOcctShapeIteratorA.Value());
+			rOcctCellsBuilder.AddToResult(occtListToTake, m_occtArgumentsB);
+		}
+
+		return CellsBuilderResult(rOcctCellsBuilder, true, kTransferDictionary);
+	}
+
+	Topology::Ptr BooleanSession::Impose(const bool kTransferDictionary)
+	{
+		// Impose assigns materials, which rebuild the parts, so it cannot share the CellsBuilder.
+		BOPAlgo_CellsBuilder occtCellsBuilder;
+		BuildCells(occtCellsBuilder);
+
+		TopTools_ListOfShape occtListToTake;
+		TopTools_ListOfShape occtListToAvoid;
+
+		// Get part of A not in B
+		for (TopTools_ListIteratorOfListOfShape kOcctShapeIteratorA(m_occtArgumentsA);
+			kOcctShapeIteratorA.More();
+			kOcctShapeIteratorA.Next())
+		{
+			occtListToTake.Clear();
+			occtListToTake.Append(kOcctShapeIteratorA.Value());
+			occtCellsBuilder.AddToResult(occtListToTake, m_occtArgumentsB);
+		}
+
+		// Add B
+		int i = 1;
+		for (TopTools_ListIteratorOfListOfShape kOcctShapeIteratorB(m_occtArgumentsB);
+			kOcctShapeIteratorB.More();
+			kOcctShapeIteratorB.Next())
+		{
+			occtListToTake.Clear();
+			occtListToTake.Append(kOcctShapeIteratorB.Value());
+			occtCellsBuilder.AddToResult(occtListToTake, occtListToAvoid, i++, true);
+		}
+
+		return CellsBuilderResult(occtCellsBuilder, true, kTransferDictionary);
+	}
+
+	Topology::Ptr BooleanSession::Imprint(const bool kTransferDictionary)
+	{
+		BOPAlgo_CellsBuilder& rOcctCellsBuilder = CellsBuilder();
+
+		TopTools_ListOfShape occtListToTake;
+		TopTools_ListOfShape occtListToAvoid;
+		for (TopTools_ListIteratorOfListOfShape kOcctShapeIteratorA(m_occtArgumentsA);
+			kOcctShapeIteratorA.More();
+			kOcctShapeIteratorA.Next())
+		{
+			for (TopTools_ListIteratorOfListOfShape kOcctShapeIteratorB(m_occtArgumentsB);
+				kOcctShapeIteratorB.More();
+				kOcctShapeIteratorB.Next())
+			{
+				occtListToTake.Clear();
+				occtListToTake.Append(kOcctShapeIteratorA.Value());
+				occtListToTake.Append(kOcctShapeIteratorB.Value());
+				rOcctCellsBuilder.AddToResult(occtListToTake, occtListToAvoid);
+			}
+		}
+
+		for (TopTools_ListIteratorOfListOfShape kOcctShapeIteratorA(m_occtArgumentsA);
+			kOcctShapeIteratorA.More();
+			kOcctShapeIteratorA.Next())
+		{
+			occtListToTake.Clear();
+			occtListToTake.Append(kOcctShapeIteratorA.Value());
+			rOcctCellsBuilder.AddToResult(occtListToTake, m_occtArgumentsB);
+		}
+
+		return CellsBuilderResult(rOcctCellsBuilder, true, kTransferDictionary);
+	}
+
+	Topology::Ptr BooleanSession::Intersect(const bool kTransferDictionary)
+	{
+		// Intersect = Common + Section, both built from the shared intersection
+		BRepAlgoAPI_Common occtCommon(m_occtPaveFiller);
+		occtCommon.SetArguments(m_occtArgumentsA);
+		occtCommon.SetTools(m_occtArgumentsB);
+		m_options.Apply(occtCommon);
+		occtCommon.Build(ProgressMonitor::Start(m_options.progressMonitor, "BooleanSession: Common"));
+		ProgressMonitor::Check(m_options.progressMonitor);
+
+		BRepAlgoAPI_Section occtSection(m_occtPaveFiller, false);
+		occtSection.SetArguments(m_occtArgumentsA);
+		occtSection.SetTools(m_occtArgumentsB);
+		m_options.Apply(occtSection);
+		occtSection.Build(ProgressMonitor::Start(m_options.progressMonitor, "BooleanSession: Section"));
+		ProgressMonitor::Check(m_options.progressMonitor);
+
+		// Common and Section are split by the same intersection, so they share their sub-shapes. They are combined without
+		// being merged again: the Section parts which already bound the Common parts are skipped.
+		TopTools_IndexedMapOfShape occtCommonMembers;
+		TopExp::MapShapes(occtCommon.Shape(), occtCommonMembers);
+
+		TopoDS_Compound occtResultCompound;
+		BRep_Builder occtBuilder;
+		occtBuilder.MakeCompound(occtResultCompound);
+		int numOfParts = 0;
+		for (TopoDS_Iterator occtIterator(occtCommon.Shape()); occtIterator.More(); occtIterator.Next())
+		{
+			occtBuilder.Add(occtResultCompound, occtIterator.Value());
+			++numOfParts;
+		}
+		for (TopoDS_Iterator occtIterator(occtSection.Shape()); occtIterator.More(); occtIterator.Next())
+		{
+			if (!occtCommonMembers.Contains(occtIterator.Value()))
+			{
+				occtBuilder.Add(occtResultCompound, occtIterator.Value());
+				++numOfParts;
+			}
+		}
+
+		if (numOfParts == 0)
+		{
+			return nullptr;
+		}
+
+		std::list<Topology::Ptr> origins{ m_pTopologyA, m_pTopologyB };
+		return Topology::BooleanResult(occtResultCompound, origins, origins, kTransferDictionary);
+	}
+
+	Topology::Ptr BooleanSession::Merge(const bool kTransferDictionary)
+	{
+		BOPAlgo_CellsBuilder& rOcctCellsBuilder = CellsBuilder();
+		rOcctCellsBuilder.AddAllToResult();
+
+		return CellsBuilderResult(rOcctCellsBuilder, true, kTransferDictionary);
+	}
+
+	Topology::Ptr BooleanSession::Slice(const bool kTransferDictionary)
+	{
+		BOPAlgo_CellsBuilder& rOcctCellsBuilder = CellsBuilder();
+
+		TopTools_ListOfShape occtListToTake;
+		TopTools_ListOfShape occtListToAvoid;
+		for (TopTools_ListIteratorOfListOfShape kOcctShapeIteratorA(m_occtArgumentsA);
+			kOcctShapeIteratorA.More();
+			kOcctShapeIteratorA.Next())
+		{
+			occtListToTake.Clear();
+			occtListToTake.Append(kOcctShapeIteratorA.Value());
+			rOcctCellsBuilder.AddToResult(occtListToTake, occtListToAvoid);
+		}
+
+		return CellsBuilderResult(rOcctCellsBuilder, false, kTransferDictionary);
+	}
+
+	Topology::Ptr BooleanSession::Union(const bool kTransferDictionary)
+	{
+		BRepAlgoAPI_Fuse occtFuse(m_occtPaveFiller);
+		occtFuse.SetArguments(m_occtArgumentsA);
+		occtFuse.SetTools(m_occtArgumentsB);
+		m_options.Apply(occtFuse);
+		occtFuse.Build(ProgressMonitor::Start(m_options.progressMonitor, "BooleanSession: Union"));
+		ProgressMonitor::Check(m_options.progressMonitor);
+
+		TopoDS_Shape occtResultShape = occtFuse.Shape();
+		std::list<Topology::Ptr> origins{ m_pTopologyA, m_pTopologyB };
+		return Topology::BooleanResult(occtResultShape, origins, origins, kTransferDictionary);
+	}
+
+	Topology::Ptr BooleanSession::XOR(const bool kTransferDictionary)
+	{
+		BOPAlgo_CellsBuilder& rOcctCellsBuilder = CellsBuilder();
+
+		TopTools_ListOfShape occtListToTake;
+		for (TopTools_ListIteratorOfListOfShape kOcctShapeIteratorA(m_occtArgumentsA);
+			kOcctShapeIteratorA.More();
+			kOcctShapeIteratorA.Next())
+		{
+			occtListToTake.Clear();
+			occtListToTake.Append(kOcctShapeIteratorA.Value());
+			rOcctCellsBuilder.AddToResult(occtListToTake, m_occtArgumentsB);
+		}
+
+		for (TopTools_ListIteratorOfListOfShape kOcctShapeIteratorB(m_occtArgumentsB);
+			kOcctShapeIteratorB.More();
+			kOcctShapeIteratorB.Next())
+		{
+			occtListToTake.Clear();
+			occtListToTake.Append(kOcctShapeIteratorB.Value());
+			rOcctCellsBuilder.AddToResult(occtListToTake, m_occtArgumentsA);
+		}
+
+		return CellsBuilderResult(rOcctCellsBuilder, true, kTransferDictionary);
+	}
+
+	TopoDS_Shape BooleanSession::FixedOperand(const TopoDS_Shape& rkOcctOperand)
+	{
+		if (m_occtMapOperandToFixedOperand.IsBound(rkOcctOperand))
+		{
+			return m_occtMapOperandToFixedOperand.Find(rkOcctOperand);
+		}
+
+		TopoDS_Shape occtFixedOperand = Topology::FixBooleanOperandFace(rkOcctOperand);
+		occtFixedOperand = Topology::FixBooleanOperandShell(occtFixedOperand);
+		occtFixedOperand = Topology::FixBooleanOperandCell(occtFixedOperand);
+		m_occtMapOperandToFixedOperand.Bind(rkOcctOperand, occtFixedOperand);
+		return occtFixedOperand;
+	}
+
+	void BooleanSession::Arguments(TopTools_ListOfShape& rOcctArguments) const
+	{
+		Topology::AddOcctListShapeToAnotherList(m_occtArgumentsA, rOcctArguments);
+		Topology::AddOcctListShapeToAnotherList(m_occtArgumentsB, rOcctArguments);
+	}
+
+	BOPAlgo_CellsBuilder& BooleanSession::CellsBuilder()
+	{
+		if (m_pOcctCellsBuilder == nullptr)
+		{
+			m_pOcctCellsBuilder.reset(new BOPAlgo_CellsBuilder());
+			BuildCells(*m_pOcctCellsBuilder);
+		}
+		else
+		{
+			m_pOcctCellsBuilder->RemoveAllFromResult();
+		}
+		return *m_pOcctCellsBuilder;
+	}
+
+	void BooleanSession::BuildCells(BOPAlgo_CellsBuilder& rOcctCellsBuilder)
+	{
+		TopTools_ListOfShape occtArguments;
+		Arguments(occtArguments);
+		rOcctCellsBuilder.SetArguments(occtArguments);
+		m_options.Apply(rOcctCellsBuilder);
+		ExecutionPolicy::GetInstance().Apply(rOcctCellsBuilder);
+
+		// Only split the arguments; the intersection is taken from the session.
+		try {
+			rOcctCellsBuilder.PerformWithFiller(m_occtPaveFiller, ProgressMonitor::Start(m_options.progressMonitor, "BooleanSession: Splitting"));
+		}
+		catch (Standard_Failure&)
+		{
+		}
+		ProgressMonitor::Check(m_options.progressMonitor);
+
+		if (rOcctCellsBuilder.HasErrors())
+		{
+			std::ostringstream errorStream;
+			rOcctCellsBuilder.DumpErrors(errorStream);
+			throw std::runtime_error(errorStream.str().c_str());
+		}
+	}
+
+	Topology::Ptr BooleanSession::CellsBuilderResult(BOPAlgo_CellsBuilder& rOcctCellsBuilder, const bool kTransferContentsB, const bool kTransferDictionary)
+	{
+		std::list<Topology::Ptr> contentOrigins{ m_pTopologyA };
+		if (kTransferContentsB)
+		{
+			contentOrigins.push_back(m_pTopologyB);
+		}
+		std::list<Topology::Ptr> dictionaryOrigins{ m_pTopologyA, m_pTopologyB };
+		return Topology::NaryBooleanResult(rOcctCellsBuilder, contentOrigins, dictionaryOrigins, kTransferDictionary);
+	}
+}
@@ -23,6 +23,7 @@
 #include "CellComplex.h"
 #include "CellFactory.h"
 #include "AttributeManager.h"
+#include "ExecutionPolicy.h"
 #include <Utilities/EdgeUtility.h>
 
 #include <BOPAlgo_MakerVolume.hxx>
@@ -97,6 +98,14 @@ namespace TopologicCore
 		}
 	}
 
+	void Cell::CellComplexes(const Topology::Ptr& kpHostTopology, std::vector<std::shared_ptr<TopologicCore::CellComplex>>& rCellComplexes) const
+	{
+		if (kpHostTopology)
+		{
+			UpwardNavigation(kpHostTopology->GetOcctShape(), rCellComplexes);
+		}
+	}
+
 	void Cell::Shells(const Topology::Ptr& kpHostTopology, std::list<Shell::Ptr>& rShells) const
 	{
 		DownwardNavigation(rShells);
@@ -157,11 +166,10 @@ namespace TopologicCore
 		{
 			occtShapes.Append(kpFace->GetOcctShape());
 		}
-		bool isParallel = false;
 		bool doesIntersection = true;
 
 		occtMakerVolume.SetArguments(occtShapes);
-		occtMakerVolume.SetRunParallel(isParallel);
+		ExecutionPolicy::GetInstance().Apply(occtMakerVolume);
 		occtMakerVolume.SetIntersect(doesIntersection);
 		occtMakerVolume.SetFuzzyValue(kTolerance);
 
@@ -272,88 +280,37 @@ namespace TopologicCore
 
 	void Cell::SharedEdges(const Cell::Ptr& kpAnotherCell, std::list<Edge::Ptr>& rEdges) const
 	{
-		const TopoDS_Shape& rkOcctShape1 = GetOcctShape();
-		TopTools_MapOfShape occtEdges1;
-		DownwardNavigation(rkOcctShape1, TopAbs_EDGE, occtEdges1);
-
-		const TopoDS_Shape& rkOcctShape2 = kpAnotherCell->GetOcctShape();
-		TopTools_MapOfShape occtEdges2;
-		DownwardNavigation(rkOcctShape2, TopAbs_EDGE, occtEdges2);
-
-		for (TopTools_MapIteratorOfMapOfShape occtEdgeIterator1(occtEdges1);
-			occtEdgeIterator1.More();
-			occtEdgeIterator1.Next())
+		TopTools_ListOfShape occtSharedMembers;
+		SharedMembers(GetOcctShape(), kpAnotherCell->GetOcctShape(), TopAbs_EDGE, occtSharedMembers);
+		for (TopTools_ListIteratorOfListOfShape occtMemberIterator(occtSharedMembers);
+			occtMemberIterator.More();
+			occtMemberIterator.Next())
 		{
-			for (TopTools_MapIteratorOfMapOfShape occtEdgeIterator2(occtEdges2);
-				occtEdgeIterator2.More();
-				occtEdgeIterator2.Next())
-			{
-				if (occtEdgeIterator1.Value().IsSame(occtEdgeIterator2.Value()))
-				{
-					Edge::Ptr pEdge = std::make_shared<Edge>(TopoDS::Edge(occtEdgeIterator1.Value()));
-					rEdges.push_back(pEdge);
-				}
-			}
+			rEdges.push_back(std::make_shared<Edge>(TopoDS::Edge(occtMemberIterator.Value())));
 		}
 	}
 
 	void Cell::SharedFaces(const Cell::Ptr& kpAnotherCell, std::list<Face::Ptr>& rFaces) const
 	{
-		// Get all Faces of this Cell
-		const TopoDS_Shape& rkOcctShape1 = GetOcctShape();
-		TopTools_MapOfShape occtFaces1;
-		DownwardNavigation(rkOcctShape1, TopAbs_FACE, occtFaces1);
-
-		// Get all Faces of the other Cell
-		const TopoDS_Shape& rkOcctShape2 = kpAnotherCell->GetOcctShape();
-		TopTools_MapOfShape occtFaces2;
-		DownwardNavigation(rkOcctShape2, TopAbs_FACE, occtFaces2);
-
-		// Iterate through both lists of Faces, and identify shared Faces
-		for (TopTools_MapIteratorOfMapOfShape occtFaceIterator1(occtFaces1);
-			occtFaceIterator1.More();
-			occtFaceIterator1.Next())
+		TopTools_ListOfShape occtSharedMembers;
+		SharedMembers(GetOcctShape(), kpAnotherCell->GetOcctShape(), TopAbs_FACE, occtSharedMembers);
+		for (TopTools_ListIteratorOfListOfShape occtMemberIterator(occtSharedMembers);
+			occtMemberIterator.More();
+			occtMemberIterator.Next())
 		{
-			for (TopTools_MapIteratorOfMapOfShape occtFaceIterator2(occtFaces2);
-				occtFaceIterator2.More();
-				occtFaceIterator2.Next())
-			{
-				if (occtFaceIterator1.Value().IsSame(occtFaceIterator2.Value()))
-				{
-					Face::Ptr pFace = std::make_shared<Face>(TopoDS::Face(occtFaceIterator1.Value()));
-					rFaces.push_back(pFace);
-				}
-			}
+			rFaces.push_back(std::make_shared<Face>(TopoDS::Face(occtMemberIterator.Value())));
 		}
 	}
 
 	void Cell::SharedVertices(const Cell::Ptr& kpAnotherCell, std::list<Vertex::Ptr>& rVertices) const
 	{
-		// Get all Vertices of this Cell
-		const TopoDS_Shape& rkOcctShape1 = GetOcctShape();
-		TopTools_MapOfShape occtVertices1;
-		DownwardNavigation(rkOcctShape1, TopAbs_VERTEX, occtVertices1);
-
-		// Get all Vertices of the other Cell
-		const TopoDS_Shape& rkOcctShape2 = kpAnotherCell->GetOcctShape();
-		TopTools_MapOfShape occtVertices2;
-		DownwardNavigation(rkOcctShape2, TopAbs_VERTEX, occtVertices2);
-
-		// Iterate through both lists of Vertices, and identify shared Vertices
-		for (TopTools_MapIteratorOfMapOfShape occtVertexIterator1(occtVertices1);
-			occtVertexIterator1.More();
-			occtVertexIterator1.Next())
+		TopTools_ListOfShape occtSharedMembers;
+		SharedMembers(GetOcctShape(), kpAnotherCell->GetOcctShape(), TopAbs_VERTEX, occtSharedMembers);
+		for (TopTools_ListIteratorOfListOfShape occtMemberIterator(occtSharedMembers);
+			occtMemberIterator.More();
+			occtMemberIterator.Next())
 		{
-			for (TopTools_MapIteratorOfMapOfShape occtVertexIterator2(occtVertices2);
-				occtVertexIterator2.More();
-				occtVertexIterator2.Next())
-			{
-				if (occtVertexIterator1.Value().IsSame(occtVertexIterator2.Value()))
-				{
-					Vertex::Ptr pVertex = std::make_shared<Vertex>(TopoDS::Vertex(occtVertexIterator1.Value()));
-					rVertices.push_back(pVertex);
-				}
-			}
+			rVertices.push_back(std::make_shared<Vertex>(TopoDS::Vertex(occtMemberIterator.Value())));
 		}
 	}
 
@@ -477,6 +434,11 @@ namespace TopologicCore
 
 	TopoDS_Solid Cell::OcctShapeFix(const TopoDS_Solid & rkOcctInputSolid)
 	{
+		if (ExecutionPolicy::GetInstance().GetTrustInput())
+		{
+			return rkOcctInputSolid;
+		}
+
 		ShapeFix_Solid occtSolidFix(rkOcctInputSolid);
 		occtSolidFix.Perform();
 		return TopoDS::Solid(occtSolidFix.Solid());
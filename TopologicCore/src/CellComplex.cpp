@@ -24,6 +24,7 @@
 #include "Shell.h"
 #include "CellComplexFactory.h"
 #include "AttributeManager.h"
+#include "ExecutionPolicy.h"
 
 #include <BOPAlgo_MakerVolume.hxx>
 #include <BOPTools_AlgoTools.hxx>
@@ -37,6 +38,8 @@
 #include <TopoDS.hxx>
 #include <TopoDS_FrozenShape.hxx>
 #include <TopoDS_UnCompatibleShapes.hxx>
+#include <TopExp.hxx>
+#include <TopTools_IndexedDataMapOfShapeListOfShape.hxx>
 #include <TopTools_MapOfShape.hxx>
 
 #include <assert.h>
@@ -166,7 +169,7 @@ namespace TopologicCore
 		return pCellComplex->GetOcctCompSolid();
 	}
 
-	CellComplex::Ptr CellComplex::ByFaces(const std::list<Face::Ptr>& rkFaces, const double kTolerance, const bool kCopyAttributes)
+	CellComplex::Ptr CellComplex::ByFaces(const std::list<Face::Ptr>& rkFaces, const double kTolerance, const bool kCopyAttributes, const BooleanOptions& rkOptions)
 	{
 		BOPAlgo_MakerVolume occtMakerVolume;
 		TopTools_ListOfShape occtShapes;
@@ -174,14 +177,15 @@ namespace TopologicCore
 		{
 			occtShapes.Append(kpFace->GetOcctShape());
 		}
-		bool isParallel = false; 
 		bool doesIntersection = true; 
 
 		occtMakerVolume.SetArguments(occtShapes);
-		occtMakerVolume.SetRunParallel(isParallel);
+		ExecutionPolicy::GetInstance().Apply(occtMakerVolume);
 		occtMakerVolume.SetIntersect(doesIntersection);
 		occtMakerVolume.SetFuzzyValue(kTolerance);
-		occtMakerVolume.Perform();
+		rkOptions.Apply(occtMakerVolume);
+		occtMakerVolume.Perform(ProgressMonitor::Start(rkOptions.progressMonitor, "CellComplex.ByFaces"));
+		ProgressMonitor::Check(rkOptions.progressMonitor);
 		if (occtMakerVolume.HasWarnings()) {
 			throw std::runtime_error("Warnings.");
 		}
@@ -253,6 +257,7 @@ namespace TopologicCore
 		// Do a Union
 		BOPAlgo_CellsBuilder occtCellsBuilder;
 		occtCellsBuilder.SetArguments(occtCellsBuildersArguments);
+		ExecutionPolicy::GetInstance().Apply(occtCellsBuilder);
 		occtCellsBuilder.Perform();
 
 		if (occtCellsBuilder.HasErrors())
@@ -325,6 +330,108 @@ namespace TopologicCore
 		}
 	}
 
+	void CellComplex::CellAdjacency(
+		std::vector<Cell::Ptr>& rCells,
+		std::vector<Face::Ptr>& rSharedFaces,
+		std::vector<int>& rAdjacencyOffsets,
+		std::vector<int>& rAdjacentCellIndices,
+		std::vector<int>& rSharedFaceIndices) const
+	{
+		TopTools_IndexedMapOfShape occtCells;
+		TopTools_IndexedMapOfShape occtSharedFaces;
+		CellAdjacency(GetOcctShape(), occtCells, occtSharedFaces, rAdjacencyOffsets, rAdjacentCellIndices, rSharedFaceIndices);
+
+		rCells.clear();
+		rCells.reserve(occtCells.Extent());
+		for (int i = 1; i <= occtCells.Extent(); ++i)
+		{
+			rCells.push_back(std::make_shared<Cell>(TopoDS::Solid(occtCells(i))));
+		}
+
+		rSharedFaces.clear();
+		rSharedFaces.reserve(occtSharedFaces.Extent());
+		for (int i = 1; i <= occtSharedFaces.Extent(); ++i)
+		{
+			rSharedFaces.push_back(std::make_shared<Face>(TopoDS::Face(occtSharedFaces(i))));
+		}
+	}
+
+	void CellComplex::CellAdjacency(
+		const TopoDS_Shape& rkOcctShape,
+		TopTools_IndexedMapOfShape& rOcctCells,
+		TopTools_IndexedMapOfShape& rOcctSharedFaces,
+		std::vector<int>& rAdjacencyOffsets,
+		std::vector<int>& rAdjacentCellIndices,
+		std::vector<int>& rSharedFaceIndices)
+	{
+		rOcctCells.Clear();
+		rOcctSharedFaces.Clear();
+		rAdjacentCellIndices.clear();
+		rSharedFaceIndices.clear();
+
+		TopExp::MapShapes(rkOcctShape, TopAbs_SOLID, rOcctCells);
+		const int kNumOfCells = rOcctCells.Extent();
+		rAdjacencyOffsets.assign(kNumOfCells + 1, 0);
+
+		// Get a map of Face->Solid[] once for the whole shape.
+		TopTools_IndexedDataMapOfShapeListOfShape occtFaceSolidMap;
+		TopExp::MapShapesAndUniqueAncestors(rkOcctShape, TopAbs_FACE, TopAbs_SOLID, occtFaceSolidMap);
+
+		// Keep the Faces shared by at least two Solids, together with the indices of these Solids,
+		// and count the number of entries per Solid.
+		std::vector<int> faceCellOffsets(1, 0);
+		std::vector<int> faceCellIndices;
+		for (int i = 1; i <= occtFaceSolidMap.Extent(); ++i)
+		{
+			const TopTools_ListOfShape& rkOcctIncidentSolids = occtFaceSolidMap(i);
+			const int kNumOfIncidentSolids = rkOcctIncidentSolids.Extent();
+			if (kNumOfIncidentSolids < 2)
+			{
+				continue;
+			}
+
+			rOcctSharedFaces.Add(occtFaceSolidMap.FindKey(i));
+			for (TopTools_ListIteratorOfListOfShape occtSolidIterator(rkOcctIncidentSolids);
+				occtSolidIterator.More();
+				occtSolidIterator.Next())
+			{
+				const int kCellIndex = rOcctCells.FindIndex(occtSolidIterator.Value()) - 1;
+				assert(kCellIndex >= 0 && "An incident Solid is not found in the shape.");
+				faceCellIndices.push_back(kCellIndex);
+				rAdjacencyOffsets[kCellIndex + 1] += kNumOfIncidentSolids - 1;
+			}
+			faceCellOffsets.push_back((int)faceCellIndices.size());
+		}
+
+		for (int i = 0; i < kNumOfCells; ++i)
+		{
+			rAdjacencyOffsets[i + 1] += rAdjacencyOffsets[i];
+		}
+
+		// Fill the entries. A Face shared by n Solids connects each of them to the other n - 1.
+		rAdjacentCellIndices.resize(rAdjacencyOffsets[kNumOfCells]);
+		rSharedFaceIndices.resize(rAdjacencyOffsets[kNumOfCells]);
+		std::vector<int> nextEntries(rAdjacencyOffsets.begin(), rAdjacencyOffsets.end() - 1);
+		const int kNumOfSharedFaces = (int)faceCellOffsets.size() - 1;
+		for (int faceIndex = 0; faceIndex < kNumOfSharedFaces; ++faceIndex)
+		{
+			for (int i = faceCellOffsets[faceIndex]; i < faceCellOffsets[faceIndex + 1]; ++i)
+			{
+				for (int j = faceCellOffsets[faceIndex]; j < faceCellOffsets[faceIndex + 1]; ++j)
+				{
+					if (i == j)
+					{
+						continue;
+					}
+
+					const int kEntry = nextEntries[faceCellIndices[i]]++;
+					rAdjacentCellIndices[kEntry] = faceCellIndices[j];
+					rSharedFaceIndices[kEntry] = faceIndex;
+				}
+			}
+		}
+	}
+
 	bool CellComplex::IsManifold(const Topology::Ptr& kpHostTopology) const
 	{
 		// throw std::runtime_error("Not implemented yet");
@@ -399,6 +506,11 @@ namespace TopologicCore
 
 	TopoDS_CompSolid CellComplex::OcctShapeFix(const TopoDS_CompSolid & rkOcctInputCompSolid)
 	{
+		if (ExecutionPolicy::GetInstance().GetTrustInput())
+		{
+			return rkOcctInputCompSolid;
+		}
+
 		ShapeFix_Shape occtCompSolidFix(rkOcctInputCompSolid);
 		occtCompSolidFix.Perform();
 		return TopoDS::CompSolid(occtCompSolidFix.Shape());
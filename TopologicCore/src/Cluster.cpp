@@ -24,6 +24,7 @@
 #include "Shell.h"
 #include "ClusterFactory.h"
 #include "AttributeManager.h"
+#include "TopologyIndexManager.h"
 
 #include <BRepBuilderAPI_MakeVertex.hxx>
 #include <Geom_CartesianPoint.hxx>
@@ -42,14 +43,25 @@ namespace TopologicCore
 			return nullptr;
 		}
 
+		// The compound is new, so it is filled directly instead of by AddTopology, which records the in-place edits.
 		TopoDS_Compound occtCompound;
 		TopoDS_Builder occtBuilder;
 		occtBuilder.MakeCompound(occtCompound);
-		Cluster::Ptr pCluster = std::make_shared<Cluster>(occtCompound);
 		for(const Topology::Ptr& kpTopology : rkTopologies)
 		{
-			pCluster->AddTopology(kpTopology.get());
+			try {
+				occtBuilder.Add(occtCompound, kpTopology->GetOcctShape());
+			}
+			catch (TopoDS_UnCompatibleShapes &)
+			{
+				continue;
+			}
+			catch (TopoDS_FrozenShape &)
+			{
+				continue;
+			}
 		}
+		Cluster::Ptr pCluster = std::make_shared<Cluster>(occtCompound);
 
 		// Transfer the attributes
 		if (kCopyAttributes)
@@ -104,6 +116,12 @@ namespace TopologicCore
 			returnValue = false;
 		}
 
+		if (returnValue)
+		{
+			// The compound is edited in place, so only the added Topology needs to be indexed.
+			TopologyIndexManager::GetInstance().AddMember(GetOcctShape(), kpkTopology->GetOcctShape());
+		}
+
 		return returnValue;
 	}
 
@@ -111,6 +129,7 @@ namespace TopologicCore
 	{
 		try {
 			m_occtBuilder.Remove(GetOcctShape(), kpkTopology->GetOcctShape());
+			TopologyIndexManager::GetInstance().RemoveMember(GetOcctShape(), kpkTopology->GetOcctShape());
 
 			return true;
 		}
@@ -181,7 +200,8 @@ namespace TopologicCore
 
 	Cluster::~Cluster()
 	{
-
+		// Only the Clusters edited in place have entries; they are removed with the Cluster.
+		TopologyIndexManager::GetInstance().ClearOne(GetOcctShape());
 	}
 
 	void Cluster::Shells(const Topology::Ptr& kpHostTopology, std::list<Shell::Ptr>& rShells) const
@@ -36,51 +36,73 @@ namespace TopologicCore
 
 	void ContentManager::Remove(const TopoDS_Shape& rkOcctShape, const TopoDS_Shape& rkOcctContentTopology)
 	{
-		if (m_occtShapeToContentsMap.find(rkOcctShape) != m_occtShapeToContentsMap.end())
+		std::map<TopoDS_Shape, std::list<Topology::Ptr>, OcctShapeComparator>::iterator occtShapeIterator = m_occtShapeToContentsMap.find(rkOcctShape);
+		if (occtShapeIterator != m_occtShapeToContentsMap.end())
 		{
-			m_occtShapeToContentsMap[rkOcctShape].remove_if(
+			occtShapeIterator->second.remove_if(
 				[&](const Topology::Ptr& kpContent) {
 				return kpContent->GetOcctShape().IsSame(rkOcctContentTopology);
 			});
+
+			// Keep only the shapes which still have contents.
+			if (occtShapeIterator->second.empty())
+			{
+				m_occtShapeToContentsMap.erase(occtShapeIterator);
+			}
 		}
 	}
 
 	bool ContentManager::Find(const TopoDS_Shape& rkOcctShape, std::list<std::shared_ptr<Topology>>& rContents)
 	{
-		if (m_occtShapeToContentsMap.find(rkOcctShape) != m_occtShapeToContentsMap.end())
+		std::map<TopoDS_Shape, std::list<Topology::Ptr>, OcctShapeComparator>::const_iterator occtShapeIterator = m_occtShapeToContentsMap.find(rkOcctShape);
+		if (occtShapeIterator != m_occtShapeToContentsMap.end())
 		{
-			std::list<Topology::Ptr> contents = m_occtShapeToContentsMap[rkOcctShape];
-			rContents.insert(rContents.end(), contents.begin(), contents.end());
+			rContents.insert(rContents.end(), occtShapeIterator->second.begin(), occtShapeIterator->second.end());
 			return true;
 		}
 
 		return false;
 	}
 
-	bool ContentManager::HasContent(const TopoDS_Shape & rkOcctShape, const TopoDS_Shape& rkOcctContentTopology)
+	const std::list<std::shared_ptr<Topology>>& ContentManager::Find(const TopoDS_Shape& rkOcctShape) const
+	{
+		static const std::list<Topology::Ptr> kEmptyContents;
+		std::map<TopoDS_Shape, std::list<Topology::Ptr>, OcctShapeComparator>::const_iterator occtShapeIterator = m_occtShapeToContentsMap.find(rkOcctShape);
+		if (occtShapeIterator == m_occtShapeToContentsMap.end())
+		{
+			return kEmptyContents;
+		}
+
+		return occtShapeIterator->second;
+	}
+
+	void ContentManager::ShapesWithContents(TopTools_ListOfShape& rOcctShapes) const
 	{
-		std::list<Topology::Ptr> contents;
-		bool hasContents = Find(rkOcctShape, contents);
-		if (!hasContents)
+		for (const std::pair<const TopoDS_Shape, std::list<Topology::Ptr>>& rkShapeContentsPair : m_occtShapeToContentsMap)
 		{
-			return false;
+			rOcctShapes.Append(rkShapeContentsPair.first);
 		}
+	}
+
+	bool ContentManager::IsEmpty() const
+	{
+		return m_occtShapeToContentsMap.empty();
+	}
 
-		std::list<Topology::Ptr>::iterator contentIterator = std::find_if(contents.begin(), contents.end(), 
+	bool ContentManager::HasContent(const TopoDS_Shape & rkOcctShape, const TopoDS_Shape& rkOcctContentTopology)
+	{
+		const std::list<Topology::Ptr>& rkContents = Find(rkOcctShape);
+		std::list<Topology::Ptr>::const_iterator contentIterator = std::find_if(rkContents.begin(), rkContents.end(),
 			[&](const Topology::Ptr& kpContent) { 
 			return kpContent->GetOcctShape().IsSame(rkOcctContentTopology);
 		});
 
-		return contentIterator != contents.end();
+		return contentIterator != rkContents.end();
 	}
 
 	void ContentManager::ClearOne(const TopoDS_Shape & rkOcctShape)
 	{
-		if (m_occtShapeToContentsMap.find(rkOcctShape) != m_occtShapeToContentsMap.end())
-		{
-			m_occtShapeToContentsMap[rkOcctShape].clear();
-			m_occtShapeToContentsMap.erase(rkOcctShape);
-		}
+		m_occtShapeToContentsMap.erase(rkOcctShape);
 	}
 
 	void ContentManager::ClearAll()
@@ -33,34 +33,49 @@ namespace TopologicCore
 
 	void ContextManager::Remove(const TopoDS_Shape& rkOcctShape, const TopoDS_Shape& rkOcctContextShape)
 	{
-		if (m_occtShapeToContextsMap.find(rkOcctShape) != m_occtShapeToContextsMap.end())
+		std::map<TopoDS_Shape, std::list<Context::Ptr>, OcctShapeComparator>::iterator occtShapeIterator = m_occtShapeToContextsMap.find(rkOcctShape);
+		if (occtShapeIterator != m_occtShapeToContextsMap.end())
 		{
-			m_occtShapeToContextsMap[rkOcctShape].remove_if(
+			occtShapeIterator->second.remove_if(
 				[&](const Context::Ptr& kpContext) { 
 				return kpContext->Topology()->GetOcctShape().IsSame(rkOcctContextShape);
 			});
+
+			// Keep only the shapes which still have Contexts.
+			if (occtShapeIterator->second.empty())
+			{
+				m_occtShapeToContextsMap.erase(occtShapeIterator);
+			}
 		}
 	}
 
 	bool ContextManager::Find(const TopoDS_Shape& rkOcctShape, std::list<std::shared_ptr<Context>>& rContents)
 	{
-		if (m_occtShapeToContextsMap.find(rkOcctShape) != m_occtShapeToContextsMap.end())
+		std::map<TopoDS_Shape, std::list<Context::Ptr>, OcctShapeComparator>::const_iterator occtShapeIterator = m_occtShapeToContextsMap.find(rkOcctShape);
+		if (occtShapeIterator != m_occtShapeToContextsMap.end())
 		{
-			std::list<Context::Ptr> contents = m_occtShapeToContextsMap[rkOcctShape];
-			rContents.insert(rContents.end(), contents.begin(), contents.end());
+			rContents.insert(rContents.end(), occtShapeIterator->second.begin(), occtShapeIterator->second.end());
 			return true;
 		}
 
 		return false;
 	}
 
-	void ContextManager::ClearOne(const TopoDS_Shape & rkOcctShape)
+	const std::list<std::shared_ptr<Context>>& ContextManager::Find(const TopoDS_Shape& rkOcctShape) const
 	{
-		if (m_occtShapeToContextsMap.find(rkOcctShape) != m_occtShapeToContextsMap.end())
+		static const std::list<Context::Ptr> kEmptyContexts;
+		std::map<TopoDS_Shape, std::list<Context::Ptr>, OcctShapeComparator>::const_iterator occtShapeIterator = m_occtShapeToContextsMap.find(rkOcctShape);
+		if (occtShapeIterator == m_occtShapeToContextsMap.end())
 		{
-			m_occtShapeToContextsMap[rkOcctShape].clear();
-			m_occtShapeToContextsMap.erase(rkOcctShape);
+			return kEmptyContexts;
 		}
+
+		return occtShapeIterator->second;
+	}
+
+	void ContextManager::ClearOne(const TopoDS_Shape & rkOcctShape)
+	{
+		m_occtShapeToContextsMap.erase(rkOcctShape);
 	}
 
 	void ContextManager::ClearAll()
@@ -22,6 +22,7 @@
 #include "Cell.h"
 #include "CellComplex.h"
 #include "EdgeFactory.h"
+#include "ExecutionPolicy.h"
 #include "Cluster.h"
 #include "AttributeManager.h"
 
@@ -102,6 +103,13 @@ namespace TopologicCore
 		rVertices.push_back(EndVertex());
 	}
 
+	void Edge::Vertices(const Topology::Ptr& kpHostTopology, std::vector<Vertex::Ptr>& rVertices) const
+	{
+		rVertices.reserve(rVertices.size() + 2);
+		rVertices.push_back(StartVertex());
+		rVertices.push_back(EndVertex());
+	}
+
 	void Edge::Wires(const Topology::Ptr& kpHostTopology, std::list<Wire::Ptr>& rWires) const
 	{
 		if (kpHostTopology)
@@ -210,28 +218,13 @@ namespace TopologicCore
 
 	void Edge::SharedVertices(const Edge::Ptr& kpAnotherEdge, std::list<std::shared_ptr<Vertex>>& rSharedVertices) const
 	{
-		const TopoDS_Shape& rkOcctShape1 = GetOcctShape();
-		TopTools_MapOfShape occtVertices1;
-		DownwardNavigation(rkOcctShape1, TopAbs_VERTEX, occtVertices1);
-
-		const TopoDS_Shape& rkOcctShape2 = kpAnotherEdge->GetOcctShape();
-		TopTools_MapOfShape occtVertices2;
-		DownwardNavigation(rkOcctShape2, TopAbs_VERTEX, occtVertices2);
-
-		for (TopTools_MapIteratorOfMapOfShape occtVertexIterator1(occtVertices1);
-			occtVertexIterator1.More();
-			occtVertexIterator1.Next())
+		TopTools_ListOfShape occtSharedMembers;
+		SharedMembers(GetOcctShape(), kpAnotherEdge->GetOcctShape(), TopAbs_VERTEX, occtSharedMembers);
+		for (TopTools_ListIteratorOfListOfShape occtMemberIterator(occtSharedMembers);
+			occtMemberIterator.More();
+			occtMemberIterator.Next())
 		{
-			for (TopTools_MapIteratorOfMapOfShape occtVertexIterator2(occtVertices2);
-				occtVertexIterator2.More();
-				occtVertexIterator2.Next())
-			{
-				if (occtVertexIterator1.Value().IsSame(occtVertexIterator2.Value()))
-				{
-					Vertex::Ptr pVertex = std::make_shared<Vertex>(TopoDS::Vertex(occtVertexIterator1.Value()));
-					rSharedVertices.push_back(pVertex);
-				}
-			}
+			rSharedVertices.push_back(std::make_shared<Vertex>(TopoDS::Vertex(occtMemberIterator.Value())));
 		}
 	}
 
@@ -418,6 +411,11 @@ namespace TopologicCore
 
 	TopoDS_Edge Edge::OcctShapeFix(const TopoDS_Edge& rkOcctInputEdge)
 	{
+		if (ExecutionPolicy::GetInstance().GetTrustInput())
+		{
+			return rkOcctInputEdge;
+		}
+
 		ShapeFix_Shape occtEdgeFix(rkOcctInputEdge);
 		occtEdgeFix.Perform();
 		return TopoDS::Edge(occtEdgeFix.Shape());
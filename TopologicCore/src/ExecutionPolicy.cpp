@@ -0,0 +1,84 @@
+// This file is part of Topologic software library.
+// Copyright(C) 2019, Cardiff University and University College London
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+#include "ExecutionPolicy.h"
+
+#include <OSD_Parallel.hxx>
+#include <OSD_ThreadPool.hxx>
+
+namespace TopologicCore
+{
+	ExecutionPolicy::ExecutionPolicy()
+		: m_runParallel(false)
+		, m_numberOfThreads(OSD_Parallel::NbLogicalProcessors())
+		, m_trustInput(false)
+	{
+
+	}
+
+	void ExecutionPolicy::SetRunParallel(const bool kRunParallel)
+	{
+		m_runParallel = kRunParallel;
+	}
+
+	bool ExecutionPolicy::GetRunParallel() const
+	{
+		return m_runParallel;
+	}
+
+	void ExecutionPolicy::SetNumberOfThreads(const int kNumberOfThreads)
+	{
+		if (kNumberOfThreads > 0)
+		{
+			// The size of the default thread pool is only honoured when OSD_Parallel uses it instead of TBB.
+			OSD_Parallel::SetUseOcctThreads(true);
+		}
+
+		int numberOfThreads = kNumberOfThreads > 0 ? kNumberOfThreads : OSD_Parallel::NbLogicalProcessors();
+		OSD_ThreadPool::DefaultPool()->Init(numberOfThreads);
+		m_numberOfThreads = numberOfThreads;
+	}
+
+	int ExecutionPolicy::GetNumberOfThreads() const
+	{
+		return m_numberOfThreads;
+	}
+
+	void ExecutionPolicy::SetUseOcctThreads(const bool kUseOcctThreads)
+	{
+		OSD_Parallel::SetUseOcctThreads(kUseOcctThreads);
+	}
+
+	bool ExecutionPolicy::GetUseOcctThreads() const
+	{
+		return OSD_Parallel::ToUseOcctThreads();
+	}
+
+	void ExecutionPolicy::Apply(BOPAlgo_Options& rOcctAlgorithm) const
+	{
+		rOcctAlgorithm.SetRunParallel(m_runParallel);
+	}
+
+	void ExecutionPolicy::SetTrustInput(const bool kTrustInput)
+	{
+		m_trustInput = kTrustInput;
+	}
+
+	bool ExecutionPolicy::GetTrustInput() const
+	{
+		return m_trustInput;
+	}
+}
@@ -20,6 +20,7 @@
 #include "Shell.h"
 #include "Vertex.h"
 #include "Wire.h"
+#include "ExecutionPolicy.h"
 #include "FaceFactory.h"
 #include "Utilities.h"
 #include "AttributeManager.h"
@@ -286,6 +287,10 @@ namespace TopologicCore
 		{
 			Throw(occtMakeFace);
 		}
+		if (ExecutionPolicy::GetInstance().GetTrustInput())
+		{
+			return std::make_shared<Face>(occtMakeFace.Face());
+		}
 		ShapeFix_Face occtShapeFix(occtMakeFace);
 		occtShapeFix.Perform();
 		Face::Ptr pFace = std::make_shared<Face>(TopoDS::Face(occtShapeFix.Result()));
@@ -458,6 +463,11 @@ namespace TopologicCore
 			area = TopologicUtilities::FaceUtility::Area(occtShapeFix2.Face());
 		}
 
+		if (ExecutionPolicy::GetInstance().GetTrustInput())
+		{
+			return std::make_shared<Face>(occtMakeFace.Face());
+		}
+
 		ShapeFix_Face occtShapeFix(occtMakeFace);
 		occtShapeFix.Perform();
 
@@ -467,69 +477,25 @@ namespace TopologicCore
 
 	void Face::SharedEdges(const Face::Ptr& kpAnotherFace, std::list<Edge::Ptr>& rEdges) const
 	{
-		const TopoDS_Shape& rkOcctShape1 = GetOcctShape();
-		TopTools_ListOfShape occtEdges1;
-		for (TopExp_Explorer occtExplorer(rkOcctShape1, TopAbs_EDGE); occtExplorer.More(); occtExplorer.Next())
-		{
-			const TopoDS_Shape& occtCurrent = occtExplorer.Current();
-			if (!occtEdges1.Contains(occtCurrent))
-			{
-				occtEdges1.Append(occtCurrent);
-			}
-		}
-
-		const TopoDS_Shape& rkOcctShape2 = kpAnotherFace->GetOcctShape();
-		TopTools_ListOfShape occtEdges2;
-		for (TopExp_Explorer occtExplorer(rkOcctShape2, TopAbs_EDGE); occtExplorer.More(); occtExplorer.Next())
-		{
-			const TopoDS_Shape& occtCurrent = occtExplorer.Current();
-			if (!occtEdges2.Contains(occtCurrent))
-			{
-				occtEdges2.Append(occtCurrent);
-			}
-		}
-
-		for (TopTools_ListIteratorOfListOfShape occtEdgeIterator1(occtEdges1);
-			occtEdgeIterator1.More();
-			occtEdgeIterator1.Next())
+		TopTools_ListOfShape occtSharedMembers;
+		SharedMembers(GetOcctShape(), kpAnotherFace->GetOcctShape(), TopAbs_EDGE, occtSharedMembers);
+		for (TopTools_ListIteratorOfListOfShape occtMemberIterator(occtSharedMembers);
+			occtMemberIterator.More();
+			occtMemberIterator.Next())
 		{
-			for (TopTools_ListIteratorOfListOfShape occtEdgeIterator2(occtEdges2);
-				occtEdgeIterator2.More();
-				occtEdgeIterator2.Next())
-			{
-				if (occtEdgeIterator1.Value().IsSame(occtEdgeIterator2.Value()))
-				{
-					Edge::Ptr pEdge = std::make_shared<Edge>(TopoDS::Edge(occtEdgeIterator1.Value()));
-					rEdges.push_back(pEdge);
-				}
-			}
+			rEdges.push_back(std::make_shared<Edge>(TopoDS::Edge(occtMemberIterator.Value())));
 		}
 	}
 
 	void Face::SharedVertices(const Face::Ptr& kpAnotherFace, std::list<Vertex::Ptr>& rVertices) const
 	{
-		const TopoDS_Shape& rkOcctShape1 = GetOcctShape();
-		TopTools_MapOfShape occtVertices1;
-		DownwardNavigation(rkOcctShape1, TopAbs_VERTEX, occtVertices1);
-
-		const TopoDS_Shape& rkOcctShape2 = kpAnotherFace->GetOcctShape();
-		TopTools_MapOfShape occtVertices2;
-		DownwardNavigation(rkOcctShape2, TopAbs_VERTEX, occtVertices2);
-
-		for (TopTools_MapIteratorOfMapOfShape occtVertexIterator1(occtVertices1);
-			occtVertexIterator1.More();
-			occtVertexIterator1.Next())
+		TopTools_ListOfShape occtSharedMembers;
+		SharedMembers(GetOcctShape(), kpAnotherFace->GetOcctShape(), TopAbs_VERTEX, occtSharedMembers);
+		for (TopTools_ListIteratorOfListOfShape occtMemberIterator(occtSharedMembers);
+			occtMemberIterator.More();
+			occtMemberIterator.Next())
 		{
-			for (TopTools_MapIteratorOfMapOfShape occtVertexIterator2(occtVertices2);
-				occtVertexIterator2.More();
-				occtVertexIterator2.Next())
-			{
-				if (occtVertexIterator1.Value().IsSame(occtVertexIterator2.Value()))
-				{
-					Vertex::Ptr pVertex = std::make_shared<Vertex>(TopoDS::Vertex(occtVertexIterator1.Value()));
-					rVertices.push_back(pVertex);
-				}
-			}
+			rVertices.push_back(std::make_shared<Vertex>(TopoDS::Vertex(occtMemberIterator.Value())));
 		}
 	}
 
@@ -639,6 +605,11 @@ namespace TopologicCore
 
 	TopoDS_Face Face::OcctShapeFix(const TopoDS_Face & rkOcctInputFace)
 	{
+		if (ExecutionPolicy::GetInstance().GetTrustInput())
+		{
+			return rkOcctInputFace;
+		}
+
 		ShapeFix_Face occtShapeFix(rkOcctInputFace);
 		occtShapeFix.Perform();
 		return TopoDS::Face(rkOcctInputFace);
@@ -26,6 +26,7 @@
 #include "DoubleAttribute.h"
 #include "IntAttribute.h"
 #include "AttributeManager.h"
+#include "ExecutionPolicy.h"
 
 #include <Utilities/EdgeUtility.h>
 #include <Utilities/FaceUtility.h>
@@ -34,19 +35,140 @@
 
 #include <BRepBuilderAPI_MakeVertex.hxx>
 #include <BRepExtrema_DistShapeShape.hxx>
-#include <ShapeAnalysis_Edge.hxx>
 #include <TopoDS.hxx>
+#include <TopExp.hxx>
 #include <TopTools_DataMapOfShapeListOfShape.hxx>
+#include <TopTools_IndexedDataMapOfShapeListOfShape.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
 #include <Geom_CartesianPoint.hxx>
 #include <BRep_Tool.hxx>
+#include <OSD_Parallel.hxx>
 
 #include <algorithm>
 #include <assert.h>
+#include <cmath>
 #include <numeric>
-#include <queue>
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <vector>
 
 namespace TopologicCore
 {
+	/// <summary>
+	/// An indexed 4-ary min-heap of Vertex IDs, ordered by their distances. Pushing a Vertex which is already in the
+	/// heap decreases its distance.
+	/// </summary>
+	class VertexHeap
+	{
+	public:
+		VertexHeap(const int kNumOfVertices)
+			: m_positions(kNumOfVertices, -1)
+		{
+
+		}
+
+		bool IsEmpty() const
+		{
+			return m_entries.empty();
+		}
+
+		void Push(const int kVertexId, const double kDistance)
+		{
+			int position = m_positions[kVertexId];
+			if (position < 0)
+			{
+				position = (int)m_entries.size();
+				m_entries.push_back(std::make_pair(kDistance, kVertexId));
+			}
+			else
+			{
+				m_entries[position].first = kDistance;
+			}
+			SiftUp(position);
+		}
+
+		int Pop()
+		{
+			int vertexId = m_entries.front().second;
+			m_positions[vertexId] = -1;
+			m_entries.front() = m_entries.back();
+			m_entries.pop_back();
+			if (!m_entries.empty())
+			{
+				SiftDown(0);
+			}
+			return vertexId;
+		}
+
+	protected:
+		void SiftUp(int position)
+		{
+			std::pair<double, int> entry = m_entries[position];
+			while (position > 0)
+			{
+				int parentPosition = (position - 1) / ARITY;
+				if (m_entries[parentPosition].first <= entry.first)
+				{
+					break;
+				}
+				Place(position, m_entries[parentPosition]);
+				position = parentPosition;
+			}
+			Place(position, entry);
+		}
+
+		void SiftDown(int position)
+		{
+			std::pair<double, int> entry = m_entries[position];
+			const int kNumOfEntries = (int)m_entries.size();
+			while (true)
+			{
+				int firstChildPosition = ARITY * position + 1;
+				if (firstChildPosition >= kNumOfEntries)
+				{
+					break;
+				}
+
+				int minChildPosition = firstChildPosition;
+				int endChildPosition = std::min(firstChildPosition + ARITY, kNumOfEntries);
+				for (int childPosition = firstChildPosition + 1; childPosition < endChildPosition; ++childPosition)
+				{
+					if (m_entries[childPosition].first < m_entries[minChildPosition].first)
+					{
+						minChildPosition = childPosition;
+					}
+				}
+
+				if (entry.first <= m_entries[minChildPosition].first)
+				{
+					break;
+				}
+				Place(position, m_entries[minChildPosition]);
+				position = minChildPosition;
+			}
+			Place(position, entry);
+		}
+
+		void Place(const int kPosition, const std::pair<double, int>& rkEntry)
+		{
+			m_entries[kPosition] = rkEntry;
+			m_positions[rkEntry.second] = kPosition;
+		}
+
+		static const int ARITY = 4;
+
+		/// <summary>
+		/// The distances and IDs of the Vertices in the heap
+		/// </summary>
+		std::vector<std::pair<double, int>> m_entries;
+
+		/// <summary>
+		/// The position of each Vertex in m_entries, -1 if it is not in the heap
+		/// </summary>
+		std::vector<int> m_positions;
+	};
+
 	Graph::Ptr Graph::ByVerticesEdges(const std::list<Vertex::Ptr>& rkVertices, const std::list<Edge::Ptr>& rkEdges)
 	{
 		return std::make_shared<Graph>(rkVertices, rkEdges);
@@ -60,8 +182,10 @@ namespace TopologicCore
 		const bool kToExteriorTopologies,
 		const bool kToExteriorApertures,
 		const bool kUseFaceInternalVertex,
-		const double kTolerance)
+		const double kTolerance,
+		const ProgressMonitor::Ptr& kpProgressMonitor)
 	{
+		ProgressMonitor::Check(kpProgressMonitor);
 		switch (topology->GetType())
 		{
 		case TOPOLOGY_VERTEX: return Graph::ByVertex(std::dynamic_pointer_cast<Vertex>(topology), kToExteriorApertures, kUseFaceInternalVertex, kTolerance);
@@ -85,7 +209,8 @@ namespace TopologicCore
 			kToExteriorTopologies,
 			kToExteriorApertures,
 			kUseFaceInternalVertex,
-			kTolerance);
+			kTolerance,
+			kpProgressMonitor);
 		case TOPOLOGY_CLUSTER: return Graph::ByCluster(std::dynamic_pointer_cast<Cluster>(topology),
 			kDirect,
 			kViaSharedTopologies,
@@ -93,7 +218,8 @@ namespace TopologicCore
 			kToExteriorTopologies,
 			kToExteriorApertures,
 			kUseFaceInternalVertex,
-			kTolerance);
+			kTolerance,
+			kpProgressMonitor);
 
 		case TOPOLOGY_APERTURE:
 			return Graph::ByTopology(
@@ -104,7 +230,8 @@ namespace TopologicCore
 				kToExteriorTopologies,
 				kToExteriorApertures,
 				kUseFaceInternalVertex,
-				kTolerance);
+				kTolerance,
+				kpProgressMonitor);
 		default:
 			// throw std::runtime_error("Fails to create a graph due to an unknown type of topology.");
 			Graph::Ptr nullGraph = nullptr;
@@ -113,6 +240,8 @@ namespace TopologicCore
 	}
 
 	Graph::Graph(const std::list<Vertex::Ptr>& rkVertices, const std::list<Edge::Ptr>& rkEdges)
+		: m_vertexGridCellSize(0.0001)
+		, m_isCompactAdjacencyValid(false)
 	{
 		// 1. Add the vertices
 		AddVertices(rkVertices, 0.0001);
@@ -125,15 +254,23 @@ namespace TopologicCore
 	}
 
 	Graph::Graph(const Graph* kpAnotherGraph)
-		: m_graphDictionary(kpAnotherGraph->m_graphDictionary)
+		: m_occtVertices(kpAnotherGraph->m_occtVertices)
+		, m_vertexCoordinates(kpAnotherGraph->m_vertexCoordinates)
+		, m_occtVertexIds(kpAnotherGraph->m_occtVertexIds)
+		, m_adjacency(kpAnotherGraph->m_adjacency)
 		, m_occtEdges(kpAnotherGraph->m_occtEdges)
+		, m_edgeVertexIds(kpAnotherGraph->m_edgeVertexIds)
+		, m_edgeLengths(kpAnotherGraph->m_edgeLengths)
+		, m_edgeIds(kpAnotherGraph->m_edgeIds)
+		, m_vertexGrid(kpAnotherGraph->m_vertexGrid)
+		, m_vertexGridCellSize(kpAnotherGraph->m_vertexGridCellSize)
+		, m_isCompactAdjacencyValid(false)
 		, m_guid(TopologicUtilities::newGuid().str())
 	{
 	}
 
 	Graph::~Graph()
 	{
-		m_graphDictionary.clear();
 	}
 
 	Topology::Ptr Graph::Topology() const
@@ -145,59 +282,21 @@ namespace TopologicCore
 		// For a loop: circle, radius/diameter/circumference = average of the edge lengths
 
 		std::list<Topology::Ptr> topologies;
-		GraphMap processedAdjacency;
-		for (const std::pair<TopoDS_Vertex, TopTools_MapOfShape>& rkDictionaryPair : m_graphDictionary)
+		for (int vertexId = 0; vertexId < (int)m_occtVertices.size(); ++vertexId)
 		{
-			TopoDS_Vertex occtVertex1 = rkDictionaryPair.first;
-			Vertex::Ptr vertex1 = std::dynamic_pointer_cast<Vertex>(Topology::ByOcctShape(occtVertex1));
-			if (rkDictionaryPair.second.Size() == 0)
+			if (m_adjacency[vertexId].empty())
 			{
 				// Just add the vertex
-				topologies.push_back(vertex1);
-				processedAdjacency.insert(std::make_pair(occtVertex1, TopTools_MapOfShape()));
+				topologies.push_back(GetVertex(vertexId));
+				continue;
 			}
-			else
+
+			// Add each edge at its vertex with the lower ID
+			for (const std::pair<int, int>& rkAdjacency : m_adjacency[vertexId])
 			{
-				// Create edges
-				for (TopTools_MapIteratorOfMapOfShape mapIterator(rkDictionaryPair.second);
-					mapIterator.More();
-					mapIterator.Next())
+				if (rkAdjacency.first >= vertexId)
 				{
-					TopoDS_Shape occtVertex2 = mapIterator.Value();
-					Vertex::Ptr vertex2 = std::dynamic_pointer_cast<Vertex>(Topology::ByOcctShape(occtVertex2));
-
-					GraphMap::iterator vertex1Iterator = processedAdjacency.find(occtVertex1);
-					if (vertex1Iterator != processedAdjacency.end())
-					{
-						if (vertex1Iterator->second.Contains(occtVertex2))
-						{
-							continue;
-						}
-					}
-
-					GraphMap::iterator vertex2Iterator = processedAdjacency.find(TopoDS::Vertex(occtVertex2));
-					if (vertex2Iterator != processedAdjacency.end())
-					{
-						if (vertex2Iterator->second.Contains(occtVertex1))
-						{
-							continue;
-						}
-					}
-
-					/*Edge::Ptr edge = Edge::ByStartVertexEndVertex(vertex1, vertex2);
-					topologies.push_back(edge);*/
-
-					TopoDS_Edge occtEdge = FindEdge(vertex1->GetOcctVertex(), vertex2->GetOcctVertex());
-					if (occtEdge.IsNull())
-					{
-						continue;
-					}
-					//Edge::Ptr edge = Edge::ByStartVertexEndVertex(vertex1, vertex2);
-					Edge::Ptr edge = std::dynamic_pointer_cast<TopologicCore::Edge>(Topology::ByOcctShape(occtEdge));
-					topologies.push_back(edge);
-
-					processedAdjacency[vertex1->GetOcctVertex()].Add(vertex2->GetOcctVertex());
-					processedAdjacency[vertex2->GetOcctVertex()].Add(vertex1->GetOcctVertex());
+					topologies.push_back(GetEdge(rkAdjacency.second));
 				}
 			}
 		}
@@ -206,12 +305,30 @@ namespace TopologicCore
 		return cluster;
 	}
 
+	int Graph::NumberOfVertices() const
+	{
+		return (int)m_occtVertices.size();
+	}
+
+	int Graph::NumberOfEdges() const
+	{
+		return (int)m_occtEdges.size();
+	}
+
 	void Graph::Vertices(std::list<std::shared_ptr<Vertex>>& rVertices) const
 	{
-		for (const std::pair<TopoDS_Vertex, TopTools_MapOfShape>& rkDictionaryPair : m_graphDictionary)
+		for (int vertexId = 0; vertexId < (int)m_occtVertices.size(); ++vertexId)
+		{
+			rVertices.push_back(GetVertex(vertexId));
+		}
+	}
+
+	void Graph::Vertices(std::vector<std::shared_ptr<Vertex>>& rVertices) const
+	{
+		rVertices.reserve(rVertices.size() + m_occtVertices.size());
+		for (int vertexId = 0; vertexId < (int)m_occtVertices.size(); ++vertexId)
 		{
-			Vertex::Ptr vertex = std::dynamic_pointer_cast<Vertex>(Topology::ByOcctShape(rkDictionaryPair.first));
-			rVertices.push_back(vertex);
+			rVertices.push_back(GetVertex(vertexId));
 		}
 	}
 
@@ -221,102 +338,54 @@ namespace TopologicCore
 		Edges(vertices, kTolerance, rEdges);
 	}
 
+	void Graph::Edges(std::vector<std::shared_ptr<TopologicCore::Edge>>& rEdges, const double kTolerance) const
+	{
+		std::vector<Vertex::Ptr> vertices;
+		Edges(vertices, kTolerance, rEdges);
+	}
+
 	void Graph::Edges(
-		const std::list<Vertex::Ptr>& rkVertices, 
-		const double kTolerance, 
+		const std::list<Vertex::Ptr>& rkVertices,
+		const double kTolerance,
 		std::list<std::shared_ptr<TopologicCore::Edge>>& rEdges) const
+	{
+		std::vector<Vertex::Ptr> vertices(rkVertices.begin(), rkVertices.end());
+		std::vector<Edge::Ptr> edges;
+		Edges(vertices, kTolerance, edges);
+		rEdges.insert(rEdges.end(), edges.begin(), edges.end());
+	}
+
+	void Graph::Edges(
+		const std::vector<Vertex::Ptr>& rkVertices,
+		const double kTolerance,
+		std::vector<std::shared_ptr<TopologicCore::Edge>>& rEdges) const
 	{
 		if (rkVertices.empty())
 		{
-			GraphMap processedAdjacency;
-			for (const std::pair<TopoDS_Vertex, TopTools_MapOfShape>& rkDictionaryPair : m_graphDictionary)
+			rEdges.reserve(rEdges.size() + m_occtEdges.size());
+			for (int edgeId = 0; edgeId < (int)m_occtEdges.size(); ++edgeId)
 			{
-				TopoDS_Vertex occtVertex1 = rkDictionaryPair.first;
-				Vertex::Ptr vertex1 = std::dynamic_pointer_cast<Vertex>(Topology::ByOcctShape(occtVertex1));
-				// Create edges
-				for (TopTools_MapIteratorOfMapOfShape mapIterator(rkDictionaryPair.second);
-					mapIterator.More();
-					mapIterator.Next())
-				{
-					TopoDS_Shape occtVertex2 = mapIterator.Value();
-					GraphMap::iterator vertex1Iterator = processedAdjacency.find(occtVertex1);
-					if (vertex1Iterator != processedAdjacency.end())
-					{
-						if (vertex1Iterator->second.Contains(occtVertex2))
-						{
-							continue;
-						}
-					}
-
-					GraphMap::iterator vertex2Iterator = processedAdjacency.find(TopoDS::Vertex(occtVertex2));
-					if (vertex2Iterator != processedAdjacency.end())
-					{
-						if (vertex2Iterator->second.Contains(occtVertex1))
-						{
-							continue;
-						}
-					}
-
-					Topology::Ptr topology = Topology::ByOcctShape(TopoDS::Vertex(occtVertex2));
-					Vertex::Ptr vertex2 = std::dynamic_pointer_cast<Vertex>(topology);
-
-					TopoDS_Edge occtEdge = FindEdge(vertex1->GetOcctVertex(), vertex2->GetOcctVertex());
-					if (occtEdge.IsNull())
-					{
-						continue;
-					}
-					Edge::Ptr edge = std::dynamic_pointer_cast<TopologicCore::Edge>(Topology::ByOcctShape(occtEdge));
-					rEdges.push_back(edge);
-
-					processedAdjacency[vertex1->GetOcctVertex()].Add(vertex2->GetOcctVertex());
-					processedAdjacency[vertex2->GetOcctVertex()].Add(vertex1->GetOcctVertex());
-				}
+				rEdges.push_back(GetEdge(edgeId));
 			}
+			return;
 		}
-		else
-		{
-			// Different algorithm if rkVertices is not empty.
-			GraphMap processedAdjacency;
 
-			for (const Vertex::Ptr& kpVertex : rkVertices)
+		// Only the Edges incident to the Vertices, each once
+		std::vector<bool> isEdgeAdded(m_occtEdges.size(), false);
+		for (const Vertex::Ptr& kpVertex : rkVertices)
+		{
+			int vertexId = FindVertexId(kpVertex->GetOcctVertex(), kTolerance);
+			if (vertexId < 0)
 			{
-				// Get coincident edges
-				std::list<Edge::Ptr> thisIncidentEdges;
-				IncidentEdges(kpVertex, kTolerance, thisIncidentEdges);
+				continue;
+			}
 
-				// Check: is already added?
-				for (const Edge::Ptr& kpIncidentEdge : thisIncidentEdges)
+			for (const std::pair<int, int>& rkAdjacency : m_adjacency[vertexId])
+			{
+				if (!isEdgeAdded[rkAdjacency.second])
 				{
-					Vertex::Ptr startVertex = kpIncidentEdge->StartVertex();
-					Vertex::Ptr endVertex = kpIncidentEdge->EndVertex();
-
-					bool isAdded = false;
-					GraphMap::iterator vertex1Iterator = processedAdjacency.find(startVertex->GetOcctVertex());
-					if (vertex1Iterator != processedAdjacency.end())
-					{
-						if (vertex1Iterator->second.Contains(endVertex->GetOcctVertex()))
-						{
-							isAdded = true;
-						}
-					}
-
-					if (!isAdded)
-					{
-						GraphMap::iterator vertex1Iterator = processedAdjacency.find(endVertex->GetOcctVertex());
-						if (vertex1Iterator != processedAdjacency.end())
-						{
-							if (vertex1Iterator->second.Contains(startVertex->GetOcctVertex()))
-							{
-								isAdded = true;
-							}
-						}
-					}
-
-					if (!isAdded)
-					{
-						rEdges.push_back(kpIncidentEdge);
-						processedAdjacency[startVertex->GetOcctVertex()].Add(endVertex->GetOcctShape());
-					}
+					isEdgeAdded[rkAdjacency.second] = true;
+					rEdges.push_back(GetEdge(rkAdjacency.second));
 				}
 			}
 		}
@@ -330,11 +399,16 @@ namespace TopologicCore
 			return;
 		}
 
+		if (kTolerance > m_vertexGridCellSize)
+		{
+			SetVertexGridCellSize(kTolerance);
+		}
+
 		for (const Vertex::Ptr& kpVertex : rkVertices)
 		{
 			if (!ContainsVertex(kpVertex, kTolerance))
 			{
-				m_graphDictionary.insert(std::make_pair(kpVertex->GetOcctVertex(), TopTools_MapOfShape()));
+				AddVertex(kpVertex->GetOcctVertex());
 			}
 		}
 	}
@@ -347,27 +421,30 @@ namespace TopologicCore
 			return;
 		}
 
+		if (kTolerance > m_vertexGridCellSize)
+		{
+			SetVertexGridCellSize(kTolerance);
+		}
+
+		m_edgeIds.reserve(m_edgeIds.size() + rkEdges.size());
 		for (const Edge::Ptr& kpEdge : rkEdges)
 		{
-			if (!ContainsEdge(kpEdge, kTolerance))
+			TopoDS_Vertex occtStartVertex = kpEdge->StartVertex()->GetOcctVertex();
+			int startVertexId = FindVertexId(occtStartVertex, kTolerance);
+			if (startVertexId < 0)
 			{
-				Vertex::Ptr startVertex = kpEdge->StartVertex();
-				TopoDS_Vertex occtStartCoincidentVertex = GetCoincidentVertex(startVertex->GetOcctVertex(), kTolerance);
-				if (occtStartCoincidentVertex.IsNull())
-				{
-					occtStartCoincidentVertex = startVertex->GetOcctVertex();
-				}
-				Vertex::Ptr endVertex = kpEdge->EndVertex();
-				TopoDS_Vertex occtEndCoincidentVertex = GetCoincidentVertex(endVertex->GetOcctVertex(), kTolerance);
-				if (occtEndCoincidentVertex.IsNull())
-				{
-					occtEndCoincidentVertex = endVertex->GetOcctVertex();
-				}
-
-				m_graphDictionary[occtStartCoincidentVertex].Add(occtEndCoincidentVertex);
-				m_graphDictionary[occtEndCoincidentVertex].Add(occtStartCoincidentVertex);
+				startVertexId = AddVertex(occtStartVertex);
+			}
+			TopoDS_Vertex occtEndVertex = kpEdge->EndVertex()->GetOcctVertex();
+			int endVertexId = FindVertexId(occtEndVertex, kTolerance);
+			if (endVertexId < 0)
+			{
+				endVertexId = AddVertex(occtEndVertex);
+			}
 
-				m_occtEdges.Add(kpEdge->GetOcctEdge());
+			if (FindEdgeId(startVertexId, endVertexId) < 0)
+			{
+				AddEdge(startVertexId, endVertexId, kpEdge->GetOcctEdge());
 			}
 		}
 	}
@@ -379,41 +456,41 @@ namespace TopologicCore
 
 	int Graph::VertexDegree(const TopoDS_Vertex & rkOcctVertex) const
 	{
-        auto vertexAdjacency = m_graphDictionary.find(rkOcctVertex);
-		if (vertexAdjacency == m_graphDictionary.end())
+		const int* kpVertexId = m_occtVertexIds.Seek(rkOcctVertex);
+		if (kpVertexId == nullptr)
 		{
 			return 0;
 		}
 
-		int numberOfEdges = vertexAdjacency->second.Size();
-		int numberOfLoops = vertexAdjacency->second.Contains(rkOcctVertex) ? 1 : 0;
-		int degree = numberOfEdges + numberOfLoops;
-
-		return degree;
+		return VertexDegree(*kpVertexId);
 	}
 
 	void Graph::AdjacentVertices(const std::shared_ptr<Vertex>& kpVertex, std::list<std::shared_ptr<Vertex>>& rAdjacentVertices) const
 	{
-		TopTools_MapOfShape occtAdjacentVertices;
-		AdjacentVertices(kpVertex->GetOcctVertex(), occtAdjacentVertices);
+		int vertexId = FindVertexId(kpVertex->GetOcctVertex(), 0.0001);
+		if (vertexId < 0)
+		{
+			return;
+		}
 
-		for (TopTools_MapIteratorOfMapOfShape mapIterator(occtAdjacentVertices);
-			mapIterator.More();
-			mapIterator.Next())
+		for (const std::pair<int, int>& rkAdjacency : m_adjacency[vertexId])
 		{
-			Vertex::Ptr adjacentVertex = std::dynamic_pointer_cast<Vertex>(Topology::ByOcctShape(mapIterator.Value()));
-			rAdjacentVertices.push_back(adjacentVertex);
+			rAdjacentVertices.push_back(GetVertex(rkAdjacency.first));
 		}
 	}
 
 	void Graph::AdjacentVertices(const TopoDS_Vertex& rkOcctVertex, TopTools_MapOfShape& rOcctAdjacentVertices) const
 	{
-		if (!ContainsVertex(rkOcctVertex, 0.0001))
+		int vertexId = FindVertexId(rkOcctVertex, 0.0001);
+		if (vertexId < 0)
 		{
 			return;
 		}
 
-		rOcctAdjacentVertices = m_graphDictionary.find(rkOcctVertex)->second;
+		for (const std::pair<int, int>& rkAdjacency : m_adjacency[vertexId])
+		{
+			rOcctAdjacentVertices.Add(m_occtVertices[rkAdjacency.first]);
+		}
 	}
 
 	void Graph::Connect(const std::list<std::shared_ptr<Vertex>>& rkVertices1, const std::list<std::shared_ptr<Vertex>>& rkVertices2, const double kTolerance)
@@ -423,6 +500,10 @@ namespace TopologicCore
 			// throw std::runtime_error("The tolerance must have a positive value.");
 			return;
 		}
+		if (kTolerance > m_vertexGridCellSize)
+		{
+			SetVertexGridCellSize(kTolerance);
+		}
 
         std::list<Vertex::Ptr>::const_iterator vertex1Iterator = rkVertices1.begin();
         std::list<Vertex::Ptr>::const_iterator vertex2Iterator = rkVertices2.begin();
@@ -431,35 +512,21 @@ namespace TopologicCore
             const Vertex::Ptr& kpVertex1 = *vertex1Iterator;
             const Vertex::Ptr& kpVertex2 = *vertex2Iterator;
 
-            TopoDS_Vertex occtQueryVertex1 = GetCoincidentVertex(kpVertex1->GetOcctVertex(), kTolerance);
-            if (occtQueryVertex1.IsNull())
-            {
-                occtQueryVertex1 = kpVertex1->GetOcctVertex();
-            }
-            TopoDS_Vertex occtQueryVertex2 = GetCoincidentVertex(kpVertex2->GetOcctVertex(), kTolerance);
-            if (occtQueryVertex2.IsNull())
-            {
-                occtQueryVertex2 = kpVertex2->GetOcctVertex();
-            }
-
-            bool addingEdge = false;
-            if (!m_graphDictionary[occtQueryVertex1].Contains(occtQueryVertex2))
+            int vertexId1 = FindVertexId(kpVertex1->GetOcctVertex(), kTolerance);
+            if (vertexId1 < 0)
             {
-                m_graphDictionary[occtQueryVertex1].Add(occtQueryVertex2);
-                addingEdge = true;
+                vertexId1 = AddVertex(kpVertex1->GetOcctVertex());
             }
-            if (!m_graphDictionary[occtQueryVertex2].Contains(occtQueryVertex1))
+            int vertexId2 = FindVertexId(kpVertex2->GetOcctVertex(), kTolerance);
+            if (vertexId2 < 0)
             {
-                m_graphDictionary[occtQueryVertex2].Add(occtQueryVertex1);
-                addingEdge = true;
+                vertexId2 = AddVertex(kpVertex2->GetOcctVertex());
             }
 
-            if (addingEdge)
+            if (FindEdgeId(vertexId1, vertexId2) < 0)
             {
-                Vertex::Ptr queryVertex1 = std::dynamic_pointer_cast<Vertex>(Topology::ByOcctShape(occtQueryVertex1));
-                Vertex::Ptr queryVertex2 = std::dynamic_pointer_cast<Vertex>(Topology::ByOcctShape(occtQueryVertex2));
-                Edge::Ptr edge = Edge::ByStartVertexEndVertex(queryVertex1, queryVertex2);
-                m_occtEdges.Add(edge->GetOcctEdge());
+                Edge::Ptr edge = Edge::ByStartVertexEndVertex(GetVertex(vertexId1), GetVertex(vertexId2));
+                AddEdge(vertexId1, vertexId2, edge->GetOcctEdge());
             }
         }
 	}
@@ -471,8 +538,7 @@ namespace TopologicCore
 
 	bool Graph::ContainsVertex(const TopoDS_Vertex & rkOcctVertex, const double kTolerance) const
 	{
-		TopoDS_Vertex occtCoincidentVertex = GetCoincidentVertex(rkOcctVertex, kTolerance);
-		return !occtCoincidentVertex.IsNull();
+		return FindVertexId(rkOcctVertex, kTolerance) >= 0;
 	}
 
 	bool Graph::ContainsEdge(const std::shared_ptr<TopologicCore::Edge>& kpEdge, const double kTolerance) const
@@ -490,29 +556,25 @@ namespace TopologicCore
 			return false;
 		}
 
-		TopoDS_Vertex occtStartCoincidentVertex = GetCoincidentVertex(rkVertex1, kTolerance);
-		if (occtStartCoincidentVertex.IsNull())
+		int vertexId1 = FindVertexId(rkVertex1, kTolerance);
+		if (vertexId1 < 0)
 		{
 			return false;
 		}
-		TopoDS_Vertex occtEndCoincidentVertex = GetCoincidentVertex(rkVertex2, kTolerance);
-		if (occtEndCoincidentVertex.IsNull())
+		int vertexId2 = FindVertexId(rkVertex2, kTolerance);
+		if (vertexId2 < 0)
 		{
 			return false;
 		}
 
-		TopTools_MapOfShape adjacentVerticesToStart = m_graphDictionary.find(occtStartCoincidentVertex)->second;
-		TopTools_MapOfShape adjacentVerticesToEnd = m_graphDictionary.find(occtEndCoincidentVertex)->second;
-
-		return adjacentVerticesToStart.Contains(occtEndCoincidentVertex) || adjacentVerticesToEnd.Contains(occtStartCoincidentVertex);
+		return FindEdgeId(vertexId1, vertexId2) >= 0;
 	}
 
 	void Graph::DegreeSequence(std::list<int>& rDegreeSequence) const
 	{
-		for (const std::pair<TopoDS_Vertex, TopTools_MapOfShape>& rkDictionaryPair : m_graphDictionary)
+		for (int vertexId = 0; vertexId < (int)m_occtVertices.size(); ++vertexId)
 		{
-			Vertex::Ptr vertex = std::dynamic_pointer_cast<Vertex>(Topology::ByOcctShape(rkDictionaryPair.first));
-			rDegreeSequence.push_back(VertexDegree(vertex));
+			rDegreeSequence.push_back(VertexDegree(vertexId));
 		}
 
 		rDegreeSequence.sort(std::greater<int>());
@@ -520,11 +582,8 @@ namespace TopologicCore
 
 	double Graph::Density() const
 	{
-		int numOfVertices = (int)m_graphDictionary.size();
-
-		std::list<Edge::Ptr> edges;
-		Edges(edges);
-		int numOfEdges = (int)edges.size();
+		int numOfVertices = (int)m_occtVertices.size();
+		int numOfEdges = (int)m_occtEdges.size();
 		double denominator = numOfVertices * (numOfVertices - 1);
 		if (denominator > -0.0001 && denominator < 0.0001)
 		{
@@ -532,7 +591,7 @@ namespace TopologicCore
 			return std::numeric_limits<double>::max();
 		}
 		return  (2 * numOfEdges) / denominator;
-		//return numOfEdges / denominator; 
+		//return numOfEdges / denominator;
 	}
 
 	bool Graph::IsComplete() const
@@ -542,11 +601,11 @@ namespace TopologicCore
 
 	void Graph::IsolatedVertices(std::list<Vertex::Ptr>& rIsolatedVertices) const
 	{
-		for (const std::pair<TopoDS_Vertex, TopTools_MapOfShape>& kpPair : m_graphDictionary)
+		for (int vertexId = 0; vertexId < (int)m_occtVertices.size(); ++vertexId)
 		{
-			if (kpPair.second.IsEmpty())
+			if (m_adjacency[vertexId].empty())
 			{
-				rIsolatedVertices.push_back(std::dynamic_pointer_cast<Vertex>(Topology::ByOcctShape(kpPair.first)));
+				rIsolatedVertices.push_back(GetVertex(vertexId));
 			}
 		}
 	}
@@ -555,9 +614,9 @@ namespace TopologicCore
 	{
 		int minimumDelta = std::numeric_limits<int>::max();
 
-		for (const std::pair<TopoDS_Vertex, TopTools_MapOfShape>& kpPair : m_graphDictionary)
+		for (int vertexId = 0; vertexId < (int)m_occtVertices.size(); ++vertexId)
 		{
-			int vertexDegree = VertexDegree(kpPair.first);
+			int vertexDegree = VertexDegree(vertexId);
 			if (vertexDegree < minimumDelta)
 			{
 				minimumDelta = vertexDegree;
@@ -570,9 +629,9 @@ namespace TopologicCore
 	{
 		int maximumDelta = 0;
 
-		for (const std::pair<TopoDS_Vertex, TopTools_MapOfShape>& kpPair : m_graphDictionary)
+		for (int vertexId = 0; vertexId < (int)m_occtVertices.size(); ++vertexId)
 		{
-			int vertexDegree = VertexDegree(kpPair.first);
+			int vertexDegree = VertexDegree(vertexId);
 			if (vertexDegree > maximumDelta)
 			{
 				maximumDelta = vertexDegree;
@@ -602,80 +661,63 @@ namespace TopologicCore
 		std::list<Vertex::Ptr>& rPath,
 		std::list<Wire::Ptr>& rPaths) const
 	{
-		if (kUseTimeLimit)
-		{
-			auto currentTime = std::chrono::system_clock::now();
-			auto timeDifferenceInSeconds = std::chrono::duration_cast<std::chrono::seconds>(currentTime - rkStartingTime);
-			if (timeDifferenceInSeconds.count() >= kTimeLimitInSeconds)
-			{
-				return;
-			}
-		}
-
-		if (!ContainsVertex(kpStartVertex, 0.0001))
-		{
-			return;
-		}
-
-		rPath.push_back(kpStartVertex);
-		if (kpStartVertex->IsSame(kpEndVertex))
+		int startVertexId = FindVertexId(kpStartVertex->GetOcctVertex(), 0.0001);
+		int endVertexId = FindVertexId(kpEndVertex->GetOcctVertex(), 0.0001);
+		if (startVertexId < 0 || endVertexId < 0)
 		{
-			// Create a wire
-			Wire::Ptr pathWire = ConstructPath(rPath);
-
-			rPaths.push_back(pathWire);
 			return;
 		}
 
-		if (kUseTimeLimit)
+		// The Vertices already in rPath are not visited again.
+		std::vector<bool> isOnPath(m_occtVertices.size(), false);
+		std::vector<int> pathVertexIds;
+		for (const Vertex::Ptr& kpPathVertex : rPath)
 		{
-			auto currentTime = std::chrono::system_clock::now();
-			auto timeDifferenceInSeconds = std::chrono::duration_cast<std::chrono::seconds>(currentTime - rkStartingTime);
-			if (timeDifferenceInSeconds.count() >= kTimeLimitInSeconds)
+			int pathVertexId = FindVertexId(kpPathVertex->GetOcctVertex(), 0.0001);
+			if (pathVertexId >= 0)
 			{
-				return;
+				isOnPath[pathVertexId] = true;
+				pathVertexIds.push_back(pathVertexId);
 			}
 		}
-
-		TopTools_MapOfShape occtConnectedVertices = m_graphDictionary.find(kpStartVertex->GetOcctVertex())->second;
-		for (TopTools_MapIteratorOfMapOfShape mapIterator(occtConnectedVertices);
-			mapIterator.More();
-			mapIterator.Next())
+		if (isOnPath[startVertexId])
 		{
-			Vertex::Ptr connectedVertex = std::dynamic_pointer_cast<Vertex>(Topology::ByOcctShape(mapIterator.Value()));
-			if (std::find_if(rPath.begin(), rPath.end(), TopologyCompare(connectedVertex)) == rPath.end())
-			{
-				std::list<Wire::Ptr> extendedPaths;
-				std::list<Vertex::Ptr> previousPath = rPath;
-
-				if (kUseTimeLimit)
-				{
-					auto currentTime = std::chrono::system_clock::now();
-					auto timeDifferenceInSeconds = std::chrono::duration_cast<std::chrono::seconds>(currentTime - rkStartingTime);
-					if (timeDifferenceInSeconds.count() >= kTimeLimitInSeconds)
-					{
-						break;
-					}
-				}
-
-				AllPaths(connectedVertex, kpEndVertex, kUseTimeLimit, kTimeLimitInSeconds, rkStartingTime, previousPath, extendedPaths);
-				for (const Wire::Ptr& rkExtendedPath : extendedPaths)
-				{
-					rPaths.push_back(rkExtendedPath);
-				}
-			}
+			return;
+		}
 
-			if (kUseTimeLimit)
+		rPath.push_back(kpStartVertex);
+		EnumeratePaths(startVertexId, endVertexId, 0, 0, kUseTimeLimit, (double)kTimeLimitInSeconds, rkStartingTime, isOnPath, pathVertexIds,
+			[&](const std::vector<int>& rkPathVertexIds)
 			{
-				auto currentTime = std::chrono::system_clock::now();
-				auto timeDifferenceInSeconds = std::chrono::duration_cast<std::chrono::seconds>(currentTime - rkStartingTime);
-				if (timeDifferenceInSeconds.count() >= kTimeLimitInSeconds)
+				Wire::Ptr pathWire = ConstructPath(rkPathVertexIds);
+				if (pathWire != nullptr)
 				{
-					break;
+					rPaths.push_back(pathWire);
 				}
-			}
+				return true;
+			});
+	}
+
+	int Graph::AllPaths(
+		const Vertex::Ptr& kpStartVertex,
+		const Vertex::Ptr& kpEndVertex,
+		const int kMaxNumberOfPaths,
+		const int kMaxNumberOfEdges,
+		const double kTimeLimitInSeconds,
+		const PathCallback& rkCallback) const
+	{
+		int startVertexId = FindVertexId(kpStartVertex->GetOcctVertex(), 0.0001);
+		int endVertexId = FindVertexId(kpEndVertex->GetOcctVertex(), 0.0001);
+		if (startVertexId < 0 || endVertexId < 0)
+		{
+			return 0;
 		}
 
+		std::vector<bool> isOnPath(m_occtVertices.size(), false);
+		std::vector<int> pathVertexIds;
+		return EnumeratePaths(
+			startVertexId, endVertexId, kMaxNumberOfPaths, kMaxNumberOfEdges, kTimeLimitInSeconds > 0.0, kTimeLimitInSeconds,
+			std::chrono::system_clock::now(), isOnPath, pathVertexIds, rkCallback);
 	}
 
 	Wire::Ptr Graph::Path(const Vertex::Ptr & kpStartVertex, const Vertex::Ptr & kpEndVertex) const
@@ -687,30 +729,45 @@ namespace TopologicCore
 	Wire::Ptr Graph::Path(const Vertex::Ptr & kpStartVertex, const Vertex::Ptr & kpEndVertex, std::list<Vertex::Ptr>& rPath) const
 	{
 		rPath.push_back(kpStartVertex);
-		if (!ContainsVertex(kpStartVertex, 0.0001))
+		int startVertexId = FindVertexId(kpStartVertex->GetOcctVertex(), 0.0001);
+		int endVertexId = FindVertexId(kpEndVertex->GetOcctVertex(), 0.0001);
+		if (startVertexId < 0 || endVertexId < 0)
 		{
 			return nullptr;
 		}
 
-		if (kpStartVertex->IsSame(kpEndVertex))
+		// Depth-First Search with an explicit stack, which holds the index of the next adjacency of each Vertex on the path.
+		const CompactAdjacency& rkAdjacency = GetCompactAdjacency();
+		std::vector<bool> isVisited(m_occtVertices.size(), false);
+		std::vector<int> pathVertexIds(1, startVertexId);
+		std::vector<int> nextAdjacencyIndices(1, rkAdjacency.offsets[startVertexId]);
+		isVisited[startVertexId] = true;
+		while (!pathVertexIds.empty())
 		{
-			Wire::Ptr pathWire = ConstructPath(rPath);
-			return pathWire;
-		}
-
-		TopTools_MapOfShape occtConnectedVertices = m_graphDictionary.find(kpStartVertex->GetOcctVertex())->second;
-		for (TopTools_MapIteratorOfMapOfShape mapIterator(occtConnectedVertices);
-			mapIterator.More();
-			mapIterator.Next())
-		{
-			Vertex::Ptr connectedVertex = std::dynamic_pointer_cast<Vertex>(Topology::ByOcctShape(mapIterator.Value()));
-			if (std::find_if(rPath.begin(), rPath.end(), TopologyCompare(connectedVertex)) == rPath.end())
+			int vertexId = pathVertexIds.back();
+			if (vertexId == endVertexId)
 			{
-				Wire::Ptr extendedPath = Path(connectedVertex, kpEndVertex, rPath);
-				if (extendedPath != nullptr)
+				for (std::vector<int>::const_iterator kPathIterator = pathVertexIds.begin() + 1; kPathIterator != pathVertexIds.end(); ++kPathIterator)
 				{
-					return extendedPath;
+					rPath.push_back(GetVertex(*kPathIterator));
 				}
+				return ConstructPath(pathVertexIds);
+			}
+
+			int& rNextAdjacencyIndex = nextAdjacencyIndices.back();
+			if (rNextAdjacencyIndex == rkAdjacency.offsets[vertexId + 1])
+			{
+				pathVertexIds.pop_back();
+				nextAdjacencyIndices.pop_back();
+				continue;
+			}
+
+			int adjacentVertexId = rkAdjacency.adjacentVertexIds[rNextAdjacencyIndex++];
+			if (!isVisited[adjacentVertexId])
+			{
+				isVisited[adjacentVertexId] = true;
+				pathVertexIds.push_back(adjacentVertexId);
+				nextAdjacencyIndices.push_back(rkAdjacency.offsets[adjacentVertexId]);
 			}
 		}
 
@@ -724,87 +781,33 @@ namespace TopologicCore
 
 	std::shared_ptr<Wire> Graph::ShortestPath(const TopoDS_Vertex & rkOcctStartVertex, const TopoDS_Vertex & rkOcctEndVertex, const std::string& rkVertexKey, const std::string& rkEdgeKey) const
 	{
-		// Dijkstra's: https://en.wikipedia.org/wiki/Dijkstra%27s_algorithm#Pseudocode
-		std::list<TopoDS_Vertex> vertexList;
-		std::map<TopoDS_Vertex, double, OcctShapeComparator> distanceMap;
-		std::map<TopoDS_Vertex, TopoDS_Vertex, OcctShapeComparator> parentMap;
-		for (const std::pair<TopoDS_Vertex, TopTools_MapOfShape>& vertexEdgesPair : m_graphDictionary)
+		int startVertexId = FindVertexId(rkOcctStartVertex, 0.0001);
+		int endVertexId = FindVertexId(rkOcctEndVertex, 0.0001);
+		if (startVertexId < 0 || endVertexId < 0)
 		{
-			distanceMap[vertexEdgesPair.first] = std::numeric_limits<double>::max();
-			parentMap[vertexEdgesPair.first] = TopoDS_Vertex();
-			vertexList.push_back(vertexEdgesPair.first);
+			return nullptr;
 		}
 
-		distanceMap[rkOcctStartVertex] = 0;
+		std::vector<double> vertexCosts;
+		VertexCosts(rkVertexKey, vertexCosts);
+		std::vector<double> edgeCosts;
+		EdgeCosts(rkEdgeKey, edgeCosts);
 
-		while (!vertexList.empty())
+		std::vector<double> distances;
+		std::vector<int> parentVertexIds;
+		ShortestDistances(startVertexId, endVertexId, vertexCosts, edgeCosts, distances, parentVertexIds, HeuristicScale(vertexCosts, edgeCosts));
+		if (distances[endVertexId] >= std::numeric_limits<double>::max())
 		{
-			// Find vertex with the lowest distance
-			double minDistance = std::numeric_limits<double>::max();
-			TopoDS_Vertex occtVertexMinDistance;
-			for (const TopoDS_Vertex& kpVertexInQueue : vertexList)
-			{
-				double distance = distanceMap[kpVertexInQueue];
-				if (distance <= minDistance)
-				{
-					minDistance = distance;
-					occtVertexMinDistance = kpVertexInQueue;
-				}
-			}
-
-			vertexList.remove(occtVertexMinDistance);
-
-			if (occtVertexMinDistance.IsNull())
-			{
-				continue;
-			}
-
-			if (occtVertexMinDistance == rkOcctEndVertex)
-			{
-				std::list<Vertex::Ptr> path;
-				TopoDS_Vertex occtCurrentVertex = occtVertexMinDistance;
-				if (parentMap.find(occtCurrentVertex) != parentMap.end() ||
-					occtVertexMinDistance == rkOcctStartVertex)
-				{
-					while (!occtCurrentVertex.IsNull())
-					{
-						path.push_front(std::dynamic_pointer_cast<Vertex>(Topology::ByOcctShape(occtCurrentVertex)));
-						std::map<TopoDS_Vertex, TopoDS_Vertex>::iterator parentIterator = parentMap.find(occtCurrentVertex);
-						if (parentIterator != parentMap.end())
-						{
-							occtCurrentVertex = parentIterator->second;
-						}
-						else
-						{
-							occtCurrentVertex = TopoDS_Vertex();
-						}
-					}
-				}
-
-				return ConstructPath(path);
-			}
-
-			TopTools_MapOfShape occtVertexMinDistanceNeighbours = m_graphDictionary.find(occtVertexMinDistance)->second;
-			for (TopTools_MapIteratorOfMapOfShape mapIterator(occtVertexMinDistanceNeighbours);
-				mapIterator.More();
-				mapIterator.Next())
-			{
-				TopoDS_Vertex occtNeighbour = TopoDS::Vertex(mapIterator.Value());
-				double length = 0.0;
-				if (!occtVertexMinDistance.IsSame(occtNeighbour))
-				{
-					length = ComputeCost(occtVertexMinDistance, occtNeighbour, rkVertexKey, rkEdgeKey);
-				}
-				double alternativeDistance = distanceMap[occtVertexMinDistance] + length;
-				if (alternativeDistance < distanceMap[occtNeighbour])
-				{
-					distanceMap[occtNeighbour] = alternativeDistance;
-					parentMap[occtNeighbour] = occtVertexMinDistance;
-				}
-			}
+			return nullptr;
 		}
 
-		return nullptr;
+		std::vector<int> pathVertexIds;
+		for (int vertexId = endVertexId; vertexId >= 0; vertexId = parentVertexIds[vertexId])
+		{
+			pathVertexIds.push_back(vertexId);
+		}
+		std::reverse(pathVertexIds.begin(), pathVertexIds.end());
+		return ConstructPath(pathVertexIds);
 	}
 
 	void Graph::ShortestPaths(
@@ -834,146 +837,314 @@ namespace TopologicCore
 			return;
 		}
 
-		auto startingTime = std::chrono::system_clock::now();
-
-		struct Node
+		int startVertexId = FindVertexId(rkOcctStartVertex, 0.0001);
+		int endVertexId = FindVertexId(rkOcctEndVertex, 0.0001);
+		if (startVertexId < 0 || endVertexId < 0)
 		{
-			TopoDS_Vertex val;
-			std::list<TopoDS_Vertex> path;
-			double distance;
-		};
+			return;
+		}
 
-		const double kInfiniteDistance = std::numeric_limits<double>::max();
+		std::vector<double> vertexCosts;
+		VertexCosts(rkVertexKey, vertexCosts);
+		std::vector<double> edgeCosts;
+		EdgeCosts(rkEdgeKey, edgeCosts);
 
-		std::map<TopoDS_Vertex, double, OcctShapeComparator> distanceMap;
-		std::list<Vertex::Ptr> vertices;
-		Vertices(vertices);
-		for (const Vertex::Ptr& kpVertex : vertices)
+		std::vector<double> distances;
+		std::vector<int> parentVertexIds;
+		ShortestDistances(startVertexId, endVertexId, vertexCosts, edgeCosts, distances, parentVertexIds, HeuristicScale(vertexCosts, edgeCosts));
+		double minDistance = distances[endVertexId];
+		if (minDistance >= std::numeric_limits<double>::max())
 		{
-			distanceMap.insert(std::pair<TopoDS_Vertex, double>(kpVertex->GetOcctVertex(), kInfiniteDistance));
+			return;
 		}
-		std::queue<Node> occtVertexQueue;
-		std::list<Node> occtNodePaths;
-		Node startNode;
-		startNode.val = rkOcctStartVertex;
-		startNode.path.push_back(rkOcctStartVertex);
-		startNode.distance = 0.0;
-		occtVertexQueue.push(startNode);
-
-		double minDistance = kInfiniteDistance;
-		distanceMap[rkOcctStartVertex] = 0.0;
 
-		while (!occtVertexQueue.empty())
+		// The paths which are as short as the shortest one, allowing for the rounding of their costs
+		const double kMaxCost = minDistance + 1.0e-9 * std::max(1.0, minDistance);
+		std::vector<std::vector<int>> pathVertexIds;
+		std::vector<double> pathCosts;
+		YenShortestPaths(startVertexId, endVertexId, vertexCosts, edgeCosts, std::numeric_limits<int>::max(), kMaxCost, kUseTimeLimit, kTimeLimit, pathVertexIds, pathCosts);
+		for (const std::vector<int>& rkPathVertexIds : pathVertexIds)
 		{
-			if (kUseTimeLimit)
+			if (rkPathVertexIds.size() > 1)
 			{
-				auto currentTime = std::chrono::system_clock::now();
-				auto timeDifferenceInSeconds = std::chrono::duration_cast<std::chrono::seconds>(currentTime - startingTime);
-				if (timeDifferenceInSeconds.count() > kTimeLimit)
+				Wire::Ptr path = ConstructPath(rkPathVertexIds);
+				if (path != nullptr)
 				{
-					break;
+					rPaths.push_back(path);
 				}
 			}
+		}
+	}
 
-			Node currentNode = occtVertexQueue.front();
-			occtVertexQueue.pop();
-			if (currentNode.val == rkOcctEndVertex && currentNode.distance <= minDistance)
-			{
-				minDistance = currentNode.distance;
-				occtNodePaths.push_back(currentNode);
-			}
+	void Graph::KShortestPaths(
+		const Vertex::Ptr& kpStartVertex,
+		const Vertex::Ptr& kpEndVertex,
+		const std::string& rkVertexKey,
+		const std::string& rkEdgeKey,
+		const int kMaxNumberOfPaths,
+		const double kMaxCost,
+		std::vector<std::vector<int>>& rPathVertexIndices,
+		std::vector<double>& rPathCosts) const
+	{
+		rPathVertexIndices.clear();
+		rPathCosts.clear();
+		int startVertexId = FindVertexId(kpStartVertex->GetOcctVertex(), 0.0001);
+		int endVertexId = FindVertexId(kpEndVertex->GetOcctVertex(), 0.0001);
+		if (startVertexId < 0 || endVertexId < 0)
+		{
+			return;
+		}
+
+		std::vector<double> vertexCosts;
+		VertexCosts(rkVertexKey, vertexCosts);
+		std::vector<double> edgeCosts;
+		EdgeCosts(rkEdgeKey, edgeCosts);
+		YenShortestPaths(startVertexId, endVertexId, vertexCosts, edgeCosts, kMaxNumberOfPaths, kMaxCost, false, 0, rPathVertexIndices, rPathCosts);
+	}
 
-			if (currentNode.distance <= minDistance)
+	void Graph::KShortestPaths(
+		const Vertex::Ptr& kpStartVertex,
+		const Vertex::Ptr& kpEndVertex,
+		const std::string& rkVertexKey,
+		const std::string& rkEdgeKey,
+		const int kMaxNumberOfPaths,
+		const double kMaxCost,
+		std::list<std::shared_ptr<Wire>>& rPaths) const
+	{
+		std::vector<std::vector<int>> pathVertexIds;
+		std::vector<double> pathCosts;
+		KShortestPaths(kpStartVertex, kpEndVertex, rkVertexKey, rkEdgeKey, kMaxNumberOfPaths, kMaxCost, pathVertexIds, pathCosts);
+		for (const std::vector<int>& rkPathVertexIds : pathVertexIds)
+		{
+			if (rkPathVertexIds.size() > 1)
 			{
-				TopTools_MapOfShape occtAdjacentVertices;
-				AdjacentVertices(currentNode.val, occtAdjacentVertices);
-				for (TopTools_MapIteratorOfMapOfShape occtAdjacentVertexIterator(occtAdjacentVertices);
-					occtAdjacentVertexIterator.More();
-					occtAdjacentVertexIterator.Next())
+				Wire::Ptr path = ConstructPath(rkPathVertexIds);
+				if (path != nullptr)
 				{
-					TopoDS_Vertex occtAdjacentVertex = TopoDS::Vertex(occtAdjacentVertexIterator.Value());
-					double currentDistance = distanceMap[occtAdjacentVertex];
-					if (distanceMap[occtAdjacentVertex] >= currentNode.distance)
-					{
-						Node adjacentVertex;
-						adjacentVertex.val = occtAdjacentVertex;
-						adjacentVertex.path = currentNode.path;
-						adjacentVertex.path.push_back(occtAdjacentVertex);
+					rPaths.push_back(path);
+				}
+			}
+		}
+	}
 
-						double edgeCost = ComputeEdgeCost(currentNode.val, occtAdjacentVertex, rkEdgeKey);
-						adjacentVertex.distance = currentNode.distance + edgeCost;
+	int Graph::Diameter() const
+	{
+		std::list<int> eccentricities;
+		int diameter = 0, radius = 0;
+		std::list<Vertex::Ptr> centerVertices;
+		Eccentricities(eccentricities, diameter, radius, centerVertices);
+		return diameter;
+	}
 
-						double vertexCost = ComputeVertexCost(occtAdjacentVertex, rkVertexKey);
-						adjacentVertex.distance += vertexCost;
+	int Graph::Radius() const
+	{
+		std::list<int> eccentricities;
+		int diameter = 0, radius = 0;
+		std::list<Vertex::Ptr> centerVertices;
+		Eccentricities(eccentricities, diameter, radius, centerVertices);
+		return radius;
+	}
 
-						distanceMap[occtAdjacentVertex] = adjacentVertex.distance;
-						occtVertexQueue.push(adjacentVertex);
-					}
-				}
-			}
+	void Graph::Center(std::list<Vertex::Ptr>& rCenterVertices) const
+	{
+		std::list<int> eccentricities;
+		int diameter = 0, radius = 0;
+		Eccentricities(eccentricities, diameter, radius, rCenterVertices);
+	}
+
+	void Graph::Eccentricities(std::list<int>& rEccentricities, int& rDiameter, int& rRadius, std::list<Vertex::Ptr>& rCenterVertices) const
+	{
+		rDiameter = 0;
+		rRadius = 0;
+		if (m_occtVertices.empty())
+		{
+			return;
 		}
 
-		for (const Node& rkNode : occtNodePaths)
+		std::vector<int> sourceVertexIds(m_occtVertices.size());
+		std::iota(sourceVertexIds.begin(), sourceVertexIds.end(), 0);
+		std::vector<int> eccentricities;
+		ComputeEccentricities(sourceVertexIds, eccentricities);
+
+		rDiameter = *std::max_element(eccentricities.begin(), eccentricities.end());
+		rRadius = *std::min_element(eccentricities.begin(), eccentricities.end());
+		for (int vertexId = 0; vertexId < (int)eccentricities.size(); ++vertexId)
 		{
-			if (rkNode.distance > minDistance)
+			rEccentricities.push_back(eccentricities[vertexId]);
+			if (eccentricities[vertexId] == rRadius)
 			{
-				continue;
+				rCenterVertices.push_back(GetVertex(vertexId));
 			}
+		}
+	}
 
-			std::list<Vertex::Ptr> vertices;
-			for (const TopoDS_Vertex& rkOcctVertex : rkNode.path)
-			{
-				Vertex::Ptr vertex = std::dynamic_pointer_cast<Vertex>(Topology::ByOcctShape(rkOcctVertex));
-				vertices.push_back(vertex);
-			}
-			if (vertices.size() > 1)
+	void Graph::DistanceMatrix(
+		const std::list<Vertex::Ptr>& rkSourceVertices,
+		const std::string& rkVertexKey,
+		const std::string& rkEdgeKey,
+		std::vector<double>& rDistances) const
+	{
+		ComputeDistanceMatrix(rkSourceVertices, rkVertexKey, rkEdgeKey, rDistances);
+	}
+
+	void Graph::DistanceMatrix(
+		const std::list<Vertex::Ptr>& rkSourceVertices,
+		const std::string& rkVertexKey,
+		const std::string& rkEdgeKey,
+		std::vector<float>& rDistances) const
+	{
+		ComputeDistanceMatrix(rkSourceVertices, rkVertexKey, rkEdgeKey, rDistances);
+	}
+
+	void Graph::BetweennessCentrality(
+		const std::string& rkVertexKey,
+		const std::string& rkEdgeKey,
+		const bool kNormalize,
+		const int kNumberOfSamples,
+		const std::string& rkDictionaryKey,
+		std::vector<double>& rCentralities) const
+	{
+		const int kNumOfVertices = (int)m_occtVertices.size();
+		rCentralities.assign(kNumOfVertices, 0.0);
+		if (kNumOfVertices == 0)
+		{
+			return;
+		}
+
+		std::vector<int> sourceVertexIds(kNumOfVertices);
+		std::iota(sourceVertexIds.begin(), sourceVertexIds.end(), 0);
+		if (kNumberOfSamples > 0 && kNumberOfSamples < kNumOfVertices)
+		{
+			std::mt19937 randomNumberGenerator(0);
+			std::shuffle(sourceVertexIds.begin(), sourceVertexIds.end(), randomNumberGenerator);
+			sourceVertexIds.resize(kNumberOfSamples);
+		}
+
+		// The costs are read from the attributes before the parallel section.
+		std::vector<double> vertexCosts;
+		VertexCosts(rkVertexKey, vertexCosts);
+		std::vector<double> edgeCosts;
+		EdgeCosts(rkEdgeKey, edgeCosts);
+		const bool kIsWeighted = !rkVertexKey.empty() || !rkEdgeKey.empty();
+		GetCompactAdjacency();
+
+		// Each chunk of sources accumulates the dependencies in its own vector, and the vectors are summed afterwards.
+		const bool kRunParallel = ExecutionPolicy::GetInstance().GetRunParallel();
+		const int kNumOfChunks = kRunParallel ?
+			std::max(1, std::min(ExecutionPolicy::GetInstance().GetNumberOfThreads(), (int)sourceVertexIds.size())) : 1;
+		std::vector<std::vector<double>> chunkCentralities(kNumOfChunks);
+		OSD_Parallel::For(0, kNumOfChunks, [&](const int kChunkIndex)
+		{
+			std::vector<double>& rChunkCentralities = chunkCentralities[kChunkIndex];
+			rChunkCentralities.assign(kNumOfVertices, 0.0);
+			std::vector<int> reachedVertexIds;
+			std::vector<double> dependencies;
+			for (size_t sourceIndex = kChunkIndex; sourceIndex < sourceVertexIds.size(); sourceIndex += kNumOfChunks)
 			{
-				Wire::Ptr path = ConstructPath(vertices);
-				if (path != nullptr)
+				ComputeDependencies(sourceVertexIds[sourceIndex], vertexCosts, edgeCosts, kIsWeighted, reachedVertexIds, dependencies);
+
+				// The first reached Vertex is the source.
+				for (size_t i = 1; i < reachedVertexIds.size(); ++i)
 				{
-					rPaths.push_back(path);
+					rChunkCentralities[reachedVertexIds[i]] += dependencies[reachedVertexIds[i]];
 				}
 			}
+		}, !kRunParallel);
+
+		for (const std::vector<double>& rkChunkCentralities : chunkCentralities)
+		{
+			for (int vertexId = 0; vertexId < kNumOfVertices; ++vertexId)
+			{
+				rCentralities[vertexId] += rkChunkCentralities[vertexId];
+			}
+		}
+
+		// Each pair of Vertices is counted from both ends.
+		double scale = 0.5;
+		if (kNormalize)
+		{
+			scale = kNumOfVertices > 2 ? 1.0 / ((double)(kNumOfVertices - 1) * (double)(kNumOfVertices - 2)) : 1.0;
+		}
+		scale *= (double)kNumOfVertices / (double)sourceVertexIds.size();
+		for (double& rCentrality : rCentralities)
+		{
+			rCentrality *= scale;
+		}
+
+		if (!rkDictionaryKey.empty())
+		{
+			SetVertexValues(rkDictionaryKey, rCentralities);
 		}
 	}
 
-	int Graph::Diameter() const
+	void Graph::ClosenessCentrality(
+		const std::string& rkVertexKey,
+		const std::string& rkEdgeKey,
+		const std::string& rkDictionaryKey,
+		std::vector<double>& rCentralities) const
 	{
-		std::map<Vertex::Ptr, Vertex::Ptr> vertexPairs;
-		for (std::map<TopoDS_Vertex, TopTools_MapOfShape, OcctShapeComparator>::const_iterator kVertexEdgesPair1 = m_graphDictionary.begin();
-			kVertexEdgesPair1 != m_graphDictionary.end();
-			kVertexEdgesPair1++)
-		{
-			TopoDS_Vertex occtVertex1 = kVertexEdgesPair1->first;
-			Vertex::Ptr vertex1 = std::dynamic_pointer_cast<Vertex>(Topology::ByOcctShape(occtVertex1));
+		const int kNumOfVertices = (int)m_occtVertices.size();
+		rCentralities.assign(kNumOfVertices, 0.0);
+		std::vector<double> totalDistances(kNumOfVertices, 0.0);
+		std::vector<int> numbersOfReachedVertices(kNumOfVertices, 0);
+		std::vector<int> sourceVertexIds(kNumOfVertices);
+		std::iota(sourceVertexIds.begin(), sourceVertexIds.end(), 0);
 
-			for (std::map<TopoDS_Vertex, TopTools_MapOfShape, OcctShapeComparator>::const_iterator kVertexEdgesPair2 = kVertexEdgesPair1;
-				kVertexEdgesPair2 != m_graphDictionary.end();
-				kVertexEdgesPair2++)
+		// Each source is searched by one thread.
+		if (rkVertexKey.empty() && rkEdgeKey.empty())
+		{
+			MultiSourceBreadthFirstSearch(sourceVertexIds, [&](const int kFirstSourceIndex, const int /*kVertexId*/, std::uint64_t sourceBits, const int kDistance)
 			{
-				if (kVertexEdgesPair1 == kVertexEdgesPair2)
+				for (int bitIndex = 0; sourceBits != 0; ++bitIndex, sourceBits >>= 1)
 				{
-					continue;
+					if ((sourceBits & 1ULL) != 0)
+					{
+						totalDistances[kFirstSourceIndex + bitIndex] += (double)kDistance;
+						++numbersOfReachedVertices[kFirstSourceIndex + bitIndex];
+					}
 				}
+			});
+		}
+		else
+		{
+			// The costs are read from the attributes before the parallel section.
+			std::vector<double> vertexCosts;
+			VertexCosts(rkVertexKey, vertexCosts);
+			std::vector<double> edgeCosts;
+			EdgeCosts(rkEdgeKey, edgeCosts);
+			GetCompactAdjacency();
 
-				TopoDS_Vertex occtVertex2 = kVertexEdgesPair2->first;
-				Vertex::Ptr vertex2 = std::dynamic_pointer_cast<Vertex>(Topology::ByOcctShape(occtVertex2));
-
-				vertexPairs.insert(std::pair<Vertex::Ptr, Vertex::Ptr>(vertex1, vertex2));
-			}
+			OSD_Parallel::For(0, kNumOfVertices, [&](const int kSourceVertexId)
+			{
+				std::vector<double> distances;
+				std::vector<int> parentVertexIds;
+				ShortestDistances(kSourceVertexId, -1, vertexCosts, edgeCosts, distances, parentVertexIds);
+				for (double distance : distances)
+				{
+					if (distance < std::numeric_limits<double>::max())
+					{
+						totalDistances[kSourceVertexId] += distance;
+						++numbersOfReachedVertices[kSourceVertexId];
+					}
+				}
+			}, !ExecutionPolicy::GetInstance().GetRunParallel());
 		}
 
-		int maxShortestPathDistance = 0;
-		for (const std::pair<Vertex::Ptr, Vertex::Ptr>& rkVertexPair : vertexPairs)
+		// Wasserman and Faust's scaling keeps the centralities comparable across the connected components.
+		for (int vertexId = 0; vertexId < kNumOfVertices; ++vertexId)
 		{
-			int distance = TopologicalDistance(rkVertexPair.first, rkVertexPair.second);
-			if (distance > maxShortestPathDistance)
+			if (totalDistances[vertexId] > 0.0)
 			{
-				maxShortestPathDistance = distance;
+				double numOfOtherReachedVertices = (double)(numbersOfReachedVertices[vertexId] - 1);
+				rCentralities[vertexId] = numOfOtherReachedVertices / totalDistances[vertexId] *
+					numOfOtherReachedVertices / (double)(kNumOfVertices - 1);
 			}
 		}
 
-		return maxShortestPathDistance;
+		if (!rkDictionaryKey.empty())
+		{
+			SetVertexValues(rkDictionaryKey, rCentralities);
+		}
 	}
 
 	int Graph::TopologicalDistance(const std::shared_ptr<Vertex>& kpStartVertex, const std::shared_ptr<Vertex>& kpEndVertex, const double kTolerance) const
@@ -989,94 +1160,34 @@ namespace TopologicCore
 			return -1;
         }
 
-        // Use Breadth-First Search
-        TopoDS_Vertex occtCoincidentStartVertex = GetCoincidentVertex(rkOcctStartVertex, kTolerance);
-        TopoDS_Vertex occtCoincidentEndVertex = GetCoincidentVertex(rkOcctEndVertex, kTolerance);
-
-		if(occtCoincidentStartVertex.IsSame(occtCoincidentEndVertex))
+		int startVertexId = FindVertexId(rkOcctStartVertex, kTolerance);
+		int endVertexId = FindVertexId(rkOcctEndVertex, kTolerance);
+		if (startVertexId < 0 || endVertexId < 0)
 		{
-			return 0;
+			return std::numeric_limits<int>::max();
 		}
 
-        std::queue<TopoDS_Vertex> occtVertexQueue;
-        TopTools_DataMapOfShapeInteger occtVertexDistanceMap; // also to check if the vertex is processed
-        
-        occtVertexQueue.push(occtCoincidentStartVertex);
-        
-        while (!occtVertexQueue.empty())
-        {
-            TopoDS_Vertex occtCurrentVertex = occtVertexQueue.front();
-            occtVertexQueue.pop();
-            
-            TopTools_MapOfShape occtConnectedEdges;
-            GraphMap::const_iterator vertexAdjacencyIter = m_graphDictionary.find(occtCurrentVertex);
-            if (vertexAdjacencyIter == m_graphDictionary.end())
-            {
-                continue;
-            }
-
-            for (TopTools_MapIteratorOfMapOfShape occtVertexAdjacency(vertexAdjacencyIter->second);
-                occtVertexAdjacency.More();
-                occtVertexAdjacency.Next())
-            {
-                const TopoDS_Vertex& rkOcctAdjacentVertex = TopoDS::Vertex(occtVertexAdjacency.Value());
-                try {
-                    const int& rDistance = occtVertexDistanceMap.Find(rkOcctAdjacentVertex);
-
-                    // vertex is already processed, so continue.
-                    continue; 
-                }
-                catch (Standard_NoSuchObject&)
-                {
-                    // not found
-                    int parentDistance = 0;
-                    try{
-                        parentDistance = occtVertexDistanceMap.Find(occtCurrentVertex);
-                    }
-                    catch (Standard_NoSuchObject&)
-                    {
-                    }
-                    int currentDistance = parentDistance + 1;
-                    if (rkOcctAdjacentVertex.IsSame(rkOcctEndVertex))
-                    {
-                        return currentDistance;
-                    }
-                    else
-                    {
-                        occtVertexQueue.push(rkOcctAdjacentVertex);
-                        occtVertexDistanceMap.Bind(rkOcctAdjacentVertex, currentDistance);
-                    }
-                }
-            }
-        }
-
-        // The start and end Vertices are in different components of a disjoint Graph. Return infinite.
-        return std::numeric_limits<int>::max();
+		std::vector<int> distances;
+		TopologicalDistances(startVertexId, endVertexId, distances);
+		if (distances[endVertexId] < 0)
+		{
+			// The start and end Vertices are in different components of a disjoint Graph. Return infinite.
+			return std::numeric_limits<int>::max();
+		}
+		return distances[endVertexId];
 	}
 
 	int Graph::Eccentricity(const std::shared_ptr<Vertex>& kpVertex) const
 	{
-		std::map<TopoDS_Vertex, TopTools_MapOfShape, OcctShapeComparator>::const_iterator occtAdjacentVerticesPair =
-			m_graphDictionary.find(kpVertex->GetOcctVertex());
-		if (occtAdjacentVerticesPair == m_graphDictionary.end())
+		int vertexId = FindVertexId(kpVertex->GetOcctVertex(), 0.0001);
+		if (vertexId < 0)
 		{
 			return std::numeric_limits<int>::max(); // infinite distance
 		}
 
-		TopTools_MapOfShape occtAdjacentVertices = occtAdjacentVerticesPair->second;
-		int eccentricity = 0;
-		for (TopTools_MapIteratorOfMapOfShape mapIterator(occtAdjacentVertices);
-			mapIterator.More();
-			mapIterator.Next())
-		{
-			int distance = TopologicalDistance(occtAdjacentVerticesPair->first, TopoDS::Vertex(mapIterator.Value()));
-			if (distance > eccentricity)
-			{
-				eccentricity = distance;
-			}
-		}
-
-		return eccentricity;
+		std::vector<int> eccentricities;
+		ComputeEccentricities(std::vector<int>(1, vertexId), eccentricities);
+		return eccentricities.front();
 	}
 
 	bool Graph::IsErdoesGallai(const std::list<int>& rkSequence) const
@@ -1122,43 +1233,17 @@ namespace TopologicCore
 
 	void Graph::RemoveVertices(const std::list<Vertex::Ptr>& rkVertices)
 	{
+		std::vector<bool> isVertexRemoved(m_occtVertices.size(), false);
 		for (const Vertex::Ptr& kpVertex : rkVertices)
 		{
-			TopoDS_Vertex occtVertex = kpVertex->GetOcctVertex();
-
-			// Check if the connected vertices are connected to the vertex to be deleted. Remove it.
-			for (GraphMap::iterator graphIterator = m_graphDictionary.begin();
-				graphIterator != m_graphDictionary.end();
-				graphIterator++)
+			const int* kpVertexId = m_occtVertexIds.Seek(kpVertex->GetOcctVertex());
+			if (kpVertexId != nullptr)
 			{
-				TopTools_MapOfShape& rOcctConnectedVertices = graphIterator->second;
-				rOcctConnectedVertices.Remove(occtVertex);
-				TopoDS_Edge occtEdge = FindEdge(TopoDS::Vertex(graphIterator->first), occtVertex);
-				if (!occtEdge.IsNull())
-				{
-					m_occtEdges.Remove(occtEdge);
-				}
-			}
-
-			// Remove the entry from this map
-			GraphMap::iterator vertexIterator = m_graphDictionary.find(occtVertex);
-			if (vertexIterator != m_graphDictionary.end())
-			{
-				TopTools_MapOfShape& rOcctConnectedVertices = vertexIterator->second;
-				for (TopTools_MapIteratorOfMapOfShape occtConnectedVertexIterator(rOcctConnectedVertices);
-					occtConnectedVertexIterator.More();
-					occtConnectedVertexIterator.Next())
-				{
-					TopoDS_Edge occtEdge = FindEdge(occtVertex, TopoDS::Vertex(occtConnectedVertexIterator.Value()));
-					if (!occtEdge.IsNull())
-					{
-						m_occtEdges.Remove(occtEdge);
-					}
-				}
-
-				m_graphDictionary.erase(vertexIterator);
+				isVertexRemoved[*kpVertexId] = true;
 			}
 		}
+
+		RemoveIds(isVertexRemoved, std::vector<bool>(m_occtEdges.size(), false));
 	}
 
 	void Graph::RemoveEdges(const std::list<Edge::Ptr>& rkEdges, const double kTolerance)
@@ -1169,50 +1254,29 @@ namespace TopologicCore
 			return;
         }
 
+		std::vector<bool> isEdgeRemoved(m_occtEdges.size(), false);
 		for (const Edge::Ptr& kpEdge : rkEdges)
 		{
-			Vertex::Ptr startVertex = kpEdge->StartVertex();
-            TopoDS_Vertex occtQueryVertex1 = GetCoincidentVertex(startVertex->GetOcctVertex(), kTolerance);
-            if (occtQueryVertex1.IsNull())
-            {
-                continue;
-            }
-
-            Vertex::Ptr endVertex = kpEdge->EndVertex();
-            TopoDS_Vertex occtQueryVertex2 = GetCoincidentVertex(endVertex->GetOcctVertex(), kTolerance);
-            if (occtQueryVertex2.IsNull())
-            {
-                continue;
-            }
+			int startVertexId = FindVertexId(kpEdge->StartVertex()->GetOcctVertex(), kTolerance);
+			if (startVertexId < 0)
+			{
+				continue;
+			}
 
+			int endVertexId = FindVertexId(kpEdge->EndVertex()->GetOcctVertex(), kTolerance);
+			if (endVertexId < 0)
 			{
-				GraphMap::iterator startVertexIterator = m_graphDictionary.find(occtQueryVertex1);
-				if (startVertexIterator != m_graphDictionary.end())
-				{
-					TopTools_MapOfShape& adjacentVertices = startVertexIterator->second;
-					adjacentVertices.Remove(endVertex->GetOcctVertex());
-					TopoDS_Edge occtEdge = FindEdge(occtQueryVertex1, endVertex->GetOcctVertex());
-					if (!occtEdge.IsNull())
-					{
-						m_occtEdges.Remove(occtEdge);
-					}
-				}
+				continue;
 			}
 
+			int edgeId = FindEdgeId(startVertexId, endVertexId);
+			if (edgeId >= 0)
 			{
-				GraphMap::iterator endVertexIterator = m_graphDictionary.find(endVertex->GetOcctVertex());
-				if (endVertexIterator != m_graphDictionary.end())
-				{
-					TopTools_MapOfShape& adjacentVertices = endVertexIterator->second;
-					adjacentVertices.Remove(occtQueryVertex1);
-					TopoDS_Edge occtEdge = FindEdge(endVertex->GetOcctVertex(), occtQueryVertex1);
-					if (!occtEdge.IsNull())
-					{
-						m_occtEdges.Remove(occtEdge);
-					}
-				}
+				isEdgeRemoved[edgeId] = true;
 			}
 		}
+
+		RemoveIds(std::vector<bool>(m_occtVertices.size(), false), isEdgeRemoved);
 	}
 
 	void Graph::VerticesAtCoordinates(const double kX, const double kY, const double kZ, const double kTolerance, std::list<std::shared_ptr<Vertex>>& rVertices) const
@@ -1223,46 +1287,11 @@ namespace TopologicCore
 			return;
 		}
 
-        gp_Pnt occtQueryPoint(kX, kY, kZ);
-		//TopoDS_Vertex occtQueryVertex = BRepBuilderAPI_MakeVertex(gp_Pnt(kX, kY, kZ));
-		double absDistanceThreshold = std::abs(kTolerance);
-		for (GraphMap::const_iterator graphIterator = m_graphDictionary.begin();
-			graphIterator != m_graphDictionary.end();
-			graphIterator++)
-		{
-			TopoDS_Vertex currentVertex = graphIterator->first;
-            Handle(Geom_CartesianPoint) currentPoint = new Geom_CartesianPoint(BRep_Tool::Pnt(currentVertex));
-            /*BRepExtrema_DistShapeShape occtDistanceCalculation(rkVertex, currentVertex);
-            bool isDone = occtDistanceCalculation.Perform();
-            if (isDone)
-            {
-                double distance = occtDistanceCalculation.Value();
-                if (distance < absDistanceThreshold)
-                {
-                    return currentVertex;
-                }
-            }*/
-
-            double dx = (currentPoint->X() - occtQueryPoint.X());
-            double dy = (currentPoint->Y() - occtQueryPoint.Y());
-            double dz = (currentPoint->Z() - occtQueryPoint.Z());
-            double sqDistance = sqrt(dx * dx + dy * dy + dz * dz);
-            if (sqDistance < absDistanceThreshold)
-            {
-                Vertex::Ptr closestVertex = std::dynamic_pointer_cast<Vertex>(Topology::ByOcctShape(currentVertex));
-                rVertices.push_back(closestVertex);
-            }
-			//BRepExtrema_DistShapeShape occtDistanceCalculation(occtQueryVertex, currentVertex);
-			/*bool isDone = occtDistanceCalculation.Perform();
-			if (isDone)
-			{
-				double distance = occtDistanceCalculation.Value();
-				if (distance < absDistanceThreshold)
-				{
-					Vertex::Ptr closestVertex = std::dynamic_pointer_cast<Vertex>(Topology::ByOcctShape(currentVertex));
-					rVertices.push_back(closestVertex);
-				}
-			}*/
+		std::vector<int> vertexIds;
+		FindCoincidentVertexIds(gp_Pnt(kX, kY, kZ), kTolerance, vertexIds);
+		for (int vertexId : vertexIds)
+		{
+			rVertices.push_back(GetVertex(vertexId));
 		}
 	}
 
@@ -1274,58 +1303,36 @@ namespace TopologicCore
 			return nullptr;
 		}
 
-		TopoDS_Vertex occtQueryVertex1 = GetCoincidentVertex(kpVertex1->GetOcctVertex(), kTolerance);
-		if (occtQueryVertex1.IsNull())
-		{
-			return nullptr;
-		}
-		TopoDS_Vertex occtQueryVertex2 = GetCoincidentVertex(kpVertex2->GetOcctVertex(), kTolerance);
-		if (occtQueryVertex2.IsNull())
-		{
-			return nullptr;
-		}
-
-		GraphMap::const_iterator kAdjacentVerticesIterator1 = m_graphDictionary.find(occtQueryVertex1);
-		if (kAdjacentVerticesIterator1 == m_graphDictionary.end())
+		int vertexId1 = FindVertexId(kpVertex1->GetOcctVertex(), kTolerance);
+		if (vertexId1 < 0)
 		{
 			return nullptr;
 		}
-
-		TopTools_MapOfShape adjacentVerticesToVertex1 = kAdjacentVerticesIterator1->second;
-		if (!adjacentVerticesToVertex1.Contains(occtQueryVertex2))
+		int vertexId2 = FindVertexId(kpVertex2->GetOcctVertex(), kTolerance);
+		if (vertexId2 < 0)
 		{
 			return nullptr;
 		}
 
-		TopoDS_Edge occtEdge = FindEdge(occtQueryVertex1, occtQueryVertex2);
-		if (occtEdge.IsNull())
+		int edgeId = FindEdgeId(vertexId1, vertexId2);
+		if (edgeId < 0)
 		{
 			return nullptr;
 		}
-		return std::dynamic_pointer_cast<TopologicCore::Edge>(Topology::ByOcctShape(occtEdge));
+		return GetEdge(edgeId);
 	}
 
 	void Graph::IncidentEdges(const std::shared_ptr<Vertex>& kpVertex, const double kTolerance, std::list<std::shared_ptr<TopologicCore::Edge>>& rEdges) const
 	{
-		TopoDS_Vertex occtQueryVertex = GetCoincidentVertex(kpVertex->GetOcctVertex(), kTolerance);
-		if (occtQueryVertex.IsNull())
+		int vertexId = FindVertexId(kpVertex->GetOcctVertex(), kTolerance);
+		if (vertexId < 0)
 		{
 			return;
 		}
 
-		Vertex::Ptr queryVertex = std::dynamic_pointer_cast<Vertex>(Topology::ByOcctShape(occtQueryVertex));
-		std::list<Vertex::Ptr> adjacentVertices;
-		AdjacentVertices(queryVertex, adjacentVertices);
-		for (const Vertex::Ptr& kpAdjacentVertex : adjacentVertices)
+		for (const std::pair<int, int>& rkAdjacency : m_adjacency[vertexId])
 		{
-			TopoDS_Edge occtEdge = FindEdge(queryVertex->GetOcctVertex(), kpAdjacentVertex->GetOcctVertex());
-			if (occtEdge.IsNull())
-			{
-				continue;
-			}
-			Edge::Ptr edge = std::dynamic_pointer_cast<TopologicCore::Edge>(Topology::ByOcctShape(occtEdge));
-
-			rEdges.push_back(edge);
+			rEdges.push_back(GetEdge(rkAdjacency.second));
 		}
 	}
 
@@ -1454,7 +1461,7 @@ namespace TopologicCore
 						kTolerance);
 					AttributeManager::GetInstance().CopyAttributes(kpContent->GetOcctShape(), contentCenterOfMass->GetOcctShape());
 					vertices.push_back(contentCenterOfMass);
-					std::list<Vertex::Ptr> edgeVertices;
+					std::vector<Vertex::Ptr> edgeVertices;
 					kpEdge->Vertices(nullptr, edgeVertices);
 
 					for (const Vertex::Ptr& kpVertex : edgeVertices)
@@ -1492,7 +1499,7 @@ namespace TopologicCore
 				std::list<Topology::Ptr> contents;
 				kpEdge->Contents(contents);
 
-				std::list<Vertex::Ptr> edgeVertices;
+				std::vector<Vertex::Ptr> edgeVertices;
 				kpEdge->Vertices(nullptr, edgeVertices);
 
 				for (const Topology::Ptr& kpContent : contents)
@@ -1539,7 +1546,7 @@ namespace TopologicCore
 
 		if (kToExteriorTopologies || kToExteriorApertures)
 		{
-			std::list<Edge::Ptr> faceEdges;
+			std::vector<Edge::Ptr> faceEdges;
 			kpFace->Edges(nullptr, faceEdges);
 
 			for (const Edge::Ptr& kpFaceEdge : faceEdges)
@@ -1596,7 +1603,7 @@ namespace TopologicCore
 		//    there can be many shapes representing the same OCCT shapes.
 		std::map<TopoDS_Face, TopologicCore::Vertex::Ptr, TopologicCore::OcctShapeComparator> faceCentroids;
 
-		std::list<TopologicCore::Face::Ptr> faces;
+		std::vector<TopologicCore::Face::Ptr> faces;
 		kpShell->Faces(nullptr, faces);
 		for (const TopologicCore::Face::Ptr& kpFace : faces)
 		{
@@ -1639,7 +1646,7 @@ namespace TopologicCore
 			}
 		}
 
-		std::list<TopologicCore::Edge::Ptr> edges;
+		std::vector<TopologicCore::Edge::Ptr> edges;
 		kpShell->Edges(nullptr, edges);
 		for (const TopologicCore::Edge::Ptr& kpEdge : edges)
 		{
@@ -1696,7 +1703,7 @@ namespace TopologicCore
 		std::list<Vertex::Ptr> vertices;
 		for (const Topology::Ptr& kpEdgeTopology : graphEdges)
 		{
-			std::list<Vertex::Ptr> edgeVertices;
+			std::vector<Vertex::Ptr> edgeVertices;
 			kpEdgeTopology->Vertices(nullptr, edgeVertices);
 			for (const Vertex::Ptr& kpVertex : edgeVertices)
 			{
@@ -1720,7 +1727,7 @@ namespace TopologicCore
 		vertices.push_back(internalVertex);
 		if (kToExteriorTopologies || kToExteriorApertures)
 		{
-			std::list<Face::Ptr> cellFaces;
+			std::vector<Face::Ptr> cellFaces;
 			kpCell->Faces(nullptr, cellFaces);
 
 			for (const Face::Ptr& kpCellFace : cellFaces)
@@ -1767,134 +1774,82 @@ namespace TopologicCore
 		const bool kToExteriorTopologies,
 		const bool kToExteriorApertures,
 		const bool kUseFaceInternalVertex,
-		const double kTolerance)
+		const double kTolerance,
+		const ProgressMonitor::Ptr& kpProgressMonitor)
 	{
 		if (kpCellComplex == nullptr)
 		{
 			return nullptr;
 		}
 
-		// 1. Get the vertices mapped to their original topologies
+		// 1. Compute the Cell adjacency in one pass, and get the vertices mapped to their original topologies
 		//    - Cell --> centroid
-		//   Occt shapes must be used as the keys. Topologic shapes cannot be used because there can be many shapes representing the same OCCT shapes.
-		std::map<TopoDS_Solid, TopologicCore::Vertex::Ptr, TopologicCore::OcctShapeComparator> cellCentroids;
+		//   The Cells are identified by their indices in occtCells.
+		TopTools_IndexedMapOfShape occtCells;
+		TopTools_IndexedMapOfShape occtSharedFaces;
+		std::vector<int> adjacencyOffsets;
+		std::vector<int> adjacentCellIndices;
+		std::vector<int> sharedFaceIndices;
+		CellComplex::CellAdjacency(kpCellComplex->GetOcctShape(), occtCells, occtSharedFaces, adjacencyOffsets, adjacentCellIndices, sharedFaceIndices);
+
+		const int kNumOfCells = occtCells.Extent();
+		std::vector<TopologicCore::Vertex::Ptr> cellCentroids;
+		cellCentroids.reserve(kNumOfCells);
+		for (int i = 1; i <= kNumOfCells; ++i)
+		{
+			if (kpProgressMonitor != nullptr)
+			{
+				kpProgressMonitor->Report("Graph.ByTopology: Cells", 100.0 * (i - 1) / kNumOfCells);
+			}
 
-		std::list<TopologicCore::Cell::Ptr> cells;
-		kpCellComplex->Cells(nullptr, cells);
-		for (const TopologicCore::Cell::Ptr& kpCell : cells)
-		{
-			TopologicCore::Vertex::Ptr pCentroid = TopologicUtilities::CellUtility::InternalVertex(kpCell, kTolerance);
-			AttributeManager::GetInstance().CopyAttributes(kpCell->GetOcctShape(), pCentroid->GetOcctShape());
-			cellCentroids.insert(std::make_pair(kpCell->GetOcctSolid(), pCentroid));
+			TopologicCore::Cell::Ptr pCell = std::make_shared<Cell>(TopoDS::Solid(occtCells(i)));
+			TopologicCore::Vertex::Ptr pCentroid = TopologicUtilities::CellUtility::InternalVertex(pCell, kTolerance);
+			AttributeManager::GetInstance().CopyAttributes(pCell->GetOcctShape(), pCentroid->GetOcctShape());
+			cellCentroids.push_back(pCentroid);
 		}
 
-		// 2. If direct = true, check cellAdjacency.
+		// 2. If direct = true, create an edge for each pair of adjacent Cells. A pair sharing several Faces
+		//    has several entries in the adjacency list of the lower Cell, not necessarily consecutive ones;
+		//    lastVisitingCells records the last Cell an adjacent Cell was visited from, so only one edge is created.
 		std::list<TopologicCore::Edge::Ptr> edges;
 		if (kDirect)
 		{
-			TopTools_DataMapOfShapeListOfShape occtCellAdjacency;
-			for (const TopologicCore::Cell::Ptr& kpCell : cells)
+			std::vector<int> lastVisitingCells(kNumOfCells, -1);
+			for (int i = 0; i < kNumOfCells; ++i)
 			{
-				// Get faces
-				std::list<Face::Ptr> faces;
-				kpCell->Faces(nullptr, faces);
-
-				// Get adjacent cells. Only add here if the cell is not already added here, and 
-				// the reverse is not in occtCellAdjacency.
-				TopTools_ListOfShape occtCellUncheckedAdjacentCells;
-				for (const Face::Ptr& kpFace : faces)
+				for (int entry = adjacencyOffsets[i]; entry < adjacencyOffsets[i + 1]; ++entry)
 				{
-					std::list<TopologicCore::Cell::Ptr> currentFaceAdjacentCells;
-					TopologicUtilities::FaceUtility::AdjacentCells(kpFace, kpCellComplex, currentFaceAdjacentCells);
+					const int kAdjacentCellIndex = adjacentCellIndices[entry];
 
-					for (const Cell::Ptr& kpCurrentFaceAdjacentCell : currentFaceAdjacentCells)
+					// Each pair is visited from both ends; only create the edge from the lower index.
+					if (kAdjacentCellIndex <= i || lastVisitingCells[kAdjacentCellIndex] == i)
 					{
-						// The same as this Cell? Continue.
-						if (kpCurrentFaceAdjacentCell->IsSame(kpCell))
-						{
-							continue;
-						}
-
-						// Is Cell already added in this list (occtCellAdjacentCells)? Continue.
-						if (occtCellUncheckedAdjacentCells.Contains(kpCurrentFaceAdjacentCell->GetOcctShape()))
-						{
-							continue;
-						}
-
-						// Is the reverse already added in occtCellAdjacency? Continue.
-						try {
-							const TopTools_ListOfShape& reverseAdjacency = occtCellAdjacency.Find(kpCurrentFaceAdjacentCell->GetOcctShape());
-							if (reverseAdjacency.Contains(kpCell->GetOcctShape()))
-							{
-								continue;
-							}
-						}
-						catch (...)
-						{
-
-						}
-
-						// If passes the tests, add to occtCellUncheckedAdjacentCells
-						occtCellUncheckedAdjacentCells.Append(kpCurrentFaceAdjacentCell->GetOcctShape());
+						continue;
 					}
-				}
-
-				if (!occtCellUncheckedAdjacentCells.IsEmpty())
-				{
-					occtCellAdjacency.Bind(kpCell->GetOcctShape(), occtCellUncheckedAdjacentCells);
-				}
-			}
-
-
-			// Create the edges from the Cell adjacency information
-			for (TopTools_DataMapIteratorOfDataMapOfShapeListOfShape occtCellAdjacencyIterator(occtCellAdjacency);
-				occtCellAdjacencyIterator.More();
-				occtCellAdjacencyIterator.Next())
-			{
-				const TopoDS_Solid& rkOcctCell = TopoDS::Solid(occtCellAdjacencyIterator.Key());
-				Cell::Ptr pCell = std::make_shared<Cell>(rkOcctCell);
-				Vertex::Ptr pCellInternalVertex = nullptr;
-				try {
-					auto internalVertexIterator = cellCentroids.find(rkOcctCell);
-					pCellInternalVertex = internalVertexIterator->second;
-				}
-				catch (...)
-				{
-					assert(false);
-					// throw std::runtime_error("No Cell internal vertex pre-computed.");
-					return nullptr;
-				}
-				const TopTools_ListOfShape& rkOcctAdjacentCells = occtCellAdjacencyIterator.Value();
+					lastVisitingCells[kAdjacentCellIndex] = i;
 
-				for (TopTools_ListIteratorOfListOfShape occtAdjacentCellIterator(rkOcctAdjacentCells);
-					occtAdjacentCellIterator.More();
-					occtAdjacentCellIterator.Next())
-				{
-					const TopoDS_Solid& rkOcctAdjacentCell = TopoDS::Solid(occtAdjacentCellIterator.Value());
-					Cell::Ptr pAdjacentCell = std::make_shared<Cell>(rkOcctAdjacentCell);
-					Vertex::Ptr pAdjacentInternalVertex = nullptr;
-					try {
-						auto internalVertexIterator = cellCentroids.find(rkOcctAdjacentCell);
-						pAdjacentInternalVertex = internalVertexIterator->second;
-					}
-					catch (...)
-					{
-						assert(false);
-						// throw std::runtime_error("No Cell internal vertex pre-computed.");
-						return nullptr;
-					}
 					TopologicCore::Edge::Ptr pEdge = TopologicCore::Edge::ByStartVertexEndVertex(
-						pCellInternalVertex,
-						pAdjacentInternalVertex);
+						cellCentroids[i],
+						cellCentroids[kAdjacentCellIndex]);
 					edges.push_back(pEdge);
 				}
 			}
 		}
 
-		std::list<TopologicCore::Face::Ptr> faces;
+		// Get a map of Face->Solid[] once, instead of navigating upwards from each Face.
+		TopTools_IndexedDataMapOfShapeListOfShape occtFaceCellMap;
+		TopExp::MapShapesAndUniqueAncestors(kpCellComplex->GetOcctShape(), TopAbs_FACE, TopAbs_SOLID, occtFaceCellMap);
+
+		std::vector<TopologicCore::Face::Ptr> faces;
 		kpCellComplex->Faces(nullptr, faces);
+		int faceIndex = 0;
 		for (const TopologicCore::Face::Ptr& kpFace : faces)
 		{
+			if (kpProgressMonitor != nullptr)
+			{
+				kpProgressMonitor->Report("Graph.ByTopology: Faces", 100.0 * faceIndex++ / faces.size());
+			}
+
 			Vertex::Ptr internalVertex = nullptr;
 			if (kUseFaceInternalVertex)
 			{
@@ -1906,9 +1861,23 @@ namespace TopologicCore
 			}
 			AttributeManager::GetInstance().CopyAttributes(kpFace->GetOcctShape(), internalVertex->GetOcctShape());
 			
-			bool isManifold = kpFace->IsManifoldToTopology(kpCellComplex);
-			std::list<TopologicCore::Cell::Ptr> adjacentCells;
-            TopologicUtilities::FaceUtility::AdjacentCells(kpFace, kpCellComplex, adjacentCells);
+			// A manifold face has 0 or 1 cell.
+			std::list<int> faceAdjacentCellIndices;
+			const int kFaceIndex = occtFaceCellMap.FindIndex(kpFace->GetOcctShape());
+			if (kFaceIndex > 0)
+			{
+				for (TopTools_ListIteratorOfListOfShape occtAdjacentCellIterator(occtFaceCellMap(kFaceIndex));
+					occtAdjacentCellIterator.More();
+					occtAdjacentCellIterator.Next())
+				{
+					const int kCellIndex = occtCells.FindIndex(occtAdjacentCellIterator.Value());
+					if (kCellIndex > 0)
+					{
+						faceAdjacentCellIndices.push_back(kCellIndex - 1);
+					}
+				}
+			}
+			bool isManifold = faceAdjacentCellIndices.size() < 2;
 
 			std::list<Topology::Ptr> contents;
 			kpFace->Contents(contents);
@@ -1930,21 +1899,16 @@ namespace TopologicCore
 			}
 
 			// Check 
-			for (const TopologicCore::Cell::Ptr& kpAdjacentCell : adjacentCells)
+			for (const int kAdjacentCellIndex : faceAdjacentCellIndices)
 			{
+				const TopologicCore::Vertex::Ptr& kpAdjacentCellCentroid = cellCentroids[kAdjacentCellIndex];
 				if ((!isManifold && kViaSharedTopologies) // i.e. non-manifold faces
 					||
 					(isManifold && kToExteriorTopologies))
 				{
-					std::map<TopoDS_Solid, TopologicCore::Vertex::Ptr, TopologicCore::OcctShapeComparator>::iterator adjacentCellIterator =
-						cellCentroids.find(kpAdjacentCell->GetOcctSolid());
-					if (adjacentCellIterator == cellCentroids.end())
-					{
-						continue;
-					}
 					TopologicCore::Edge::Ptr pEdge = TopologicCore::Edge::ByStartVertexEndVertex(
 						internalVertex, 
-						adjacentCellIterator->second);
+						kpAdjacentCellCentroid);
 					if (pEdge != nullptr)
 					{
 						edges.push_back(pEdge);
@@ -1957,13 +1921,7 @@ namespace TopologicCore
 						||
 						(isManifold && kToExteriorApertures))
 					{
-						std::map<TopoDS_Solid, TopologicCore::Vertex::Ptr, TopologicCore::OcctShapeComparator>::iterator adjacentCellIterator =
-							cellCentroids.find(kpAdjacentCell->GetOcctSolid());
-						if (adjacentCellIterator == cellCentroids.end())
-						{
-							continue;
-						}
-						TopologicCore::Edge::Ptr pEdge = TopologicCore::Edge::ByStartVertexEndVertex(rkApertureCentroid, adjacentCellIterator->second);
+						TopologicCore::Edge::Ptr pEdge = TopologicCore::Edge::ByStartVertexEndVertex(rkApertureCentroid, kpAdjacentCellCentroid);
 						if (pEdge != nullptr)
 						{
 							edges.push_back(pEdge);
@@ -1975,7 +1933,7 @@ namespace TopologicCore
 		std::list<Vertex::Ptr> vertices;
 		for (const Edge::Ptr& kpEdgeTopology : edges)
 		{
-			std::list<Vertex::Ptr> edgeVertices;
+			std::vector<Vertex::Ptr> edgeVertices;
 			kpEdgeTopology->Vertices(nullptr, edgeVertices);
 			for (const Vertex::Ptr& kpVertex : edgeVertices)
 			{
@@ -1992,7 +1950,8 @@ namespace TopologicCore
 		const bool kToExteriorTopologies,
 		const bool kToExteriorApertures,
 		const bool kUseFaceInternalVertex,
-		const double kTolerance)
+		const double kTolerance,
+		const ProgressMonitor::Ptr& kpProgressMonitor)
 	{
 		std::list<Topology::Ptr> subtopologies;
 		cluster->SubTopologies(subtopologies);
@@ -2001,10 +1960,10 @@ namespace TopologicCore
 		for (const Topology::Ptr& kpSubtopology : subtopologies)
 		{
 			Graph::Ptr graph = Graph::ByTopology(
-				kpSubtopology, kDirect, kViaSharedTopologies, kViaSharedApertures, kToExteriorTopologies, kToExteriorApertures, kUseFaceInternalVertex, kTolerance);
-			std::list<Vertex::Ptr> subtopologyVertices;
+				kpSubtopology, kDirect, kViaSharedTopologies, kViaSharedApertures, kToExteriorTopologies, kToExteriorApertures, kUseFaceInternalVertex, kTolerance, kpProgressMonitor);
+			std::vector<Vertex::Ptr> subtopologyVertices;
 			graph->Vertices(subtopologyVertices);
-			std::list<Edge::Ptr> subtopologyEdges;
+			std::vector<Edge::Ptr> subtopologyEdges;
 			graph->Edges(subtopologyEdges);
 			vertices.insert(vertices.end(), subtopologyVertices.begin(), subtopologyVertices.end());
 			edges.insert(edges.end(), subtopologyEdges.begin(), subtopologyEdges.end());
@@ -2019,8 +1978,8 @@ namespace TopologicCore
 	}
 
 	std::shared_ptr<Wire> Graph::ConstructPath(
-		const std::list<Vertex::Ptr>& rkPathVertices, 
-		const bool kUseTimeLimit, 
+		const std::list<Vertex::Ptr>& rkPathVertices,
+		const bool kUseTimeLimit,
 		const int kTimeLimitInSeconds,
 		const std::chrono::system_clock::time_point& rkStartingTime) const
 	{
@@ -2064,59 +2023,145 @@ namespace TopologicCore
 		return pathWire;
 	}
 
-	bool Graph::IsDegreeSequence(const std::list<int>& rkSequence) const
+	std::shared_ptr<Wire> Graph::ConstructPath(const std::vector<int>& rkPathVertexIds) const
 	{
-		std::list<int>::const_iterator beforeEndIterator = rkSequence.end();
-		beforeEndIterator--;
-
-		for(std::list<int>::const_iterator sequenceIterator = rkSequence.begin();
-			sequenceIterator != beforeEndIterator;
-			sequenceIterator++)
+		std::list<Edge::Ptr> edges;
+		for (size_t i = 1; i < rkPathVertexIds.size(); ++i)
 		{
-			std::list<int>::const_iterator nextIterator = sequenceIterator;
-			nextIterator++;
-
-			if (*nextIterator > *sequenceIterator)
+			int edgeId = FindEdgeId(rkPathVertexIds[i - 1], rkPathVertexIds[i]);
+			if (edgeId >= 0)
 			{
-				return false;
+				edges.push_back(GetEdge(edgeId));
+			}
+			else
+			{
+				edges.push_back(Edge::ByStartVertexEndVertex(GetVertex(rkPathVertexIds[i - 1]), GetVertex(rkPathVertexIds[i])));
 			}
 		}
-
-		return true;
-	}
-
-	TopoDS_Vertex Graph::GetCoincidentVertex(const TopoDS_Vertex & rkVertex, const double kTolerance) const
-    {
-        Handle(Geom_CartesianPoint) point = new Geom_CartesianPoint(BRep_Tool::Pnt(rkVertex));
-		double absDistanceThreshold = std::abs(kTolerance);
-		for (GraphMap::const_iterator graphIterator = m_graphDictionary.begin();
-			graphIterator != m_graphDictionary.end();
-			graphIterator++)
-		{
-			TopoDS_Vertex currentVertex = graphIterator->first;
-            Handle(Geom_CartesianPoint) currentPoint = new Geom_CartesianPoint(BRep_Tool::Pnt(currentVertex));
-            /*BRepExtrema_DistShapeShape occtDistanceCalculation(rkVertex, currentVertex);
-			bool isDone = occtDistanceCalculation.Perform();
-			if (isDone)
-			{
-				double distance = occtDistanceCalculation.Value();
-				if (distance < absDistanceThreshold)
+		if (edges.empty())
+		{
+			return nullptr;
+		}
+		return Wire::ByEdges(edges);
+	}
+
+	int Graph::EnumeratePaths(
+		const int kStartVertexId,
+		const int kEndVertexId,
+		const int kMaxNumberOfPaths,
+		const int kMaxNumberOfEdges,
+		const bool kUseTimeLimit,
+		const double kTimeLimitInSeconds,
+		const std::chrono::system_clock::time_point& rkStartingTime,
+		std::vector<bool>& rIsOnPath,
+		std::vector<int>& rPathVertexIds,
+		const PathCallback& rkCallback) const
+	{
+		const CompactAdjacency& rkAdjacency = GetCompactAdjacency();
+		const size_t kNumOfRootVertices = rPathVertexIds.size();
+		int numOfPaths = 0;
+
+		rPathVertexIds.push_back(kStartVertexId);
+		if (kStartVertexId == kEndVertexId)
+		{
+			rkCallback(rPathVertexIds);
+			rPathVertexIds.pop_back();
+			return 1;
+		}
+
+		// The position in the adjacency of each Vertex of the path from which its next adjacent Vertex is tried
+		std::vector<int> nextAdjacencyIndices;
+		rIsOnPath[kStartVertexId] = true;
+		nextAdjacencyIndices.push_back(rkAdjacency.offsets[kStartVertexId]);
+		for (int numOfSteps = 1; !nextAdjacencyIndices.empty(); ++numOfSteps)
+		{
+			// The clock is only read every 1024 steps.
+			if (kUseTimeLimit && (numOfSteps & 1023) == 0 &&
+				std::chrono::duration<double>(std::chrono::system_clock::now() - rkStartingTime).count() >= kTimeLimitInSeconds)
+			{
+				break;
+			}
+
+			int vertexId = rPathVertexIds.back();
+			int adjacencyIndex = nextAdjacencyIndices.back();
+			if (adjacencyIndex == rkAdjacency.offsets[vertexId + 1])
+			{
+				rIsOnPath[vertexId] = false;
+				rPathVertexIds.pop_back();
+				nextAdjacencyIndices.pop_back();
+				continue;
+			}
+			++nextAdjacencyIndices.back();
+
+			int adjacentVertexId = rkAdjacency.adjacentVertexIds[adjacencyIndex];
+			if (rIsOnPath[adjacentVertexId])
+			{
+				continue;
+			}
+
+			if (adjacentVertexId == kEndVertexId)
+			{
+				rPathVertexIds.push_back(kEndVertexId);
+				bool isContinued = rkCallback(rPathVertexIds);
+				rPathVertexIds.pop_back();
+				++numOfPaths;
+				if (!isContinued || (kMaxNumberOfPaths > 0 && numOfPaths >= kMaxNumberOfPaths))
 				{
-					return currentVertex;
+					break;
 				}
-			}*/
+				continue;
+			}
 
-            double dx = (currentPoint->X() - point->X());
-            double dy = (currentPoint->Y() - point->Y());
-            double dz = (currentPoint->Z() - point->Z());
-            double sqDistance = dx*dx + dy*dy + dz*dz;
-            if (sqDistance < absDistanceThreshold)
-            {
-                return currentVertex;
-            }
+			// Going through the adjacent Vertex takes at least two more Edges to reach the end Vertex.
+			int numOfEdges = (int)(rPathVertexIds.size() - kNumOfRootVertices) - 1;
+			if (kMaxNumberOfEdges > 0 && numOfEdges + 2 > kMaxNumberOfEdges)
+			{
+				continue;
+			}
+
+			rIsOnPath[adjacentVertexId] = true;
+			rPathVertexIds.push_back(adjacentVertexId);
+			nextAdjacencyIndices.push_back(rkAdjacency.offsets[adjacentVertexId]);
+		}
+
+		// Restore the path if the search stopped early.
+		for (size_t i = kNumOfRootVertices; i < rPathVertexIds.size(); ++i)
+		{
+			rIsOnPath[rPathVertexIds[i]] = false;
 		}
+		rPathVertexIds.resize(kNumOfRootVertices);
+		return numOfPaths;
+	}
+
+	bool Graph::IsDegreeSequence(const std::list<int>& rkSequence) const
+	{
+		std::list<int>::const_iterator beforeEndIterator = rkSequence.end();
+		beforeEndIterator--;
 
-		return TopoDS_Vertex(); // null vertex
+		for(std::list<int>::const_iterator sequenceIterator = rkSequence.begin();
+			sequenceIterator != beforeEndIterator;
+			sequenceIterator++)
+		{
+			std::list<int>::const_iterator nextIterator = sequenceIterator;
+			nextIterator++;
+
+			if (*nextIterator > *sequenceIterator)
+			{
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	TopoDS_Vertex Graph::GetCoincidentVertex(const TopoDS_Vertex & rkVertex, const double kTolerance) const
+	{
+		int vertexId = FindCoincidentVertexId(BRep_Tool::Pnt(rkVertex), kTolerance);
+		if (vertexId < 0)
+		{
+			return TopoDS_Vertex(); // null vertex
+		}
+		return m_occtVertices[vertexId];
 	}
 
 	double Graph::ComputeCost(const TopoDS_Vertex & rkVertex1, const TopoDS_Vertex & rkVertex2, const std::string & rkVertexKey, const std::string & rkEdgeKey) const
@@ -2146,6 +2191,10 @@ namespace TopologicCore
 		}
 
 		AttributeManager::AttributeMap::iterator attributeIterator = attributeMap.find(rkVertexKey);
+		if (attributeIterator == attributeMap.end())
+		{
+			return 0.0;
+		}
 		Attribute::Ptr attribute = attributeIterator->second;
 
 		// Only add if double or int
@@ -2167,108 +2216,964 @@ namespace TopologicCore
 	double Graph::ComputeEdgeCost(const TopoDS_Vertex & rkVertex1, const TopoDS_Vertex & rkVertex2, const std::string & rkEdgeKey) const
 	{
 		// Check: if not connected, return the largest double value
-		if (!ContainsEdge(rkVertex1, rkVertex2, 0.0001))
+		int vertexId1 = FindVertexId(rkVertex1, 0.0001);
+		int vertexId2 = FindVertexId(rkVertex2, 0.0001);
+		int edgeId = vertexId1 < 0 || vertexId2 < 0 ? -1 : FindEdgeId(vertexId1, vertexId2);
+		if (edgeId < 0)
 		{
 			return std::numeric_limits<double>::max();
 		}
-		else
+
+		return ComputeEdgeCost(edgeId, rkEdgeKey);
+	}
+
+	double Graph::ComputeEdgeCost(const int kEdgeId, const std::string & rkEdgeKey) const
+	{
+		// Check edge key
+		if (rkEdgeKey.compare("") == 0)
+		{
+			return 1.0;
+		}
+
+		AttributeManager::AttributeMap attributeMap;
+		AttributeManager::GetInstance().FindAll(m_occtEdges[kEdgeId], attributeMap);
+		std::string lowercaseEdgeKey = rkEdgeKey;
+		std::transform(lowercaseEdgeKey.begin(), lowercaseEdgeKey.end(), lowercaseEdgeKey.begin(), ::tolower);
+		AttributeManager::AttributeMap::iterator attributeIterator = attributeMap.find(lowercaseEdgeKey);
+		if (attributeIterator == attributeMap.end())
 		{
-			// Check edge key
-			if (rkEdgeKey.compare("") == 0)
+			if ((lowercaseEdgeKey.compare("distance") == 0 || lowercaseEdgeKey.compare("length") == 0)) // no attribute with this name is found
 			{
-				return 1.0;
+				return m_edgeLengths[kEdgeId];
 			}
 			else
 			{
-				TopoDS_Edge occtEdge = FindEdge(rkVertex1, rkVertex2);
-				if (occtEdge.IsNull())
+				return 1.0;
+			}
+		}
+
+		Attribute::Ptr attribute = attributeIterator->second;
+
+		// Only add if double or int
+		DoubleAttribute::Ptr doubleAttribute = std::dynamic_pointer_cast<DoubleAttribute>(attribute);
+		if (doubleAttribute != nullptr)
+		{
+			return doubleAttribute->DoubleValue();
+		}
+
+		IntAttribute::Ptr intAttribute = std::dynamic_pointer_cast<IntAttribute>(attribute);
+		if (intAttribute != nullptr)
+		{
+			return (double) intAttribute->IntValue();
+		}
+
+		return 1.0;
+	}
+
+	void Graph::VertexCosts(const std::string& rkVertexKey, std::vector<double>& rVertexCosts) const
+	{
+		rVertexCosts.assign(m_occtVertices.size(), 0.0);
+		if (rkVertexKey.compare("") == 0)
+		{
+			return;
+		}
+
+		for (int vertexId = 0; vertexId < (int)m_occtVertices.size(); ++vertexId)
+		{
+			rVertexCosts[vertexId] = ComputeVertexCost(m_occtVertices[vertexId], rkVertexKey);
+		}
+	}
+
+	void Graph::EdgeCosts(const std::string& rkEdgeKey, std::vector<double>& rEdgeCosts) const
+	{
+		rEdgeCosts.assign(m_occtEdges.size(), 1.0);
+		if (rkEdgeKey.compare("") == 0)
+		{
+			return;
+		}
+
+		for (int edgeId = 0; edgeId < (int)m_occtEdges.size(); ++edgeId)
+		{
+			rEdgeCosts[edgeId] = ComputeEdgeCost(edgeId, rkEdgeKey);
+		}
+	}
+
+	TopoDS_Edge Graph::FindEdge(const TopoDS_Vertex & rkVertex1, const TopoDS_Vertex & rkVertex2, const double kTolerance) const
+	{
+		int vertexId1 = FindVertexId(rkVertex1, kTolerance);
+		if (vertexId1 < 0)
+		{
+			return TopoDS_Edge();
+		}
+		int vertexId2 = FindVertexId(rkVertex2, kTolerance);
+		if (vertexId2 < 0)
+		{
+			return TopoDS_Edge();
+		}
+
+		int edgeId = FindEdgeId(vertexId1, vertexId2);
+		if (edgeId < 0)
+		{
+			return TopoDS_Edge();
+		}
+		return m_occtEdges[edgeId];
+	}
+
+	bool Graph::IsCoincident(const TopoDS_Vertex & rkVertex1, const TopoDS_Vertex & rkVertex2, const double kTolerance)
+	{
+		//BRepExtrema_DistShapeShape occtDistanceCalculation(rkVertex1, rkVertex2);
+		//bool isDone = occtDistanceCalculation.Perform();
+		//if (isDone)
+
+
+        Handle(Geom_CartesianPoint) point1 = new Geom_CartesianPoint(BRep_Tool::Pnt(rkVertex1));
+        Handle(Geom_CartesianPoint) point2 = new Geom_CartesianPoint(BRep_Tool::Pnt(rkVertex2));
+
+        double dx = (point2->X() - point1->X());
+        double dy = (point2->Y() - point1->Y());
+        double dz = (point2->Z() - point1->Z());
+        double sqDistance = dx * dx + dy * dy + dz * dz;
+        if (sqDistance < kTolerance * kTolerance)
+		{
+			/*double distance = occtDistanceCalculation.Value();
+			if (distance < kTolerance)
+			{*/
+				return true;
+			//}
+		}
+
+		return false;
+	}
+
+	int Graph::FindVertexId(const TopoDS_Vertex& rkOcctVertex, const double kTolerance) const
+	{
+		const int* kpVertexId = m_occtVertexIds.Seek(rkOcctVertex);
+		if (kpVertexId != nullptr)
+		{
+			return *kpVertexId;
+		}
+
+		return FindCoincidentVertexId(BRep_Tool::Pnt(rkOcctVertex), kTolerance);
+	}
+
+	int Graph::FindCoincidentVertexId(const gp_Pnt& rkOcctPoint, const double kTolerance) const
+	{
+		std::vector<int> vertexIds;
+		FindCoincidentVertexIds(rkOcctPoint, kTolerance, vertexIds);
+		if (vertexIds.empty())
+		{
+			return -1;
+		}
+
+		return vertexIds.front();
+	}
+
+	void Graph::FindCoincidentVertexIds(const gp_Pnt& rkOcctPoint, const double kTolerance, std::vector<int>& rVertexIds) const
+	{
+		double absDistanceThreshold = std::abs(kTolerance);
+		double sqDistanceThreshold = absDistanceThreshold * absDistanceThreshold;
+		auto isCoincident = [&](const int kVertexId)
+		{
+			double dx = m_vertexCoordinates[3 * kVertexId] - rkOcctPoint.X();
+			double dy = m_vertexCoordinates[3 * kVertexId + 1] - rkOcctPoint.Y();
+			double dz = m_vertexCoordinates[3 * kVertexId + 2] - rkOcctPoint.Z();
+			return dx * dx + dy * dy + dz * dz < sqDistanceThreshold;
+		};
+
+		// The cells which the tolerance sphere overlaps
+		long long minCell[3], maxCell[3];
+		for (int i = 0; i < 3; ++i)
+		{
+			minCell[i] = (long long)std::floor((rkOcctPoint.Coord(i + 1) - absDistanceThreshold) / m_vertexGridCellSize);
+			maxCell[i] = (long long)std::floor((rkOcctPoint.Coord(i + 1) + absDistanceThreshold) / m_vertexGridCellSize);
+		}
+
+		// A tolerance much larger than the cells would visit too many of them, so check all the Vertices instead.
+		const long long kMaxCellsPerAxis = 5;
+		if (maxCell[0] - minCell[0] >= kMaxCellsPerAxis || maxCell[1] - minCell[1] >= kMaxCellsPerAxis || maxCell[2] - minCell[2] >= kMaxCellsPerAxis)
+		{
+			for (int vertexId = 0; vertexId < (int)m_occtVertices.size(); ++vertexId)
+			{
+				if (isCoincident(vertexId))
+				{
+					rVertexIds.push_back(vertexId);
+				}
+			}
+			return;
+		}
+
+		for (long long x = minCell[0]; x <= maxCell[0]; ++x)
+		{
+			for (long long y = minCell[1]; y <= maxCell[1]; ++y)
+			{
+				for (long long z = minCell[2]; z <= maxCell[2]; ++z)
+				{
+					std::unordered_map<std::uint64_t, std::vector<int>>::const_iterator kCellIterator = m_vertexGrid.find(VertexGridKey(x, y, z));
+					if (kCellIterator == m_vertexGrid.end())
+					{
+						continue;
+					}
+
+					for (int vertexId : kCellIterator->second)
+					{
+						if (isCoincident(vertexId))
+						{
+							rVertexIds.push_back(vertexId);
+						}
+					}
+				}
+			}
+		}
+
+		std::sort(rVertexIds.begin(), rVertexIds.end());
+	}
+
+	void Graph::SetVertexGridCellSize(const double kCellSize)
+	{
+		m_vertexGridCellSize = kCellSize;
+		m_vertexGrid.clear();
+		for (int vertexId = 0; vertexId < (int)m_occtVertices.size(); ++vertexId)
+		{
+			m_vertexGrid[VertexGridKey(
+				(long long)std::floor(m_vertexCoordinates[3 * vertexId] / m_vertexGridCellSize),
+				(long long)std::floor(m_vertexCoordinates[3 * vertexId + 1] / m_vertexGridCellSize),
+				(long long)std::floor(m_vertexCoordinates[3 * vertexId + 2] / m_vertexGridCellSize))].push_back(vertexId);
+		}
+	}
+
+	std::uint64_t Graph::VertexGridKey(const long long kX, const long long kY, const long long kZ)
+	{
+		// 21 bits per axis. Far cells which wrap around to the same key only add candidates, which are then checked.
+		const std::uint64_t kMask = (1ULL << 21) - 1;
+		return (((std::uint64_t)kX & kMask) << 42) | (((std::uint64_t)kY & kMask) << 21) | ((std::uint64_t)kZ & kMask);
+	}
+
+	int Graph::FindEdgeId(const int kVertexId1, const int kVertexId2) const
+	{
+		std::unordered_map<std::uint64_t, int>::const_iterator kEdgeIdIterator = m_edgeIds.find(VertexPairKey(kVertexId1, kVertexId2));
+		if (kEdgeIdIterator == m_edgeIds.end())
+		{
+			return -1;
+		}
+
+		return kEdgeIdIterator->second;
+	}
+
+	std::uint64_t Graph::VertexPairKey(const int kVertexId1, const int kVertexId2)
+	{
+		std::uint64_t lowerVertexId = (std::uint32_t)std::min(kVertexId1, kVertexId2);
+		std::uint64_t higherVertexId = (std::uint32_t)std::max(kVertexId1, kVertexId2);
+		return (lowerVertexId << 32) | higherVertexId;
+	}
+
+	int Graph::AddVertex(const TopoDS_Vertex& rkOcctVertex)
+	{
+		int vertexId = (int)m_occtVertices.size();
+		gp_Pnt occtPoint = BRep_Tool::Pnt(rkOcctVertex);
+		m_occtVertices.push_back(rkOcctVertex);
+		m_vertexCoordinates.push_back(occtPoint.X());
+		m_vertexCoordinates.push_back(occtPoint.Y());
+		m_vertexCoordinates.push_back(occtPoint.Z());
+		m_occtVertexIds.Bind(rkOcctVertex, vertexId);
+		m_vertexGrid[VertexGridKey(
+			(long long)std::floor(occtPoint.X() / m_vertexGridCellSize),
+			(long long)std::floor(occtPoint.Y() / m_vertexGridCellSize),
+			(long long)std::floor(occtPoint.Z() / m_vertexGridCellSize))].push_back(vertexId);
+		m_adjacency.push_back(std::vector<std::pair<int, int>>());
+		m_isCompactAdjacencyValid = false;
+		return vertexId;
+	}
+
+	int Graph::AddEdge(const int kVertexId1, const int kVertexId2, const TopoDS_Edge& rkOcctEdge)
+	{
+		int edgeId = (int)m_occtEdges.size();
+		m_occtEdges.push_back(rkOcctEdge);
+		m_edgeVertexIds.push_back(std::make_pair(kVertexId1, kVertexId2));
+
+		const double* kpCoordinates1 = &m_vertexCoordinates[3 * kVertexId1];
+		const double* kpCoordinates2 = &m_vertexCoordinates[3 * kVertexId2];
+		double dx = kpCoordinates2[0] - kpCoordinates1[0];
+		double dy = kpCoordinates2[1] - kpCoordinates1[1];
+		double dz = kpCoordinates2[2] - kpCoordinates1[2];
+		m_edgeLengths.push_back(sqrt(dx * dx + dy * dy + dz * dz));
+		m_edgeIds[VertexPairKey(kVertexId1, kVertexId2)] = edgeId;
+
+		m_adjacency[kVertexId1].push_back(std::make_pair(kVertexId2, edgeId));
+		if (kVertexId1 != kVertexId2)
+		{
+			m_adjacency[kVertexId2].push_back(std::make_pair(kVertexId1, edgeId));
+		}
+		m_isCompactAdjacencyValid = false;
+		return edgeId;
+	}
+
+	void Graph::RemoveIds(const std::vector<bool>& rkIsVertexRemoved, const std::vector<bool>& rkIsEdgeRemoved)
+	{
+		// 1. Renumber the remaining vertices.
+		std::vector<int> newVertexIds(m_occtVertices.size(), -1);
+		std::vector<TopoDS_Vertex> occtVertices;
+		std::vector<double> vertexCoordinates;
+		m_occtVertexIds.Clear();
+		for (int vertexId = 0; vertexId < (int)m_occtVertices.size(); ++vertexId)
+		{
+			if (rkIsVertexRemoved[vertexId])
+			{
+				continue;
+			}
+
+			newVertexIds[vertexId] = (int)occtVertices.size();
+			m_occtVertexIds.Bind(m_occtVertices[vertexId], newVertexIds[vertexId]);
+			occtVertices.push_back(m_occtVertices[vertexId]);
+			vertexCoordinates.insert(vertexCoordinates.end(), m_vertexCoordinates.begin() + 3 * vertexId, m_vertexCoordinates.begin() + 3 * vertexId + 3);
+		}
+
+		// 2. Keep the edges which are not removed and whose vertices remain.
+		std::vector<TopoDS_Edge> occtEdges;
+		std::vector<std::pair<int, int>> edgeVertexIds;
+		std::vector<double> edgeLengths;
+		for (int edgeId = 0; edgeId < (int)m_occtEdges.size(); ++edgeId)
+		{
+			int vertexId1 = newVertexIds[m_edgeVertexIds[edgeId].first];
+			int vertexId2 = newVertexIds[m_edgeVertexIds[edgeId].second];
+			if (rkIsEdgeRemoved[edgeId] || vertexId1 < 0 || vertexId2 < 0)
+			{
+				continue;
+			}
+
+			occtEdges.push_back(m_occtEdges[edgeId]);
+			edgeVertexIds.push_back(std::make_pair(vertexId1, vertexId2));
+			edgeLengths.push_back(m_edgeLengths[edgeId]);
+		}
+
+		m_occtVertices.swap(occtVertices);
+		m_vertexCoordinates.swap(vertexCoordinates);
+		SetVertexGridCellSize(m_vertexGridCellSize);
+		m_occtEdges.swap(occtEdges);
+		m_edgeVertexIds.swap(edgeVertexIds);
+		m_edgeLengths.swap(edgeLengths);
+
+		// 3. Rebuild the adjacency, in the order of the edge IDs, and the edge lookup.
+		m_adjacency.assign(m_occtVertices.size(), std::vector<std::pair<int, int>>());
+		m_edgeIds.clear();
+		for (int edgeId = 0; edgeId < (int)m_occtEdges.size(); ++edgeId)
+		{
+			const std::pair<int, int>& rkEdgeVertexIds = m_edgeVertexIds[edgeId];
+			m_edgeIds[VertexPairKey(rkEdgeVertexIds.first, rkEdgeVertexIds.second)] = edgeId;
+			m_adjacency[rkEdgeVertexIds.first].push_back(std::make_pair(rkEdgeVertexIds.second, edgeId));
+			if (rkEdgeVertexIds.first != rkEdgeVertexIds.second)
+			{
+				m_adjacency[rkEdgeVertexIds.second].push_back(std::make_pair(rkEdgeVertexIds.first, edgeId));
+			}
+		}
+		m_isCompactAdjacencyValid = false;
+	}
+
+	int Graph::VertexDegree(const int kVertexId) const
+	{
+		// A self-loop counts twice.
+		int degree = (int)m_adjacency[kVertexId].size();
+		for (const std::pair<int, int>& rkAdjacency : m_adjacency[kVertexId])
+		{
+			if (rkAdjacency.first == kVertexId)
+			{
+				++degree;
+			}
+		}
+		return degree;
+	}
+
+	void Graph::TopologicalDistances(const int kStartVertexId, const int kEndVertexId, std::vector<int>& rDistances) const
+	{
+		// Use Breadth-First Search
+		const CompactAdjacency& rkAdjacency = GetCompactAdjacency();
+		rDistances.assign(m_occtVertices.size(), -1);
+		rDistances[kStartVertexId] = 0;
+		if (kStartVertexId == kEndVertexId)
+		{
+			return;
+		}
+
+		std::vector<int> vertexQueue;
+		vertexQueue.reserve(m_occtVertices.size());
+		vertexQueue.push_back(kStartVertexId);
+		for (size_t queueIndex = 0; queueIndex < vertexQueue.size(); ++queueIndex)
+		{
+			int vertexId = vertexQueue[queueIndex];
+			for (int i = rkAdjacency.offsets[vertexId]; i < rkAdjacency.offsets[vertexId + 1]; ++i)
+			{
+				int adjacentVertexId = rkAdjacency.adjacentVertexIds[i];
+				if (rDistances[adjacentVertexId] >= 0)
+				{
+					continue;
+				}
+
+				rDistances[adjacentVertexId] = rDistances[vertexId] + 1;
+				if (adjacentVertexId == kEndVertexId)
+				{
+					return;
+				}
+				vertexQueue.push_back(adjacentVertexId);
+			}
+		}
+	}
+
+	void Graph::ShortestDistances(
+		const int kStartVertexId,
+		const int kEndVertexId,
+		const std::vector<double>& rkVertexCosts,
+		const std::vector<double>& rkEdgeCosts,
+		std::vector<double>& rDistances,
+		std::vector<int>& rParentVertexIds,
+		const double kHeuristicScale) const
+	{
+		// Dijkstra's: https://en.wikipedia.org/wiki/Dijkstra%27s_algorithm#Using_a_priority_queue
+		// A*: https://en.wikipedia.org/wiki/A*_search_algorithm
+		const CompactAdjacency& rkAdjacency = GetCompactAdjacency();
+		const double kInfiniteDistance = std::numeric_limits<double>::max();
+		rDistances.assign(m_occtVertices.size(), kInfiniteDistance);
+		rParentVertexIds.assign(m_occtVertices.size(), -1);
+		rDistances[kStartVertexId] = 0.0;
+
+		const bool kUseHeuristic = kEndVertexId >= 0 && kHeuristicScale > 0.0;
+		const double* kpEndCoordinates = kUseHeuristic ? &m_vertexCoordinates[3 * kEndVertexId] : nullptr;
+		auto estimateRemainingCost = [&](const int kVertexId)
+		{
+			if (!kUseHeuristic)
+			{
+				return 0.0;
+			}
+			const double* kpCoordinates = &m_vertexCoordinates[3 * kVertexId];
+			double dx = kpEndCoordinates[0] - kpCoordinates[0];
+			double dy = kpEndCoordinates[1] - kpCoordinates[1];
+			double dz = kpEndCoordinates[2] - kpCoordinates[2];
+			return kHeuristicScale * sqrt(dx * dx + dy * dy + dz * dz);
+		};
+
+		VertexHeap vertexHeap((int)m_occtVertices.size());
+		vertexHeap.Push(kStartVertexId, estimateRemainingCost(kStartVertexId));
+		while (!vertexHeap.IsEmpty())
+		{
+			int vertexId = vertexHeap.Pop();
+			if (vertexId == kEndVertexId)
+			{
+				return;
+			}
+
+			for (int i = rkAdjacency.offsets[vertexId]; i < rkAdjacency.offsets[vertexId + 1]; ++i)
+			{
+				int adjacentVertexId = rkAdjacency.adjacentVertexIds[i];
+				double edgeCost = rkEdgeCosts[rkAdjacency.edgeIds[i]];
+				if (adjacentVertexId == vertexId || edgeCost >= kInfiniteDistance)
+				{
+					continue;
+				}
+
+				double alternativeDistance = rDistances[vertexId] + edgeCost + rkVertexCosts[adjacentVertexId];
+				if (alternativeDistance < rDistances[adjacentVertexId])
+				{
+					rDistances[adjacentVertexId] = alternativeDistance;
+					rParentVertexIds[adjacentVertexId] = vertexId;
+					vertexHeap.Push(adjacentVertexId, alternativeDistance + estimateRemainingCost(adjacentVertexId));
+				}
+			}
+		}
+	}
+
+	double Graph::HeuristicScale(const std::vector<double>& rkVertexCosts, const std::vector<double>& rkEdgeCosts) const
+	{
+		// Entering a Vertex only adds to the cost of a path, unless its cost is negative.
+		for (double vertexCost : rkVertexCosts)
+		{
+			if (vertexCost < 0.0)
+			{
+				return 0.0;
+			}
+		}
+
+		double heuristicScale = std::numeric_limits<double>::max();
+		for (int edgeId = 0; edgeId < (int)m_occtEdges.size(); ++edgeId)
+		{
+			if (rkEdgeCosts[edgeId] < 0.0)
+			{
+				return 0.0;
+			}
+
+			// An untraversable Edge and one between coincident Vertices do not bound the scale.
+			if (rkEdgeCosts[edgeId] >= std::numeric_limits<double>::max() || m_edgeLengths[edgeId] <= 0.0)
+			{
+				continue;
+			}
+			heuristicScale = std::min(heuristicScale, rkEdgeCosts[edgeId] / m_edgeLengths[edgeId]);
+		}
+		return heuristicScale < std::numeric_limits<double>::max() ? heuristicScale : 0.0;
+	}
+
+	void Graph::YenShortestPaths(
+		const int kStartVertexId,
+		const int kEndVertexId,
+		const std::vector<double>& rkVertexCosts,
+		const std::vector<double>& rkEdgeCosts,
+		const int kMaxNumberOfPaths,
+		const double kMaxCost,
+		const bool kUseTimeLimit,
+		const int kTimeLimitInSeconds,
+		std::vector<std::vector<int>>& rPathVertexIds,
+		std::vector<double>& rPathCosts) const
+	{
+		// Yen's: https://en.wikipedia.org/wiki/Yen%27s_algorithm
+		rPathVertexIds.clear();
+		rPathCosts.clear();
+		if (kMaxNumberOfPaths <= 0)
+		{
+			return;
+		}
+
+		auto startingTime = std::chrono::system_clock::now();
+		const CompactAdjacency& rkAdjacency = GetCompactAdjacency();
+		const double kInfiniteDistance = std::numeric_limits<double>::max();
+		const double kHeuristicScale = HeuristicScale(rkVertexCosts, rkEdgeCosts);
+
+		// The cost of a path is always summed from its start, so that a path found twice gets the same cost.
+		auto computePathCost = [&](const std::vector<int>& rkVertexIds)
+		{
+			double cost = 0.0;
+			for (size_t i = 1; i < rkVertexIds.size(); ++i)
+			{
+				double edgeCost = kInfiniteDistance;
+				for (int j = rkAdjacency.offsets[rkVertexIds[i - 1]]; j < rkAdjacency.offsets[rkVertexIds[i - 1] + 1]; ++j)
 				{
-					return std::numeric_limits<double>::max();
+					if (rkAdjacency.adjacentVertexIds[j] == rkVertexIds[i])
+					{
+						edgeCost = std::min(edgeCost, rkEdgeCosts[rkAdjacency.edgeIds[j]]);
+					}
 				}
+				cost += edgeCost + rkVertexCosts[rkVertexIds[i]];
+			}
+			return cost;
+		};
 
-				AttributeManager::AttributeMap attributeMap;
-				bool hasAttribute = AttributeManager::GetInstance().FindAll(occtEdge, attributeMap);
-				std::string lowercaseEdgeKey = rkEdgeKey;
-				std::transform(lowercaseEdgeKey.begin(), lowercaseEdgeKey.end(), lowercaseEdgeKey.begin(), ::tolower);
-				AttributeManager::AttributeMap::iterator attributeIterator = attributeMap.find(lowercaseEdgeKey);
-				if (attributeIterator == attributeMap.end())
+		// The Edges to avoid are made untraversable in a copy of the costs, and restored after each spur path.
+		std::vector<double> edgeCosts = rkEdgeCosts;
+		std::vector<int> blockedEdgeIds;
+		auto blockEdges = [&](const int kVertexId, const int kAdjacentVertexId)
+		{
+			for (int i = rkAdjacency.offsets[kVertexId]; i < rkAdjacency.offsets[kVertexId + 1]; ++i)
+			{
+				if (kAdjacentVertexId < 0 || rkAdjacency.adjacentVertexIds[i] == kAdjacentVertexId)
 				{
-					if ((lowercaseEdgeKey.compare("distance") == 0 || lowercaseEdgeKey.compare("length") == 0)) // no attribute with this name is found
+					edgeCosts[rkAdjacency.edgeIds[i]] = kInfiniteDistance;
+					blockedEdgeIds.push_back(rkAdjacency.edgeIds[i]);
+				}
+			}
+		};
+
+		std::vector<double> distances;
+		std::vector<int> parentVertexIds;
+		ShortestDistances(kStartVertexId, kEndVertexId, rkVertexCosts, edgeCosts, distances, parentVertexIds, kHeuristicScale);
+		if (distances[kEndVertexId] >= kInfiniteDistance)
+		{
+			return;
+		}
+
+		std::vector<int> shortestPath;
+		for (int vertexId = kEndVertexId; vertexId >= 0; vertexId = parentVertexIds[vertexId])
+		{
+			shortestPath.push_back(vertexId);
+		}
+		std::reverse(shortestPath.begin(), shortestPath.end());
+		double shortestPathCost = computePathCost(shortestPath);
+		if (kMaxCost >= 0.0 && shortestPathCost > kMaxCost)
+		{
+			return;
+		}
+		rPathVertexIds.push_back(shortestPath);
+		rPathCosts.push_back(shortestPathCost);
+
+		// The candidate paths, ordered by cost and then by Vertex IDs, without duplicates
+		std::set<std::pair<double, std::vector<int>>> candidatePaths;
+		while ((int)rPathVertexIds.size() < kMaxNumberOfPaths)
+		{
+			const std::vector<int> kPreviousPath = rPathVertexIds.back();
+			for (size_t spurIndex = 0; spurIndex + 1 < kPreviousPath.size(); ++spurIndex)
+			{
+				if (kUseTimeLimit)
+				{
+					auto currentTime = std::chrono::system_clock::now();
+					auto timeDifferenceInSeconds = std::chrono::duration_cast<std::chrono::seconds>(currentTime - startingTime);
+					if (timeDifferenceInSeconds.count() > kTimeLimitInSeconds)
 					{
-						BRepExtrema_DistShapeShape occtDistance(rkVertex1, rkVertex2);
-						return occtDistance.Value();
+						return;
 					}
-					else
+				}
+
+				// The spur path must leave the root path by an Edge which no found path with the same root takes,
+				// and must not come back to the root path.
+				int spurVertexId = kPreviousPath[spurIndex];
+				for (const std::vector<int>& rkPathVertexIds : rPathVertexIds)
+				{
+					if (rkPathVertexIds.size() > spurIndex + 1 &&
+						std::equal(kPreviousPath.begin(), kPreviousPath.begin() + spurIndex + 1, rkPathVertexIds.begin()))
 					{
-						return 1.0;
+						blockEdges(spurVertexId, rkPathVertexIds[spurIndex + 1]);
 					}
 				}
-				else
+				for (size_t i = 0; i < spurIndex; ++i)
 				{
-					Attribute::Ptr attribute = attributeIterator->second;
+					blockEdges(kPreviousPath[i], -1);
+				}
 
-					// Only add if double or int
-					DoubleAttribute::Ptr doubleAttribute = std::dynamic_pointer_cast<DoubleAttribute>(attribute);
-					if (doubleAttribute != nullptr)
+				ShortestDistances(spurVertexId, kEndVertexId, rkVertexCosts, edgeCosts, distances, parentVertexIds, kHeuristicScale);
+				if (distances[kEndVertexId] < kInfiniteDistance)
+				{
+					std::vector<int> candidatePath(kPreviousPath.begin(), kPreviousPath.begin() + spurIndex);
+					for (int vertexId = kEndVertexId; vertexId >= 0; vertexId = parentVertexIds[vertexId])
+					{
+						candidatePath.push_back(vertexId);
+					}
+					std::reverse(candidatePath.begin() + spurIndex, candidatePath.end());
+					double candidatePathCost = computePathCost(candidatePath);
+					if (kMaxCost < 0.0 || candidatePathCost <= kMaxCost)
 					{
-						return doubleAttribute->DoubleValue();
+						candidatePaths.insert(std::make_pair(candidatePathCost, candidatePath));
 					}
+				}
 
-					IntAttribute::Ptr intAttribute = std::dynamic_pointer_cast<IntAttribute>(attribute);
-					if (intAttribute != nullptr)
+				for (int edgeId : blockedEdgeIds)
+				{
+					edgeCosts[edgeId] = rkEdgeCosts[edgeId];
+				}
+				blockedEdgeIds.clear();
+			}
+
+			if (candidatePaths.empty())
+			{
+				return;
+			}
+			rPathVertexIds.push_back(candidatePaths.begin()->second);
+			rPathCosts.push_back(candidatePaths.begin()->first);
+			candidatePaths.erase(candidatePaths.begin());
+		}
+	}
+
+	void Graph::MultiSourceBreadthFirstSearch(const std::vector<int>& rkSourceVertexIds, const BreadthFirstSearchVisitor& rkVisitor) const
+	{
+		const CompactAdjacency& rkAdjacency = GetCompactAdjacency();
+		const int kNumOfVertices = (int)m_occtVertices.size();
+		const int kBatchSize = 64;
+		const int kNumOfBatches = ((int)rkSourceVertexIds.size() + kBatchSize - 1) / kBatchSize;
+
+		OSD_Parallel::For(0, kNumOfBatches, [&](const int kBatchIndex)
+		{
+			// One bit per search: the Vertices already reached, in the current frontier, and in the next one
+			std::vector<std::uint64_t> seenBits(kNumOfVertices, 0);
+			std::vector<std::uint64_t> frontierBits(kNumOfVertices, 0);
+			std::vector<std::uint64_t> nextBits(kNumOfVertices, 0);
+			std::vector<int> frontierVertexIds;
+			std::vector<int> nextVertexIds;
+
+			const int kFirstSourceIndex = kBatchIndex * kBatchSize;
+			const int kEndSourceIndex = std::min(kFirstSourceIndex + kBatchSize, (int)rkSourceVertexIds.size());
+			for (int sourceIndex = kFirstSourceIndex; sourceIndex < kEndSourceIndex; ++sourceIndex)
+			{
+				int sourceVertexId = rkSourceVertexIds[sourceIndex];
+				if (frontierBits[sourceVertexId] == 0)
+				{
+					frontierVertexIds.push_back(sourceVertexId);
+				}
+				frontierBits[sourceVertexId] |= 1ULL << (sourceIndex - kFirstSourceIndex);
+			}
+			for (int vertexId : frontierVertexIds)
+			{
+				seenBits[vertexId] = frontierBits[vertexId];
+				rkVisitor(kFirstSourceIndex, vertexId, frontierBits[vertexId], 0);
+			}
+
+			for (int distance = 1; !frontierVertexIds.empty(); ++distance)
+			{
+				for (int vertexId : frontierVertexIds)
+				{
+					std::uint64_t vertexBits = frontierBits[vertexId];
+					for (int i = rkAdjacency.offsets[vertexId]; i < rkAdjacency.offsets[vertexId + 1]; ++i)
 					{
-						return (double) intAttribute->IntValue();
+						int adjacentVertexId = rkAdjacency.adjacentVertexIds[i];
+						std::uint64_t newBits = vertexBits & ~seenBits[adjacentVertexId];
+						if (newBits == 0)
+						{
+							continue;
+						}
+						if (nextBits[adjacentVertexId] == 0)
+						{
+							nextVertexIds.push_back(adjacentVertexId);
+						}
+						nextBits[adjacentVertexId] |= newBits;
 					}
+				}
+
+				for (int vertexId : frontierVertexIds)
+				{
+					frontierBits[vertexId] = 0;
+				}
+				for (int vertexId : nextVertexIds)
+				{
+					seenBits[vertexId] |= nextBits[vertexId];
+					frontierBits[vertexId] = nextBits[vertexId];
+					nextBits[vertexId] = 0;
+					rkVisitor(kFirstSourceIndex, vertexId, frontierBits[vertexId], distance);
+				}
+				frontierVertexIds.swap(nextVertexIds);
+				nextVertexIds.clear();
+			}
+		}, !ExecutionPolicy::GetInstance().GetRunParallel());
+	}
+
+	void Graph::ComputeEccentricities(const std::vector<int>& rkSourceVertexIds, std::vector<int>& rEccentricities) const
+	{
+		rEccentricities.assign(rkSourceVertexIds.size(), 0);
+		std::vector<int> numbersOfReachedVertices(rkSourceVertexIds.size(), 0);
 
-					return 1.0;
+		// Each source belongs to one batch, so its entries are only written by one thread.
+		MultiSourceBreadthFirstSearch(rkSourceVertexIds, [&](const int kFirstSourceIndex, const int /*kVertexId*/, std::uint64_t sourceBits, const int kDistance)
+		{
+			for (int bitIndex = 0; sourceBits != 0; ++bitIndex, sourceBits >>= 1)
+			{
+				if ((sourceBits & 1ULL) != 0)
+				{
+					// The distances of a search only increase.
+					rEccentricities[kFirstSourceIndex + bitIndex] = kDistance;
+					++numbersOfReachedVertices[kFirstSourceIndex + bitIndex];
 				}
 			}
+		});
+
+		for (size_t i = 0; i < rkSourceVertexIds.size(); ++i)
+		{
+			if (numbersOfReachedVertices[i] < (int)m_occtVertices.size())
+			{
+				rEccentricities[i] = std::numeric_limits<int>::max();
+			}
 		}
 	}
-	TopoDS_Edge Graph::FindEdge(const TopoDS_Vertex & rkVertex1, const TopoDS_Vertex & rkVertex2, const double kTolerance) const
+
+	void Graph::SourceVertexIds(const std::list<Vertex::Ptr>& rkSourceVertices, std::vector<int>& rSourceVertexIds) const
 	{
-		for (TopTools_MapIteratorOfMapOfShape occtEdgeIterator(m_occtEdges);
-			occtEdgeIterator.More();
-			occtEdgeIterator.Next())
+		if (rkSourceVertices.empty())
 		{
-			TopoDS_Edge occtEdge = TopoDS::Edge(occtEdgeIterator.Value());
-			ShapeAnalysis_Edge occtShapeAnalysisEdge;
-			TopoDS_Vertex occtFirstVertex = occtShapeAnalysisEdge.FirstVertex(occtEdge);
-			TopoDS_Vertex occtLastVertex = occtShapeAnalysisEdge.LastVertex(occtEdge);
+			rSourceVertexIds.resize(m_occtVertices.size());
+			std::iota(rSourceVertexIds.begin(), rSourceVertexIds.end(), 0);
+			return;
+		}
 
-			if ((IsCoincident(occtFirstVertex, rkVertex1, kTolerance) && IsCoincident(occtLastVertex, rkVertex2, kTolerance)) ||
-				(IsCoincident(occtFirstVertex, rkVertex2, kTolerance) && IsCoincident(occtLastVertex, rkVertex1, kTolerance)))
+		for (const Vertex::Ptr& kpSourceVertex : rkSourceVertices)
+		{
+			int sourceVertexId = FindVertexId(kpSourceVertex->GetOcctVertex(), 0.0001);
+			if (sourceVertexId < 0)
 			{
-				return occtEdge;
+				throw std::runtime_error("A source Vertex is not in the Graph.");
 			}
+			rSourceVertexIds.push_back(sourceVertexId);
 		}
+	}
+
+	void Graph::ComputeDependencies(
+		const int kSourceVertexId,
+		const std::vector<double>& rkVertexCosts,
+		const std::vector<double>& rkEdgeCosts,
+		const bool kIsWeighted,
+		std::vector<int>& rReachedVertexIds,
+		std::vector<double>& rDependencies) const
+	{
+		// Brandes' algorithm: https://doi.org/10.1080/0022250X.2001.9990249
+		const CompactAdjacency& rkAdjacency = GetCompactAdjacency();
+		const int kNumOfVertices = (int)m_occtVertices.size();
+		const double kInfiniteDistance = std::numeric_limits<double>::max();
+		std::vector<double> distances(kNumOfVertices, kInfiniteDistance);
+		std::vector<double> numbersOfShortestPaths(kNumOfVertices, 0.0);
+		std::vector<int> reachingOrder(kNumOfVertices, -1);
+		rReachedVertexIds.clear();
+		distances[kSourceVertexId] = 0.0;
+		numbersOfShortestPaths[kSourceVertexId] = 1.0;
+
+		if (kIsWeighted)
+		{
+			VertexHeap vertexHeap(kNumOfVertices);
+			vertexHeap.Push(kSourceVertexId, 0.0);
+			while (!vertexHeap.IsEmpty())
+			{
+				int vertexId = vertexHeap.Pop();
+				reachingOrder[vertexId] = (int)rReachedVertexIds.size();
+				rReachedVertexIds.push_back(vertexId);
+				for (int i = rkAdjacency.offsets[vertexId]; i < rkAdjacency.offsets[vertexId + 1]; ++i)
+				{
+					int adjacentVertexId = rkAdjacency.adjacentVertexIds[i];
+					double edgeCost = rkEdgeCosts[rkAdjacency.edgeIds[i]];
+					if (reachingOrder[adjacentVertexId] >= 0 || edgeCost >= kInfiniteDistance)
+					{
+						continue;
+					}
 
-		return TopoDS_Edge();
+					double alternativeDistance = distances[vertexId] + edgeCost + rkVertexCosts[adjacentVertexId];
+					if (alternativeDistance < distances[adjacentVertexId])
+					{
+						distances[adjacentVertexId] = alternativeDistance;
+						numbersOfShortestPaths[adjacentVertexId] = numbersOfShortestPaths[vertexId];
+						vertexHeap.Push(adjacentVertexId, alternativeDistance);
+					}
+					else if (alternativeDistance == distances[adjacentVertexId])
+					{
+						numbersOfShortestPaths[adjacentVertexId] += numbersOfShortestPaths[vertexId];
+					}
+				}
+			}
+		}
+		else
+		{
+			// Breadth-First Search, whose queue is the list of the reached Vertices
+			reachingOrder[kSourceVertexId] = 0;
+			rReachedVertexIds.push_back(kSourceVertexId);
+			for (size_t queueIndex = 0; queueIndex < rReachedVertexIds.size(); ++queueIndex)
+			{
+				int vertexId = rReachedVertexIds[queueIndex];
+				for (int i = rkAdjacency.offsets[vertexId]; i < rkAdjacency.offsets[vertexId + 1]; ++i)
+				{
+					int adjacentVertexId = rkAdjacency.adjacentVertexIds[i];
+					if (reachingOrder[adjacentVertexId] < 0)
+					{
+						distances[adjacentVertexId] = distances[vertexId] + 1.0;
+						reachingOrder[adjacentVertexId] = (int)rReachedVertexIds.size();
+						rReachedVertexIds.push_back(adjacentVertexId);
+					}
+					if (distances[adjacentVertexId] == distances[vertexId] + 1.0)
+					{
+						numbersOfShortestPaths[adjacentVertexId] += numbersOfShortestPaths[vertexId];
+					}
+				}
+			}
+		}
+
+		// A Vertex precedes another on a shortest path if it was reached before it and the step between them costs
+		// the difference of their distances. In the unweighted case, the step costs are 1 too.
+		rDependencies.assign(kNumOfVertices, 0.0);
+		for (size_t i = rReachedVertexIds.size(); i-- > 1; )
+		{
+			int vertexId = rReachedVertexIds[i];
+			double factor = (1.0 + rDependencies[vertexId]) / numbersOfShortestPaths[vertexId];
+			for (int j = rkAdjacency.offsets[vertexId]; j < rkAdjacency.offsets[vertexId + 1]; ++j)
+			{
+				int adjacentVertexId = rkAdjacency.adjacentVertexIds[j];
+				double edgeCost = rkEdgeCosts[rkAdjacency.edgeIds[j]];
+				if (reachingOrder[adjacentVertexId] < 0 || reachingOrder[adjacentVertexId] >= reachingOrder[vertexId] || edgeCost >= kInfiniteDistance)
+				{
+					continue;
+				}
+
+				if (distances[adjacentVertexId] + edgeCost + rkVertexCosts[vertexId] == distances[vertexId])
+				{
+					rDependencies[adjacentVertexId] += numbersOfShortestPaths[adjacentVertexId] * factor;
+				}
+			}
+		}
 	}
 
-	bool Graph::IsCoincident(const TopoDS_Vertex & rkVertex1, const TopoDS_Vertex & rkVertex2, const double kTolerance)
+	void Graph::SetVertexValues(const std::string& rkKey, const std::vector<double>& rkValues) const
 	{
-		//BRepExtrema_DistShapeShape occtDistanceCalculation(rkVertex1, rkVertex2);
-		//bool isDone = occtDistanceCalculation.Perform();
-		//if (isDone)
+		AttributeManager& rAttributeManager = AttributeManager::GetInstance();
+		for (int vertexId = 0; vertexId < (int)m_occtVertices.size(); ++vertexId)
+		{
+			rAttributeManager.Add(m_occtVertices[vertexId], rkKey, std::make_shared<DoubleAttribute>(rkValues[vertexId]));
+		}
+	}
 
+	template <typename T>
+	void Graph::ComputeDistanceMatrix(
+		const std::list<Vertex::Ptr>& rkSourceVertices,
+		const std::string& rkVertexKey,
+		const std::string& rkEdgeKey,
+		std::vector<T>& rDistances) const
+	{
+		std::vector<int> sourceVertexIds;
+		SourceVertexIds(rkSourceVertices, sourceVertexIds);
 
-        Handle(Geom_CartesianPoint) point1 = new Geom_CartesianPoint(BRep_Tool::Pnt(rkVertex1));
-        Handle(Geom_CartesianPoint) point2 = new Geom_CartesianPoint(BRep_Tool::Pnt(rkVertex2));
+		const size_t kNumOfVertices = m_occtVertices.size();
+		rDistances.assign(sourceVertexIds.size() * kNumOfVertices, std::numeric_limits<T>::infinity());
 
-        double dx = (point2->X() - point1->X());
-        double dy = (point2->Y() - point1->Y());
-        double dz = (point2->Z() - point1->Z());
-        double sqDistance = dx * dx + dy * dy + dz * dz;
-        if (sqDistance < kTolerance)
+		// Each row is written by one thread.
+		if (rkVertexKey.empty() && rkEdgeKey.empty())
 		{
-			/*double distance = occtDistanceCalculation.Value();
-			if (distance < kTolerance)
-			{*/
-				return true;
-			//}
+			MultiSourceBreadthFirstSearch(sourceVertexIds, [&](const int kFirstSourceIndex, const int kVertexId, std::uint64_t sourceBits, const int kDistance)
+			{
+				for (int bitIndex = 0; sourceBits != 0; ++bitIndex, sourceBits >>= 1)
+				{
+					if ((sourceBits & 1ULL) != 0)
+					{
+						rDistances[(kFirstSourceIndex + bitIndex) * kNumOfVertices + kVertexId] = (T)kDistance;
+					}
+				}
+			});
+			return;
 		}
 
-		return false;
+		// The costs are read from the attributes before the parallel section.
+		std::vector<double> vertexCosts;
+		VertexCosts(rkVertexKey, vertexCosts);
+		std::vector<double> edgeCosts;
+		EdgeCosts(rkEdgeKey, edgeCosts);
+		GetCompactAdjacency();
+
+		OSD_Parallel::For(0, (int)sourceVertexIds.size(), [&](const int kSourceIndex)
+		{
+			std::vector<double> distances;
+			std::vector<int> parentVertexIds;
+			ShortestDistances(sourceVertexIds[kSourceIndex], -1, vertexCosts, edgeCosts, distances, parentVertexIds);
+			for (size_t vertexId = 0; vertexId < kNumOfVertices; ++vertexId)
+			{
+				if (distances[vertexId] < std::numeric_limits<double>::max())
+				{
+					rDistances[kSourceIndex * kNumOfVertices + vertexId] = (T)distances[vertexId];
+				}
+			}
+		}, !ExecutionPolicy::GetInstance().GetRunParallel());
+	}
+
+	const Graph::CompactAdjacency& Graph::GetCompactAdjacency() const
+	{
+		std::lock_guard<std::mutex> lock(m_compactAdjacencyMutex);
+		if (m_isCompactAdjacencyValid)
+		{
+			return m_compactAdjacency;
+		}
+
+		const int kNumOfVertices = (int)m_adjacency.size();
+		m_compactAdjacency.offsets.resize(kNumOfVertices + 1);
+		m_compactAdjacency.offsets[0] = 0;
+		for (int vertexId = 0; vertexId < kNumOfVertices; ++vertexId)
+		{
+			m_compactAdjacency.offsets[vertexId + 1] = m_compactAdjacency.offsets[vertexId] + (int)m_adjacency[vertexId].size();
+		}
+
+		m_compactAdjacency.adjacentVertexIds.resize(m_compactAdjacency.offsets[kNumOfVertices]);
+		m_compactAdjacency.edgeIds.resize(m_compactAdjacency.offsets[kNumOfVertices]);
+		for (int vertexId = 0; vertexId < kNumOfVertices; ++vertexId)
+		{
+			int i = m_compactAdjacency.offsets[vertexId];
+			for (const std::pair<int, int>& rkAdjacency : m_adjacency[vertexId])
+			{
+				m_compactAdjacency.adjacentVertexIds[i] = rkAdjacency.first;
+				m_compactAdjacency.edgeIds[i] = rkAdjacency.second;
+				++i;
+			}
+		}
+
+		m_isCompactAdjacencyValid = true;
+		return m_compactAdjacency;
+	}
+
+	Vertex::Ptr Graph::GetVertex(const int kVertexId) const
+	{
+		return std::dynamic_pointer_cast<Vertex>(Topology::ByOcctShape(m_occtVertices[kVertexId]));
+	}
+
+	Edge::Ptr Graph::GetEdge(const int kEdgeId) const
+	{
+		return std::dynamic_pointer_cast<TopologicCore::Edge>(Topology::ByOcctShape(m_occtEdges[kEdgeId]));
 	}
 }
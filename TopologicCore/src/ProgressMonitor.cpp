@@ -0,0 +1,180 @@
+// This file is part of Topologic software library.
+// Copyright(C) 2019, Cardiff University and University College London
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+#include "ProgressMonitor.h"
+
+#include <Message_ProgressScope.hxx>
+
+#include <stdexcept>
+
+namespace TopologicCore
+{
+	/// <summary>
+	/// Forwards the progress of the OCCT algorithms to a ProgressMonitor, and lets them poll its cancellation.
+	/// </summary>
+	class OcctProgressIndicator : public Message_ProgressIndicator
+	{
+	public:
+		OcctProgressIndicator(ProgressMonitor* pProgressMonitor)
+			: m_pProgressMonitor(pProgressMonitor)
+		{
+
+		}
+
+		virtual void Show(const Message_ProgressScope& rkOcctScope, const Standard_Boolean /*kIsForce*/) override
+		{
+			// The stage is read under the lock, as the OCCT worker threads also call this while a new stage can be started.
+			std::string stage;
+			{
+				std::lock_guard<std::mutex> lock(m_pProgressMonitor->m_mutex);
+				stage = m_pProgressMonitor->m_stage;
+			}
+			if (rkOcctScope.Name() != nullptr && rkOcctScope.Name()[0] != '\0')
+			{
+				stage += ": ";
+				stage += rkOcctScope.Name();
+			}
+			m_pProgressMonitor->Notify(stage, 100.0 * GetPosition());
+		}
+
+		virtual Standard_Boolean UserBreak() override
+		{
+			return m_pProgressMonitor->IsCancelled();
+		}
+
+	protected:
+		ProgressMonitor* m_pProgressMonitor;
+	};
+
+	ProgressMonitor::ProgressMonitor()
+		: m_operationThreadId(std::this_thread::get_id())
+		, m_isCancelled(false)
+		, m_deadlineTicks(0)
+	{
+		m_pOcctProgressIndicator = new OcctProgressIndicator(this);
+	}
+
+	ProgressMonitor::~ProgressMonitor()
+	{
+
+	}
+
+	void ProgressMonitor::SetCallback(const Callback& rkCallback)
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_callback = rkCallback;
+	}
+
+	void ProgressMonitor::SetTimeLimit(const double kSeconds)
+	{
+		if (kSeconds <= 0.0)
+		{
+			m_deadlineTicks = 0;
+			return;
+		}
+
+		std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::now() +
+			std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(kSeconds));
+		m_deadlineTicks = deadline.time_since_epoch().count();
+	}
+
+	void ProgressMonitor::Cancel()
+	{
+		m_isCancelled = true;
+	}
+
+	void ProgressMonitor::Reset()
+	{
+		m_isCancelled = false;
+	}
+
+	bool ProgressMonitor::IsCancelled() const
+	{
+		if (m_isCancelled)
+		{
+			return true;
+		}
+
+		std::chrono::steady_clock::rep deadlineTicks = m_deadlineTicks;
+		return deadlineTicks != 0 && std::chrono::steady_clock::now().time_since_epoch().count() >= deadlineTicks;
+	}
+
+	Message_ProgressRange ProgressMonitor::Start(const std::string& rkStage)
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_stage = rkStage;
+			m_operationThreadId = std::this_thread::get_id();
+		}
+		return m_pOcctProgressIndicator->Start();
+	}
+
+	void ProgressMonitor::Report(const std::string& rkStage, const double kPercent)
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_stage = rkStage;
+			m_operationThreadId = std::this_thread::get_id();
+		}
+		Notify(rkStage, kPercent);
+		Check();
+	}
+
+	void ProgressMonitor::Check() const
+	{
+		if (IsCancelled())
+		{
+			throw std::runtime_error(m_isCancelled ? "The operation was cancelled." : "The operation reached its time limit.");
+		}
+	}
+
+	Message_ProgressRange ProgressMonitor::Start(const ProgressMonitor::Ptr& kpProgressMonitor, const std::string& rkStage)
+	{
+		if (kpProgressMonitor == nullptr)
+		{
+			return Message_ProgressRange();
+		}
+		return kpProgressMonitor->Start(rkStage);
+	}
+
+	void ProgressMonitor::Check(const ProgressMonitor::Ptr& kpProgressMonitor)
+	{
+		if (kpProgressMonitor != nullptr)
+		{
+			kpProgressMonitor->Check();
+		}
+	}
+
+	void ProgressMonitor::Notify(const std::string& rkStage, const double kPercent)
+	{
+		// The callback is called without the lock, so that it can e.g. replace itself.
+		Callback callback;
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+
+			// The OCCT algorithms also report from their worker threads, which must not call e.g. a Python callback.
+			if (std::this_thread::get_id() != m_operationThreadId)
+			{
+				return;
+			}
+			callback = m_callback;
+		}
+		if (callback)
+		{
+			callback(rkStage, kPercent);
+		}
+	}
+}
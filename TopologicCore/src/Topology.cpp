@@ -24,12 +24,16 @@
 #include "Edge.h"
 #include "Vertex.h"
 #include "Aperture.h"
+#include "BooleanHistory.h"
 #include "Context.h"
 #include "ContentManager.h"
 #include "ContextManager.h"
+#include "ExecutionPolicy.h"
 #include "InstanceGUIDManager.h"
 #include "TopologyFactory.h"
 #include "TopologyFactoryManager.h"
+#include "TopologyIndex.h"
+#include "TopologyIndexManager.h"
 #include "Bitwise.h"
 #include "Attribute.h"
 #include "AttributeManager.h"
@@ -38,6 +42,13 @@
 #include <Utilities/FaceUtility.h>
 
 #include <BRepCheck_Analyzer.hxx>
+#include <BRepBndLib.hxx>
+#include <Bnd_BoundSortBox.hxx>
+#include <Bnd_HArray1OfBox.hxx>
+#include <Bnd_OBB.hxx>
+#include <OSD_Parallel.hxx>
+#include <Precision.hxx>
+#include <BOPTools_AlgoTools.hxx>
 #include <BOPAlgo_MakerVolume.hxx>
 #include <BOPAlgo_PaveFiller.hxx>
 #include <BRepAlgoAPI_Section.hxx>
@@ -65,12 +76,18 @@
 #include <ShapeFix_Shape.hxx>
 #include <TopExp_Explorer.hxx>
 #include <TopoDS.hxx>
+#include <TopTools_DataMapOfShapeInteger.hxx>
+#include <TopTools_IndexedMapOfShape.hxx>
+#include <TopTools_ListOfListOfShape.hxx>
+#include <TColStd_ListOfInteger.hxx>
 #include <TopoDS_FrozenShape.hxx>
+#include <TopoDS_Iterator.hxx>
 #include <TopoDS_UnCompatibleShapes.hxx>
 #include <Geom_TrimmedCurve.hxx>
 #include <IntTools_EdgeFace.hxx>
 
 #include <array>
+#include <functional>
 
 #include <assert.h>
 
@@ -78,7 +95,7 @@ namespace TopologicCore
 {
 	int Topology::m_numOfTopologies = 0;
 
-	void AddOcctListShapeToAnotherList(const TopTools_ListOfShape& rkAList, TopTools_ListOfShape& rAnotherList)
+	void Topology::AddOcctListShapeToAnotherList(const TopTools_ListOfShape& rkAList, TopTools_ListOfShape& rAnotherList)
 	{
 		for (TopTools_ListIteratorOfListOfShape kIterator(rkAList);
 			kIterator.More();
@@ -88,6 +105,17 @@ namespace TopologicCore
 		}
 	}
 
+	void AddNonNullTopologies(const std::list<Topology::Ptr>& rkTopologies, std::list<Topology::Ptr>& rNonNullTopologies)
+	{
+		for (const Topology::Ptr& kpTopology : rkTopologies)
+		{
+			if (kpTopology != nullptr)
+			{
+				rNonNullTopologies.push_back(kpTopology);
+			}
+		}
+	}
+
 	Topology::Ptr Topology::ClosestSimplestSubshape(const Topology::Ptr& kpTopology) const
 	{
 		TopoDS_Shape occtClosestSubshape;
@@ -313,6 +341,11 @@ namespace TopologicCore
 
 	TopoDS_Shape Topology::FixShape(const TopoDS_Shape& rkOcctShape)
 	{
+		if (ExecutionPolicy::GetInstance().GetTrustInput())
+		{
+			return rkOcctShape;
+		}
+
 		ShapeFix_Shape occtShapeFix(rkOcctShape);
 		occtShapeFix.Perform();
 		return occtShapeFix.Shape();
@@ -810,6 +843,67 @@ namespace TopologicCore
 		const TopoDS_Shape& rkOcctShape1 = GetOcctShape();
 		const TopoDS_Shape& rkOcctShape2 = kpTopology->GetOcctShape();
 
+		// A Cluster edited in place keeps an index, so its members are not explored again.
+		const TopologyIndex::Ptr kpIndex1 = Index();
+		const TopologyIndex::Ptr kpIndex2 = kpTopology->Index();
+
+		// Bitwise shift
+		for (int i = 0; i < 9; ++i)
+		{
+			int intTopologyType = 1 << i;
+
+			if ((kFilterType & intTopologyType) == 0)
+			{
+				continue;
+			}
+			TopAbs_ShapeEnum occtSubtopologyType = GetOcctTopologyType((TopologyType)intTopologyType);
+			TopTools_ListOfShape occtSharedSubtopologies;
+			if (kpIndex1 != nullptr && kpIndex2 != nullptr)
+			{
+				TopTools_ListOfShape occtSubtopologies;
+				kpIndex1->Members(occtSubtopologyType, occtSubtopologies);
+				for (TopTools_ListIteratorOfListOfShape occtSubtopologyIterator(occtSubtopologies);
+					occtSubtopologyIterator.More();
+					occtSubtopologyIterator.Next())
+				{
+					if (kpIndex2->Contains(occtSubtopologyIterator.Value()))
+					{
+						occtSharedSubtopologies.Append(occtSubtopologyIterator.Value());
+					}
+				}
+			}
+			else if (kpIndex1 != nullptr || kpIndex2 != nullptr)
+			{
+				// Explore the Topology without an index, and look its members up in the other one.
+				const TopologyIndex::Ptr& kpIndex = kpIndex1 != nullptr ? kpIndex1 : kpIndex2;
+				const TopoDS_Shape& rkOcctOtherShape = kpIndex1 != nullptr ? rkOcctShape2 : rkOcctShape1;
+				TopTools_MapOfShape occtVisitedMembers;
+				for (TopExp_Explorer occtExplorer(rkOcctOtherShape, occtSubtopologyType); occtExplorer.More(); occtExplorer.Next())
+				{
+					const TopoDS_Shape& rkOcctCurrent = occtExplorer.Current();
+					if (occtVisitedMembers.Add(rkOcctCurrent) && kpIndex->Contains(rkOcctCurrent))
+					{
+						occtSharedSubtopologies.Append(rkOcctCurrent);
+					}
+				}
+			}
+			else
+			{
+				SharedMembers(rkOcctShape1, rkOcctShape2, occtSubtopologyType, occtSharedSubtopologies);
+			}
+
+			for (TopTools_ListIteratorOfListOfShape occtSubtopologyIterator(occtSharedSubtopologies);
+				occtSubtopologyIterator.More();
+				occtSubtopologyIterator.Next())
+			{
+				Topology::Ptr topology = Topology::ByOcctShape(occtSubtopologyIterator.Value(), "");
+				rSharedTopologies.push_back(topology);
+			}
+		}
+	}
+
+	void Topology::PairwiseSharedTopologies(const std::list<Topology::Ptr>& rkTopologies, const int kFilterType, std::map<std::pair<int, int>, std::list<Topology::Ptr>>& rSharedTopologies)
+	{
 		// Bitwise shift
 		for (int i = 0; i < 9; ++i)
 		{
@@ -820,30 +914,67 @@ namespace TopologicCore
 				continue;
 			}
 			TopAbs_ShapeEnum occtSubtopologyType = GetOcctTopologyType((TopologyType)intTopologyType);
-			TopTools_MapOfShape occtSubtopologies1;
-			DownwardNavigation(rkOcctShape1, occtSubtopologyType, occtSubtopologies1);
 
-			TopTools_MapOfShape occtSubtopologies2;
-			DownwardNavigation(rkOcctShape2, occtSubtopologyType, occtSubtopologies2);
+			// Index each member once, and record the indices of the input Topologies it belongs to.
+			// The owner lists are filled in increasing order.
+			TopTools_IndexedMapOfShape occtSubtopologies;
+			std::vector<std::vector<int>> owners;
+			int topologyIndex = 0;
+			for (const Topology::Ptr& kpTopology : rkTopologies)
+			{
+				TopTools_MapOfShape occtMembers;
+				DownwardNavigation(kpTopology->GetOcctShape(), occtSubtopologyType, occtMembers);
+				for (TopTools_MapIteratorOfMapOfShape occtMemberIterator(occtMembers);
+					occtMemberIterator.More();
+					occtMemberIterator.Next())
+				{
+					int subtopologyIndex = occtSubtopologies.Add(occtMemberIterator.Value());
+					if (subtopologyIndex > (int)owners.size())
+					{
+						owners.resize(subtopologyIndex);
+					}
+					owners[subtopologyIndex - 1].push_back(topologyIndex);
+				}
+				++topologyIndex;
+			}
 
-			for (TopTools_MapIteratorOfMapOfShape occtSubtopologyIterator1(occtSubtopologies1);
-				occtSubtopologyIterator1.More();
-				occtSubtopologyIterator1.Next())
+			for (int subtopologyIndex = 0; subtopologyIndex < (int)owners.size(); ++subtopologyIndex)
 			{
-				for (TopTools_MapIteratorOfMapOfShape occtSubtopologyIterator2(occtSubtopologies2);
-					occtSubtopologyIterator2.More();
-					occtSubtopologyIterator2.Next())
+				const std::vector<int>& rkOwners = owners[subtopologyIndex];
+				if (rkOwners.size() < 2)
+				{
+					continue;
+				}
+
+				Topology::Ptr topology = Topology::ByOcctShape(occtSubtopologies(subtopologyIndex + 1), "");
+				for (size_t j = 0; j < rkOwners.size(); ++j)
 				{
-					if (occtSubtopologyIterator1.Value().IsSame(occtSubtopologyIterator2.Value()))
+					for (size_t k = j + 1; k < rkOwners.size(); ++k)
 					{
-						Topology::Ptr topology = Topology::ByOcctShape(occtSubtopologyIterator1.Value(), "");
-						rSharedTopologies.push_back(topology);
+						rSharedTopologies[std::make_pair(rkOwners[j], rkOwners[k])].push_back(topology);
 					}
 				}
 			}
 		}
 	}
 
+	void Topology::SharedMembers(const TopoDS_Shape& rkOcctShape1, const TopoDS_Shape& rkOcctShape2, const TopAbs_ShapeEnum& rkShapeEnum, TopTools_ListOfShape& rOcctSharedMembers)
+	{
+		TopTools_MapOfShape occtMembers2;
+		DownwardNavigation(rkOcctShape2, rkShapeEnum, occtMembers2);
+
+		// A member can be visited more than once by the explorer, so keep track of those already added.
+		TopTools_MapOfShape occtVisitedMembers1;
+		for (TopExp_Explorer occtExplorer(rkOcctShape1, rkShapeEnum); occtExplorer.More(); occtExplorer.Next())
+		{
+			const TopoDS_Shape& rkOcctCurrent = occtExplorer.Current();
+			if (occtVisitedMembers1.Add(rkOcctCurrent) && occtMembers2.Contains(rkOcctCurrent))
+			{
+				rOcctSharedMembers.Append(rkOcctCurrent);
+			}
+		}
+	}
+
 	Topology::Ptr Topology::SetDictionaries(
 		const std::list<Vertex::Ptr>& rkSelectors,
 		const std::list<std::map<std::string, Attribute::Ptr>>& rkDictionaries,
@@ -1024,9 +1155,8 @@ namespace TopologicCore
 			Topology::Ptr pChildTopology = Topology::ByOcctShape(rkModifiedShape, "");
 
 			// Map the aperture to the modified shell faces.
-			std::list<Topology::Ptr> contents;
-			ContentManager::GetInstance().Find(occtEdgeIterator.Value(), contents);
-			for (const Topology::Ptr& rkContent : contents)
+			const std::list<Topology::Ptr>& rkContents = ContentManager::GetInstance().Find(occtEdgeIterator.Value());
+			for (const Topology::Ptr& rkContent : rkContents)
 			{
 				if (rkContent->GetType() != TOPOLOGY_APERTURE)
 				{
@@ -1048,35 +1178,21 @@ namespace TopologicCore
 		return occtSewing.SewedShape();
 	}
 
-	void BooleanTransferDictionary(Topology const * const kpkOriginTopology1, Topology const * const kpkOriginTopology2, Topology const * const kpkDestinationTopology, bool initClearDictionary)
+	void BooleanTransferDictionary(const TopTools_ListOfShape& rkOcctOriginShapes, Topology const * const kpkDestinationTopology, bool initClearDictionary,
+		const TopTools_ListOfShape& rkOcctUntouchedOperands)
 	{
-		TopoDS_Shape occtOriginShape1 = kpkOriginTopology1->GetOcctShape();
-		TopoDS_Shape occtOriginShape2 = kpkOriginTopology2->GetOcctShape();
-		TopoDS_Shape occtDestinationShape = kpkDestinationTopology->GetOcctShape();
-
-		// Get vertices, edges, faces, cells, cellComplexes from kpkDestinationTopology, and map them to the originTopology
-		TopoDS_Shape occtOriginShape;
-		if (kpkOriginTopology1 == nullptr && kpkOriginTopology2 == nullptr)
-		{
-			throw std::runtime_error("Fails to transfer dictionari in a Boolean operation because the original Topologies are null.");
-		}
-		else if (kpkOriginTopology1 == nullptr && kpkOriginTopology2 != nullptr)
-		{
-			occtOriginShape = kpkOriginTopology2->GetOcctShape();
-		}
-		else if (kpkOriginTopology1 != nullptr && kpkOriginTopology2 == nullptr)
-		{
-			occtOriginShape = kpkOriginTopology1->GetOcctShape();
-		}
-		else
+		// The members of the untouched operands are copied to the destination as they are, so they keep their dictionaries.
+		TopTools_IndexedMapOfShape occtUntouchedMembers;
+		for (TopTools_ListIteratorOfListOfShape occtUntouchedOperandIterator(rkOcctUntouchedOperands);
+			occtUntouchedOperandIterator.More();
+			occtUntouchedOperandIterator.Next())
 		{
-			TopTools_MapOfShape occtOriginShapes;
-			occtOriginShapes.Add(kpkOriginTopology1->GetOcctShape());
-			occtOriginShapes.Add(kpkOriginTopology2->GetOcctShape());
-			occtOriginShape = Cluster::ByOcctTopologies(occtOriginShapes);
+			TopExp::MapShapes(occtUntouchedOperandIterator.Value(), occtUntouchedMembers);
 		}
 
-		// Get vertices, edges, faces, cells, cellComplexes from kpkDestinationTopology, and map them to the originTopology
+		TopoDS_Shape occtDestinationShape = kpkDestinationTopology->GetOcctShape();
+
+		// Get vertices, edges, faces, cells, cellComplexes from kpkDestinationTopology, and map them to each originTopology
 		TopologyType topologyTypes[5] = { TOPOLOGY_VERTEX, TOPOLOGY_EDGE, TOPOLOGY_FACE, TOPOLOGY_CELL, TOPOLOGY_CELLCOMPLEX };
 		TopAbs_ShapeEnum occtTopologyTypes[5] = { TopAbs_VERTEX, TopAbs_EDGE, TopAbs_FACE, TopAbs_SOLID, TopAbs_COMPSOLID };
 		for (int i = 0; i < 5; ++i)
@@ -1089,34 +1205,75 @@ namespace TopologicCore
 				occtDestinationMemberIterator.Next())
 			{
 				TopoDS_Shape occtDestinationMember = occtDestinationMemberIterator.Value();
+				if (occtUntouchedMembers.Contains(occtDestinationMember))
+				{
+					continue;
+				}
 
 				if (initClearDictionary)
 				{
 					AttributeManager::GetInstance().ClearOne(occtDestinationMember);
 				}
 
-				// Find the member in originTopology
 				TopoDS_Shape occtDestinationMemberCenterOfMass = Topology::CenterOfMass(occtDestinationMember);
-				double minDistance1 = 0.0;
-				TopoDS_Shape occtOriginMember1 = Topology::SelectSubtopology(
-					occtOriginShape1, occtDestinationMemberCenterOfMass, minDistance1, topologyTypes[i], 0.0001);
-				double minDistance2 = 0.0;
-				TopoDS_Shape occtOriginMember2 = Topology::SelectSubtopology(
-					occtOriginShape2, occtDestinationMemberCenterOfMass, minDistance2, topologyTypes[i], 0.0001);
-
-				if (!occtDestinationMemberCenterOfMass.IsNull() && !occtOriginMember1.IsNull())
+				if (occtDestinationMemberCenterOfMass.IsNull())
 				{
-					AttributeManager::GetInstance().CopyAttributes(occtOriginMember1, occtDestinationMember, true);
+					continue;
 				}
-				if (!occtDestinationMemberCenterOfMass.IsNull() && !occtOriginMember2.IsNull())
+
+				// Find the member in each originTopology
+				for (TopTools_ListIteratorOfListOfShape occtOriginShapeIterator(rkOcctOriginShapes);
+					occtOriginShapeIterator.More();
+					occtOriginShapeIterator.Next())
 				{
-					AttributeManager::GetInstance().CopyAttributes(occtOriginMember2, occtDestinationMember, true);
+					double minDistance = 0.0;
+					TopoDS_Shape occtOriginMember = Topology::SelectSubtopology(
+						occtOriginShapeIterator.Value(), occtDestinationMemberCenterOfMass, minDistance, topologyTypes[i], 0.0001);
+					if (!occtOriginMember.IsNull())
+					{
+						AttributeManager::GetInstance().CopyAttributes(occtOriginMember, occtDestinationMember, true);
+					}
 				}
 			}
 		}
 	}
 
-	Topology::Ptr Topology::Difference(const Topology::Ptr & kpOtherTopology, const bool kTransferDictionary)
+	void BooleanTransferDictionary(Topology const * const kpkOriginTopology1, Topology const * const kpkOriginTopology2, Topology const * const kpkDestinationTopology, bool initClearDictionary,
+		const TopTools_ListOfShape& rkOcctUntouchedOperands = TopTools_ListOfShape())
+	{
+		if (kpkOriginTopology1 == nullptr && kpkOriginTopology2 == nullptr)
+		{
+			throw std::runtime_error("Fails to transfer dictionaries in a Boolean operation because the original Topologies are null.");
+		}
+
+		TopTools_ListOfShape occtOriginShapes;
+		if (kpkOriginTopology1 != nullptr)
+		{
+			occtOriginShapes.Append(kpkOriginTopology1->GetOcctShape());
+		}
+		if (kpkOriginTopology2 != nullptr)
+		{
+			occtOriginShapes.Append(kpkOriginTopology2->GetOcctShape());
+		}
+		BooleanTransferDictionary(occtOriginShapes, kpkDestinationTopology, initClearDictionary, rkOcctUntouchedOperands);
+	}
+
+	void BooleanTransferDictionary(const std::list<Topology::Ptr>& rkOriginTopologies, Topology const * const kpkDestinationTopology, bool initClearDictionary)
+	{
+		if (rkOriginTopologies.empty())
+		{
+			throw std::runtime_error("Fails to transfer dictionaries in a Boolean operation because the original Topologies are null.");
+		}
+
+		TopTools_ListOfShape occtOriginShapes;
+		for (const Topology::Ptr& kpOriginTopology : rkOriginTopologies)
+		{
+			occtOriginShapes.Append(kpOriginTopology->GetOcctShape());
+		}
+		BooleanTransferDictionary(occtOriginShapes, kpkDestinationTopology, initClearDictionary, TopTools_ListOfShape());
+	}
+
+	Topology::Ptr Topology::Difference(const Topology::Ptr & kpOtherTopology, const bool kTransferDictionary, const BooleanOptions& rkOptions, const std::shared_ptr<BooleanHistory>& kpHistory)
 	{
 		if (kpOtherTopology == nullptr)
 		{
@@ -1127,8 +1284,20 @@ namespace TopologicCore
 		TopTools_ListOfShape occtArgumentsB;
 		AddBooleanOperands(kpOtherTopology, occtArgumentsA, occtArgumentsB);
 
+		TopTools_ListOfShape occtUntouchedArgumentsA;
+		TopTools_ListOfShape occtUntouchedArgumentsB;
+		PartitionBooleanOperands(kpOtherTopology, true, rkOptions, occtArgumentsA, occtArgumentsB, occtUntouchedArgumentsA, occtUntouchedArgumentsB);
+
+		// The operands of this Topology which do not interact are in the result as they are, the ones of the other
+		// Topology are not.
+		if (occtArgumentsA.IsEmpty())
+		{
+			TopoDS_Shape occtResultShape;
+			return BinaryBooleanResult(occtResultShape, occtUntouchedArgumentsA, kpOtherTopology, true, kTransferDictionary, nullptr, kpHistory);
+		}
+
 		BOPAlgo_CellsBuilder occtCellsBuilder;
-		NonRegularBooleanOperation(occtArgumentsA, occtArgumentsB, occtCellsBuilder);
+		NonRegularBooleanOperation(occtArgumentsA, occtArgumentsB, occtCellsBuilder, rkOptions);
 
 		// 2. Select the parts to be included in the final result.
 		TopTools_ListOfShape occtListToTake;
@@ -1153,22 +1322,7 @@ namespace TopologicCore
 		occtCellsBuilder.MakeContainers();
 
 		TopoDS_Shape occtResultShape = occtCellsBuilder.Shape();
-		TopoDS_Shape occtPostprocessedShape = occtResultShape.IsNull()? occtResultShape : PostprocessBooleanResult(occtResultShape);
-		Topology::Ptr pPostprocessedShape = Topology::ByOcctShape(occtPostprocessedShape, ""); 
-		if (pPostprocessedShape == nullptr)
-		{
-			return nullptr;
-		}
-
-		TransferContents(GetOcctShape(), pPostprocessedShape);
-		TransferContents(kpOtherTopology->GetOcctShape(), pPostprocessedShape);
-		//AttributeManager::GetInstance().DeepCopyAttributes(GetOcctShape(), occtPostprocessedShape);
-
-		if (kTransferDictionary)
-		{
-			BooleanTransferDictionary(this, kpOtherTopology.get(), pPostprocessedShape.get(), true);
-		}
-		return pPostprocessedShape;
+		return BinaryBooleanResult(occtResultShape, occtUntouchedArgumentsA, kpOtherTopology, true, kTransferDictionary, occtCellsBuilder.History(), kpHistory);
 	}
 
 	void Topology::Contents(std::list<Topology::Ptr>& rContents) const
@@ -1188,10 +1342,8 @@ namespace TopologicCore
 
 	void Topology::Apertures(const TopoDS_Shape & rkOcctShape, std::list<Aperture::Ptr>& rApertures)
 	{
-		std::list<Topology::Ptr> contents;
-		ContentManager::GetInstance().Find(rkOcctShape, contents);
-
-		for (const Topology::Ptr& kpContent : contents)
+		const std::list<Topology::Ptr>& rkContents = ContentManager::GetInstance().Find(rkOcctShape);
+		for (const Topology::Ptr& kpContent : rkContents)
 		{
 			if (kpContent->GetType() == TOPOLOGY_APERTURE)
 			{
@@ -1208,22 +1360,53 @@ namespace TopologicCore
 	
 	void Topology::SubContents(const TopoDS_Shape & rkOcctShape, std::list<Topology::Ptr>& rSubContents)
 	{
+		ContentManager& rContentManager = ContentManager::GetInstance();
+		if (rContentManager.IsEmpty())
+		{
+			return;
+		}
+
 		Contents(rkOcctShape, rSubContents);
+
+		// Only the shapes which have contents need to be searched for. The content map compares the shapes by TShape,
+		// so the locations are removed before comparing.
+		TopTools_ListOfShape occtShapesWithContents;
+		rContentManager.ShapesWithContents(occtShapesWithContents);
+
+		TopTools_MapOfShape occtCandidates[TopAbs_SHAPE];
 		TopAbs_ShapeEnum occtType = rkOcctShape.ShapeType();
-		int occtTypeInt = (int)occtType + 1; // +1 for the next lower type
-		for (int occtTypeIntIteration = occtTypeInt; occtTypeIntIteration != (int)TopAbs_SHAPE; occtTypeIntIteration++)
+		for (TopTools_ListIteratorOfListOfShape occtShapeIterator(occtShapesWithContents);
+			occtShapeIterator.More();
+			occtShapeIterator.Next())
 		{
-			// Get members in each level
-			TopAbs_ShapeEnum occtTypeIteration = (TopAbs_ShapeEnum)occtTypeIntIteration;
-			TopTools_MapOfShape occtMembers;
-			DownwardNavigation(rkOcctShape, occtTypeIteration, occtMembers);
+			const TopoDS_Shape& rkOcctCandidate = occtShapeIterator.Value();
+			TopAbs_ShapeEnum occtCandidateType = rkOcctCandidate.ShapeType();
+			if (occtCandidateType > occtType && occtCandidateType < TopAbs_SHAPE) // only the lower types
+			{
+				occtCandidates[occtCandidateType].Add(rkOcctCandidate.Located(TopLoc_Location()));
+			}
+		}
+
+		for (int occtTypeIntIteration = (int)occtType + 1; occtTypeIntIteration != (int)TopAbs_SHAPE; occtTypeIntIteration++)
+		{
+			TopTools_MapOfShape& rOcctTypeCandidates = occtCandidates[occtTypeIntIteration];
+			if (rOcctTypeCandidates.IsEmpty())
+			{
+				continue;
+			}
 
-			// For each member, get the contents
-			for (TopTools_MapIteratorOfMapOfShape occtMemberIterator(occtMembers);
-				occtMemberIterator.More();
-				occtMemberIterator.Next())
+			// Stop exploring as soon as all candidates of this type have been found.
+			TopAbs_ShapeEnum occtTypeIteration = (TopAbs_ShapeEnum)occtTypeIntIteration;
+			for (TopExp_Explorer occtExplorer(rkOcctShape, occtTypeIteration);
+				occtExplorer.More() && !rOcctTypeCandidates.IsEmpty();
+				occtExplorer.Next())
 			{
-				ContentManager::GetInstance().Find(occtMemberIterator.Value(), rSubContents);
+				TopoDS_Shape occtMember = occtExplorer.Current().Located(TopLoc_Location());
+				if (rOcctTypeCandidates.Remove(occtMember))
+				{
+					const std::list<Topology::Ptr>& rkContents = rContentManager.Find(occtMember);
+					rSubContents.insert(rSubContents.end(), rkContents.begin(), rkContents.end());
+				}
 			}
 		}
 	}
@@ -1582,7 +1765,8 @@ namespace TopologicCore
 	{
 		// 1. Only for cluster
 		// 2. If the input is an empty cluster: return null
-		// 3. For each subtopology A, check against each other subtopology B. If A is inside B, remove A.
+		// 3. For each subtopology A, check if another subtopology B contains it. If so, remove A.
+		//    Instead of navigating each B for each A, index the owners of all sub-shapes once.
 
 		if (rOcctShape.ShapeType() != TopAbs_COMPOUND)
 		{
@@ -1597,35 +1781,48 @@ namespace TopologicCore
 			return TopoDS_Shape();
 		}
 
-		TopTools_MapOfShape occtShapesToRemove;
-		for (TopTools_ListIteratorOfListOfShape occtSubTopologyIteratorA(occtSubTopologies);
-			occtSubTopologyIteratorA.More();
-			occtSubTopologyIteratorA.Next())
+		// Identical subtopologies are not compared against each other, so they share one index.
+		TopTools_IndexedMapOfShape occtUniqueSubTopologies;
+		for (TopTools_ListIteratorOfListOfShape occtSubTopologyIterator(occtSubTopologies);
+			occtSubTopologyIterator.More();
+			occtSubTopologyIterator.Next())
 		{
-			TopoDS_Shape& rOcctSubtopologyA = occtSubTopologyIteratorA.Value();	
+			occtUniqueSubTopologies.Add(occtSubTopologyIterator.Value());
+		}
 
-			bool isShapeAToRemove = false;
-			for (TopTools_ListIteratorOfListOfShape occtSubTopologyIteratorB(occtSubTopologies);
-				occtSubTopologyIteratorB.More() && !isShapeAToRemove;
-				occtSubTopologyIteratorB.Next())
+		// Map each sub-shape, including the subtopologies themselves, to the index of the subtopology which owns it,
+		// or to 0 if several subtopologies own it.
+		TopTools_DataMapOfShapeInteger occtSubshapeOwners;
+		for (int i = 1; i <= occtUniqueSubTopologies.Extent(); ++i)
+		{
+			TopTools_IndexedMapOfShape occtSubshapes;
+			TopExp::MapShapes(occtUniqueSubTopologies(i), occtSubshapes);
+			for (int j = 1; j <= occtSubshapes.Extent(); ++j)
 			{
-				TopoDS_Shape& rOcctSubtopologyB = occtSubTopologyIteratorB.Value();
-
-				if (rOcctSubtopologyA.IsSame(rOcctSubtopologyB))
+				int* pOwnerIndex = occtSubshapeOwners.ChangeSeek(occtSubshapes(j));
+				if (pOwnerIndex == nullptr)
 				{
-					continue;
+					occtSubshapeOwners.Bind(occtSubshapes(j), i);
 				}
-
-				// Does B contain A?
-				TopTools_MapOfShape occtSubTopologiesB;
-				DownwardNavigation(rOcctSubtopologyB, rOcctSubtopologyA.ShapeType(), occtSubTopologiesB);
-				if (occtSubTopologiesB.Contains(rOcctSubtopologyA))
+				else if (*pOwnerIndex != i)
 				{
-					isShapeAToRemove = true;
-					occtShapesToRemove.Add(rOcctSubtopologyA);
+					*pOwnerIndex = 0;
 				}
 			}
 		}
+
+		// A subtopology is contained by another one if it has another owner than itself.
+		TopTools_MapOfShape occtShapesToRemove;
+		for (TopTools_ListIteratorOfListOfShape occtSubTopologyIterator(occtSubTopologies);
+			occtSubTopologyIterator.More();
+			occtSubTopologyIterator.Next())
+		{
+			const TopoDS_Shape& rkOcctSubTopology = occtSubTopologyIterator.Value();
+			if (occtSubshapeOwners.Find(rkOcctSubTopology) == 0)
+			{
+				occtShapesToRemove.Add(rkOcctSubTopology);
+			}
+		}
 		
 		// Remove the shapes
 		for (TopTools_MapIteratorOfMapOfShape occtShapesToRemoveIterator(occtShapesToRemove);
@@ -1650,6 +1847,51 @@ namespace TopologicCore
 		return Analyze(GetOcctShape(), 0);
 	}
 
+	bool Topology::IsValid() const
+	{
+		BRepCheck_Analyzer occtAnalyzer(GetOcctShape(), Standard_True, ExecutionPolicy::GetInstance().GetRunParallel());
+		return occtAnalyzer.IsValid() == Standard_True;
+	}
+
+	bool Topology::Validate(const std::list<Topology::Ptr>& rkTopologies, std::list<Topology::Ptr>& rInvalidTopologies)
+	{
+		TopoDS_Compound occtCompound;
+		BRep_Builder occtBuilder;
+		occtBuilder.MakeCompound(occtCompound);
+		for (const Topology::Ptr& kpTopology : rkTopologies)
+		{
+			if (kpTopology != nullptr && !kpTopology->GetOcctShape().IsNull())
+			{
+				occtBuilder.Add(occtCompound, kpTopology->GetOcctShape());
+			}
+		}
+
+		BRepCheck_Analyzer occtAnalyzer(occtCompound, Standard_True, ExecutionPolicy::GetInstance().GetRunParallel());
+		if (occtAnalyzer.IsValid())
+		{
+			return true;
+		}
+
+		TopTools_IndexedMapOfShape occtMembers;
+		TopExp::MapShapes(occtCompound, occtMembers);
+		for (int i = 1; i <= occtMembers.Extent(); ++i)
+		{
+			const TopoDS_Shape& rkOcctMember = occtMembers(i);
+			TopAbs_ShapeEnum occtMemberType = rkOcctMember.ShapeType();
+			if (occtMemberType == TopAbs_COMPOUND || occtMemberType == TopAbs_COMPSOLID)
+			{
+				continue;
+			}
+
+			if (!occtAnalyzer.IsValid(rkOcctMember))
+			{
+				rInvalidTopologies.push_back(Topology::ByOcctShape(rkOcctMember, ""));
+			}
+		}
+
+		return false;
+	}
+
 	void Topology::NonRegularBooleanOperation(
 		const Topology::Ptr& kpOtherTopology,
 		BOPAlgo_CellsBuilder& rOcctCellsBuilder,
@@ -1659,6 +1901,7 @@ namespace TopologicCore
 		TopTools_DataMapOfShapeShape& rOcctMapFaceToFixedFaceB)
 	{
 		AddBooleanOperands(kpOtherTopology, rOcctCellsBuilder, rOcctCellsBuildersOperandsA, rOcctCellsBuildersOperandsB, rOcctMapFaceToFixedFaceA, rOcctMapFaceToFixedFaceB);
+		ExecutionPolicy::GetInstance().Apply(rOcctCellsBuilder);
 
 		// Split the arguments and tools
 		try {
@@ -1687,7 +1930,8 @@ namespace TopologicCore
 	void Topology::NonRegularBooleanOperation(
 		const TopTools_ListOfShape & rkOcctArgumentsA,
 		const TopTools_ListOfShape & rkOcctArgumentsB,
-		BOPAlgo_CellsBuilder & rOcctCellsBuilder)
+		BOPAlgo_CellsBuilder & rOcctCellsBuilder,
+		const BooleanOptions& rkOptions)
 	{
 		TopTools_ListOfShape occtArguments;
 		for (TopTools_ListIteratorOfListOfShape occtArgumentIteratorA(rkOcctArgumentsA);
@@ -1703,11 +1947,12 @@ namespace TopologicCore
 			occtArguments.Append(occtArgumentIteratorB.Value());
 		}
 		rOcctCellsBuilder.SetArguments(occtArguments);
-		//rOcctCellsBuilder.SetNonDestructive(false);
+		rkOptions.Apply(rOcctCellsBuilder);
+		ExecutionPolicy::GetInstance().Apply(rOcctCellsBuilder);
 
 		// Split the arguments and tools
 		try {
-			rOcctCellsBuilder.Perform();
+			rOcctCellsBuilder.Perform(ProgressMonitor::Start(rkOptions.progressMonitor, "Boolean"));
 		}
 		catch (Standard_Failure&)
 		{
@@ -1715,6 +1960,7 @@ namespace TopologicCore
 		catch (std::runtime_error&)
 		{
 		}
+		ProgressMonitor::Check(rkOptions.progressMonitor);
 
 		if (rOcctCellsBuilder.HasErrors())
 		{
@@ -1794,12 +2040,82 @@ namespace TopologicCore
 	void Topology::RegularBooleanOperation(
 		const TopTools_ListOfShape & rkOcctArgumentsA, 
 		const TopTools_ListOfShape & rkOcctArgumentsB, 
-		BRepAlgoAPI_BooleanOperation& rOcctBooleanOperation)
+		BRepAlgoAPI_BooleanOperation& rOcctBooleanOperation,
+		const BooleanOptions& rkOptions)
 	{
 		rOcctBooleanOperation.SetArguments(rkOcctArgumentsA);
 		rOcctBooleanOperation.SetTools(rkOcctArgumentsB);
-		rOcctBooleanOperation.SetNonDestructive(true);
-		rOcctBooleanOperation.Build();
+		rkOptions.Apply(rOcctBooleanOperation);
+		ExecutionPolicy::GetInstance().Apply(rOcctBooleanOperation);
+		rOcctBooleanOperation.Build(ProgressMonitor::Start(rkOptions.progressMonitor, "Boolean"));
+		ProgressMonitor::Check(rkOptions.progressMonitor);
+	}
+
+	void Topology::NonRegularBooleanOperation(
+		const std::list<Topology::Ptr>& rkTopologies,
+		std::vector<TopTools_ListOfShape>& rOcctOperands,
+		BOPAlgo_CellsBuilder & rOcctCellsBuilder,
+		const BooleanOptions& rkOptions)
+	{
+		TopTools_ListOfShape occtArguments;
+		rOcctOperands.reserve(rkTopologies.size());
+		for (const Topology::Ptr& kpTopology : rkTopologies)
+		{
+			rOcctOperands.push_back(TopTools_ListOfShape());
+			TopTools_ListOfShape& rOcctTopologyOperands = rOcctOperands.back();
+			if (kpTopology->IsContainerType())
+			{
+				std::list<Topology::Ptr> subTopologies;
+				kpTopology->SubTopologies(subTopologies);
+				for (const Topology::Ptr& kpSubTopology : subTopologies)
+				{
+					rOcctTopologyOperands.Append(kpSubTopology->GetOcctShape());
+				}
+			}
+			else
+			{
+				rOcctTopologyOperands.Append(kpTopology->GetOcctShape());
+			}
+			AddOcctListShapeToAnotherList(rOcctTopologyOperands, occtArguments);
+		}
+
+		NonRegularBooleanOperation(occtArguments, TopTools_ListOfShape(), rOcctCellsBuilder, rkOptions);
+	}
+
+	Topology::Ptr Topology::NaryBooleanResult(
+		BOPAlgo_CellsBuilder & rOcctCellsBuilder,
+		const std::list<Topology::Ptr>& rkContentOrigins,
+		const std::list<Topology::Ptr>& rkDictionaryOrigins,
+		const bool kTransferDictionary)
+	{
+		rOcctCellsBuilder.MakeContainers();
+
+		TopoDS_Shape occtResultShape = rOcctCellsBuilder.Shape();
+		return BooleanResult(occtResultShape, rkContentOrigins, rkDictionaryOrigins, kTransferDictionary);
+	}
+
+	Topology::Ptr Topology::BooleanResult(
+		TopoDS_Shape & rOcctResultShape,
+		const std::list<Topology::Ptr>& rkContentOrigins,
+		const std::list<Topology::Ptr>& rkDictionaryOrigins,
+		const bool kTransferDictionary)
+	{
+		TopoDS_Shape occtPostprocessedShape = rOcctResultShape.IsNull() ? rOcctResultShape : PostprocessBooleanResult(rOcctResultShape);
+		Topology::Ptr pPostprocessedShape = Topology::ByOcctShape(occtPostprocessedShape, "");
+		if (pPostprocessedShape == nullptr)
+		{
+			return nullptr;
+		}
+
+		for (const Topology::Ptr& kpTopology : rkContentOrigins)
+		{
+			TransferContents(kpTopology->GetOcctShape(), pPostprocessedShape);
+		}
+		if (kTransferDictionary)
+		{
+			BooleanTransferDictionary(rkDictionaryOrigins, pPostprocessedShape.get(), true);
+		}
+		return pPostprocessedShape;
 	}
 
 	TopoDS_Shape Topology::PostprocessBooleanResult(TopoDS_Shape & rOcctBooleanResult)
@@ -1856,7 +2172,7 @@ namespace TopologicCore
 		}
 	}
 
-	Topology::Ptr Topology::Impose(const Topology::Ptr & kpTool, const bool kTransferDictionary)
+	Topology::Ptr Topology::Impose(const Topology::Ptr & kpTool, const bool kTransferDictionary, const BooleanOptions& rkOptions, const std::shared_ptr<BooleanHistory>& kpHistory)
 	{
 		if (kpTool == nullptr)
 		{
@@ -1867,8 +2183,22 @@ namespace TopologicCore
 		TopTools_ListOfShape occtArgumentsB;
 		AddBooleanOperands(kpTool, occtArgumentsA, occtArgumentsB);
 
+		TopTools_ListOfShape occtUntouchedArgumentsA;
+		TopTools_ListOfShape occtUntouchedArgumentsB;
+		PartitionBooleanOperands(kpTool, true, rkOptions, occtArgumentsA, occtArgumentsB, occtUntouchedArgumentsA, occtUntouchedArgumentsB);
+
+		// The operands which do not interact are in the result as they are.
+		TopTools_ListOfShape occtUntouchedArguments;
+		AddOcctListShapeToAnotherList(occtUntouchedArgumentsA, occtUntouchedArguments);
+		AddOcctListShapeToAnotherList(occtUntouchedArgumentsB, occtUntouchedArguments);
+		if (occtArgumentsA.IsEmpty() && occtArgumentsB.IsEmpty())
+		{
+			TopoDS_Shape occtResultShape;
+			return BinaryBooleanResult(occtResultShape, occtUntouchedArguments, kpTool, true, kTransferDictionary, nullptr, kpHistory);
+		}
+
 		BOPAlgo_CellsBuilder occtCellsBuilder;
-		NonRegularBooleanOperation(occtArgumentsA, occtArgumentsB, occtCellsBuilder);
+		NonRegularBooleanOperation(occtArgumentsA, occtArgumentsB, occtCellsBuilder, rkOptions);
 
 		// 2. Select the parts to be included in the final result.
 		TopTools_ListOfShape occtListToTake;
@@ -1906,23 +2236,10 @@ namespace TopologicCore
 		occtCellsBuilder.MakeContainers();
 
 		TopoDS_Shape occtResultShape = occtCellsBuilder.Shape();
-		TopoDS_Shape occtPostprocessedShape = occtResultShape.IsNull() ? occtResultShape : PostprocessBooleanResult(occtResultShape);
-		Topology::Ptr pPostprocessedShape = Topology::ByOcctShape(occtPostprocessedShape, "");
-		if (pPostprocessedShape == nullptr)
-		{
-			return nullptr;
-		}
-
-		TransferContents(GetOcctShape(), pPostprocessedShape);
-		TransferContents(kpTool->GetOcctShape(), pPostprocessedShape);
-		if (kTransferDictionary)
-		{
-			BooleanTransferDictionary(this, kpTool.get(), pPostprocessedShape.get(), true);
-		}
-		return pPostprocessedShape;
+		return BinaryBooleanResult(occtResultShape, occtUntouchedArguments, kpTool, true, kTransferDictionary, occtCellsBuilder.History(), kpHistory);
 	}
 
-	Topology::Ptr Topology::Imprint(const Topology::Ptr & kpTool, const bool kTransferDictionary)
+	Topology::Ptr Topology::Imprint(const Topology::Ptr & kpTool, const bool kTransferDictionary, const BooleanOptions& rkOptions, const std::shared_ptr<BooleanHistory>& kpHistory)
 	{
 		if (kpTool == nullptr)
 		{
@@ -1933,8 +2250,20 @@ namespace TopologicCore
 		TopTools_ListOfShape occtArgumentsB;
 		AddBooleanOperands(kpTool, occtArgumentsA, occtArgumentsB);
 
+		TopTools_ListOfShape occtUntouchedArgumentsA;
+		TopTools_ListOfShape occtUntouchedArgumentsB;
+		PartitionBooleanOperands(kpTool, true, rkOptions, occtArgumentsA, occtArgumentsB, occtUntouchedArgumentsA, occtUntouchedArgumentsB);
+
+		// The operands of this Topology which do not interact are in the result as they are, the ones of the other
+		// Topology are not.
+		if (occtArgumentsA.IsEmpty())
+		{
+			TopoDS_Shape occtResultShape;
+			return BinaryBooleanResult(occtResultShape, occtUntouchedArgumentsA, kpTool, true, kTransferDictionary, nullptr, kpHistory);
+		}
+
 		BOPAlgo_CellsBuilder occtCellsBuilder;
-		NonRegularBooleanOperation(occtArgumentsA, occtArgumentsB, occtCellsBuilder);
+		NonRegularBooleanOperation(occtArgumentsA, occtArgumentsB, occtCellsBuilder, rkOptions);
 
 		// 2. Select the parts to be included in the final result.
 
@@ -1963,30 +2292,17 @@ namespace TopologicCore
 			occtListToTake.Clear();
 			occtListToAvoid.Clear();
 			occtListToTake.Append(kOcctShapeIteratorA.Value());
-			occtListToAvoid.Append(occtArgumentsB);
+			occtListToAvoid = occtArgumentsB;
 			occtCellsBuilder.AddToResult(occtListToTake, occtListToAvoid);
 		}
 
 		occtCellsBuilder.MakeContainers();
 
 		TopoDS_Shape occtResultShape = occtCellsBuilder.Shape();
-		TopoDS_Shape occtPostprocessedShape = occtResultShape.IsNull() ? occtResultShape : PostprocessBooleanResult(occtResultShape);
-		Topology::Ptr pPostprocessedShape = Topology::ByOcctShape(occtPostprocessedShape, "");
-		if (pPostprocessedShape == nullptr)
-		{
-			return nullptr;
-		}
-
-		TransferContents(GetOcctShape(), pPostprocessedShape);
-		TransferContents(kpTool->GetOcctShape(), pPostprocessedShape);
-		if (kTransferDictionary)
-		{
-			BooleanTransferDictionary(this, kpTool.get(), pPostprocessedShape.get(), true);
-		}
-		return pPostprocessedShape;
+		return BinaryBooleanResult(occtResultShape, occtUntouchedArgumentsA, kpTool, true, kTransferDictionary, occtCellsBuilder.History(), kpHistory);
 	}
 
-	Topology::Ptr Topology::Intersect(const Topology::Ptr & kpOtherTopology, const bool kTransferDictionary)
+	Topology::Ptr Topology::Intersect(const Topology::Ptr & kpOtherTopology, const bool kTransferDictionary, const BooleanOptions& rkOptions, const std::shared_ptr<BooleanHistory>& kpHistory)
 	{
 		if (kpOtherTopology == nullptr)
 		{
@@ -2001,12 +2317,28 @@ namespace TopologicCore
 		TopTools_ListOfShape occtArgumentsB;
 		AddBooleanOperands(kpOtherTopology, occtArgumentsA, occtArgumentsB);
 
-		BRepAlgoAPI_Common occtCommon;
-		RegularBooleanOperation(occtArgumentsA, occtArgumentsB, occtCommon);
-
-		BRepAlgoAPI_Section occtSection;
-		RegularBooleanOperation(occtArgumentsA, occtArgumentsB, occtSection);
-
+		// The operands which do not interact with the other Topology cannot be in the intersection.
+		TopTools_ListOfShape occtUntouchedArgumentsA;
+		TopTools_ListOfShape occtUntouchedArgumentsB;
+		PartitionBooleanOperands(kpOtherTopology, false, rkOptions, occtArgumentsA, occtArgumentsB, occtUntouchedArgumentsA, occtUntouchedArgumentsB);
+		TopTools_ListOfShape occtOperands;
+		occtOperands.Append(GetOcctShape());
+		occtOperands.Append(kpOtherTopology->GetOcctShape());
+		if (occtArgumentsA.IsEmpty() || occtArgumentsB.IsEmpty())
+		{
+			if (kpHistory != nullptr)
+			{
+				kpHistory->Build(occtOperands, BooleanHistory::OcctHistorySteps(), TopoDS_Shape());
+			}
+			return nullptr;
+		}
+
+		BRepAlgoAPI_Common occtCommon;
+		RegularBooleanOperation(occtArgumentsA, occtArgumentsB, occtCommon, rkOptions);
+
+		BRepAlgoAPI_Section occtSection;
+		RegularBooleanOperation(occtArgumentsA, occtArgumentsB, occtSection, rkOptions);
+
 		// Create topology
 		Topology::Ptr commonTopology = Topology::ByOcctShape(occtCommon);
 		Topology::Ptr sectionTopology = Topology::ByOcctShape(occtSection);
@@ -2017,11 +2349,16 @@ namespace TopologicCore
 		bool isSectionPracticallyEmpty = (sectionTopology == nullptr)
 			|| (/*sectionTopology->GetType() != TOPOLOGY_VERTEX &&*/ sectionTopology->NumOfSubTopologies() == 0);
 		// Cases
+		BooleanHistory::Ptr pMergeHistory = kpHistory == nullptr ? nullptr : std::make_shared<BooleanHistory>();
 		Topology::Ptr mergeTopology = nullptr;
 		if (isCommonPracticallyEmpty)
 		{
 			if (isSectionPracticallyEmpty)
 			{
+				if (kpHistory != nullptr)
+				{
+					kpHistory->Build(occtOperands, BooleanHistory::OcctHistorySteps(), TopoDS_Shape());
+				}
 				return nullptr;
 			}
 			else
@@ -2037,7 +2374,7 @@ namespace TopologicCore
 			}
 			else
 			{
-				mergeTopology = commonTopology->Merge(sectionTopology);
+				mergeTopology = commonTopology->Merge(sectionTopology, false, rkOptions, pMergeHistory);
 			}
 		}
 
@@ -2047,20 +2384,15 @@ namespace TopologicCore
 		}
 
 		TopoDS_Shape occtResultMergeShape = mergeTopology->GetOcctShape();
-		TopoDS_Shape occtPostprocessedShape = occtResultMergeShape.IsNull() ? occtResultMergeShape : PostprocessBooleanResult(occtResultMergeShape);
-		Topology::Ptr pPostprocessedShape = Topology::ByOcctShape(occtPostprocessedShape, "");
-		if (pPostprocessedShape == nullptr)
+		Topology::Ptr pResult = BinaryBooleanResult(occtResultMergeShape, TopTools_ListOfShape(), kpOtherTopology, true, kTransferDictionary, nullptr, nullptr);
+		if (kpHistory != nullptr)
 		{
-			return nullptr;
+			// Common and Section are applied to the operands, then their results are merged.
+			BooleanHistory::OcctHistorySteps occtHistorySteps(1, { occtCommon.History(), occtSection.History() });
+			occtHistorySteps.insert(occtHistorySteps.end(), pMergeHistory->m_occtHistorySteps.begin(), pMergeHistory->m_occtHistorySteps.end());
+			kpHistory->Build(occtOperands, occtHistorySteps, pResult == nullptr ? TopoDS_Shape() : pResult->GetOcctShape());
 		}
-
-		TransferContents(GetOcctShape(), pPostprocessedShape);
-		TransferContents(kpOtherTopology->GetOcctShape(), pPostprocessedShape);
-		if (kTransferDictionary)
-		{
-			BooleanTransferDictionary(this, kpOtherTopology.get(), pPostprocessedShape.get(), true);
-		}
-		return pPostprocessedShape;
+		return pResult;
 
 
 		// NOTE: OCCT does not really have a one-size-fits-all intersection solution.
@@ -2181,7 +2513,7 @@ namespace TopologicCore
 		//return pCopyPostprocessedShape;
 	}
 
-	Topology::Ptr Topology::Merge(const Topology::Ptr & kpOtherTopology, const bool kTransferDictionary)
+	Topology::Ptr Topology::Merge(const Topology::Ptr & kpOtherTopology, const bool kTransferDictionary, const BooleanOptions& rkOptions, const std::shared_ptr<BooleanHistory>& kpHistory)
 	{
 		if (kpOtherTopology == nullptr)
 		{
@@ -2192,8 +2524,22 @@ namespace TopologicCore
 		TopTools_ListOfShape occtArgumentsB;
 		AddBooleanOperands(kpOtherTopology, occtArgumentsA, occtArgumentsB);
 
+		TopTools_ListOfShape occtUntouchedArgumentsA;
+		TopTools_ListOfShape occtUntouchedArgumentsB;
+		PartitionBooleanOperands(kpOtherTopology, true, rkOptions, occtArgumentsA, occtArgumentsB, occtUntouchedArgumentsA, occtUntouchedArgumentsB);
+
+		// The operands which do not interact are in the result as they are.
+		TopTools_ListOfShape occtUntouchedArguments;
+		AddOcctListShapeToAnotherList(occtUntouchedArgumentsA, occtUntouchedArguments);
+		AddOcctListShapeToAnotherList(occtUntouchedArgumentsB, occtUntouchedArguments);
+		if (occtArgumentsA.IsEmpty() && occtArgumentsB.IsEmpty())
+		{
+			TopoDS_Shape occtResultShape;
+			return BinaryBooleanResult(occtResultShape, occtUntouchedArguments, kpOtherTopology, true, kTransferDictionary, nullptr, kpHistory);
+		}
+
 		BOPAlgo_CellsBuilder occtCellsBuilder;
-		NonRegularBooleanOperation(occtArgumentsA, occtArgumentsB, occtCellsBuilder);
+		NonRegularBooleanOperation(occtArgumentsA, occtArgumentsB, occtCellsBuilder, rkOptions);
 
 		// 2. Select the parts to be included in the final result.
 		TopTools_ListOfShape occtListToTake;
@@ -2222,34 +2568,142 @@ namespace TopologicCore
 		occtCellsBuilder.MakeContainers();
 
 		TopoDS_Shape occtResultShape = occtCellsBuilder.Shape();
-		TopoDS_Shape occtPostprocessedShape = occtResultShape.IsNull() ? occtResultShape : PostprocessBooleanResult(occtResultShape);
-		Topology::Ptr pPostprocessedShape = Topology::ByOcctShape(occtPostprocessedShape, "");
-		if (pPostprocessedShape == nullptr)
+		return BinaryBooleanResult(occtResultShape, occtUntouchedArguments, kpOtherTopology, true, kTransferDictionary, occtCellsBuilder.History(), kpHistory);
+	}
+
+	static void ApplySelfMergeExecutionPolicy(const bool kRunParallel, BOPAlgo_Options& rOcctAlgorithm)
+	{
+		if (kRunParallel)
 		{
-			return nullptr;
+			ExecutionPolicy::GetInstance().Apply(rOcctAlgorithm);
 		}
-
-		TransferContents(GetOcctShape(), pPostprocessedShape);
-		TransferContents(kpOtherTopology->GetOcctShape(), pPostprocessedShape);
-		if (kTransferDictionary)
+		else
 		{
-			BooleanTransferDictionary(this, kpOtherTopology.get(), pPostprocessedShape.get(), true);
+			rOcctAlgorithm.SetRunParallel(Standard_False);
 		}
-		return pPostprocessedShape;
 	}
 
-	Topology::Ptr Topology::SelfMerge()
+	Topology::Ptr Topology::SelfMerge(const BooleanOptions& rkOptions)
 	{
 		// 1
 		TopTools_ListOfShape occtShapes;
 		SubTopologies(GetOcctShape(), occtShapes);
 
+		const ExecutionPolicy& rkExecutionPolicy = ExecutionPolicy::GetInstance();
+		std::vector<TopTools_ListOfShape> occtTiles;
+		if (rkOptions.tiledSelfMerge)
+		{
+			SelfMergeTiles(occtShapes, rkExecutionPolicy.GetNumberOfThreads(), rkOptions, occtTiles);
+		}
+
+		TopoDS_Shape occtFinalShape;
+		bool isComplete = false;
+		if (occtTiles.size() < 2)
+		{
+			occtFinalShape = SelfMergeShapes(occtShapes, rkOptions, true, isComplete);
+		}
+		else
+		{
+			// The tiles do not interact, so they are merged independently. Each tile runs its OCCT algorithms serially,
+			// as the tiles already occupy the threads.
+			// The monitor is only polled between the tiles, since its stages cannot run concurrently.
+			BooleanOptions tileOptions = rkOptions;
+			tileOptions.progressMonitor = nullptr;
+			const int kNumOfTiles = (int)occtTiles.size();
+			std::vector<TopoDS_Shape> occtTileShapes(kNumOfTiles);
+			std::vector<char> isTileComplete(kNumOfTiles, 0);
+			std::vector<std::string> tileErrors(kNumOfTiles);
+			OSD_Parallel::For(0, kNumOfTiles, [&](const int kTileIndex)
+			{
+				if (rkOptions.progressMonitor != nullptr && rkOptions.progressMonitor->IsCancelled())
+				{
+					return;
+				}
+
+				try {
+					bool isCurrentTileComplete = false;
+					occtTileShapes[kTileIndex] = SelfMergeShapes(occtTiles[kTileIndex], tileOptions, false, isCurrentTileComplete);
+					isTileComplete[kTileIndex] = isCurrentTileComplete ? 1 : 0;
+				}
+				catch (Standard_Failure& e)
+				{
+					tileErrors[kTileIndex] = e.GetMessageString();
+				}
+				catch (std::exception& e)
+				{
+					tileErrors[kTileIndex] = e.what();
+				}
+			}, !rkExecutionPolicy.GetRunParallel());
+			ProgressMonitor::Check(rkOptions.progressMonitor);
+
+			for (const std::string& rkTileError : tileErrors)
+			{
+				if (!rkTileError.empty())
+				{
+					throw std::runtime_error(rkTileError);
+				}
+			}
+
+			// Gather the containers of all tiles in one Cluster. As in the untiled case, the dictionaries and contents
+			// are only copied if every tile was merged completely.
+			isComplete = true;
+			TopoDS_Compound occtCompound;
+			BRep_Builder occtBuilder;
+			occtBuilder.MakeCompound(occtCompound);
+			for (int i = 0; i < kNumOfTiles; ++i)
+			{
+				const TopoDS_Shape& rkOcctTileShape = occtTileShapes[i];
+				if (rkOcctTileShape.IsNull())
+				{
+					continue;
+				}
+
+				if (rkOcctTileShape.ShapeType() == TopAbs_COMPOUND)
+				{
+					for (TopoDS_Iterator occtIterator(rkOcctTileShape); occtIterator.More(); occtIterator.Next())
+					{
+						occtBuilder.Add(occtCompound, occtIterator.Value());
+					}
+				}
+				else
+				{
+					occtBuilder.Add(occtCompound, rkOcctTileShape);
+				}
+
+				isComplete = isComplete && isTileComplete[i] != 0;
+			}
+
+			TopoDS_Shape occtCompoundShape = occtCompound;
+			occtFinalShape = Simplify(occtCompoundShape);
+		}
+
+		Topology::Ptr finalTopology = Topology::ByOcctShape(occtFinalShape, "");
+		if (!isComplete)
+		{
+			return finalTopology;
+		}
+
+		// Copy dictionaries
+		AttributeManager::GetInstance().DeepCopyAttributes(GetOcctShape(), finalTopology->GetOcctShape());
+
+		// Copy contents
+		TransferContents(GetOcctShape(), finalTopology);
+
+		return finalTopology;
+	}
+
+	TopoDS_Shape Topology::SelfMergeShapes(const TopTools_ListOfShape& rkOcctShapes, const BooleanOptions& rkOptions, const bool kRunParallel, bool& rIsComplete)
+	{
+		rIsComplete = false;
+
 		// 2
 		BOPAlgo_CellsBuilder occtCellsBuilder;
-		occtCellsBuilder.SetArguments(occtShapes);
+		occtCellsBuilder.SetArguments(rkOcctShapes);
+		rkOptions.Apply(occtCellsBuilder);
+		ApplySelfMergeExecutionPolicy(kRunParallel, occtCellsBuilder);
 
 		try {
-			occtCellsBuilder.Perform();
+			occtCellsBuilder.Perform(ProgressMonitor::Start(rkOptions.progressMonitor, "SelfMerge: Splitting"));
 		}
 		catch (Standard_Failure& e)
 		{
@@ -2261,6 +2715,7 @@ namespace TopologicCore
 			const char* str = e.what();
 			std::string stlStr(str);
 		}
+		ProgressMonitor::Check(rkOptions.progressMonitor);
 
 		if (occtCellsBuilder.HasErrors() || occtCellsBuilder.HasWarnings())
 		{
@@ -2269,17 +2724,17 @@ namespace TopologicCore
 			std::ostringstream warningStream;
 			occtCellsBuilder.DumpWarnings(warningStream);
 
-			// Exit here and return occtShapes as a cluster.
+			// Exit here and return the shapes as a cluster.
 			TopoDS_Compound occtCompound;
 			BRep_Builder occtBuilder;
 			occtBuilder.MakeCompound(occtCompound);
-			for (TopTools_ListIteratorOfListOfShape occtShapeIterator(occtShapes);
+			for (TopTools_ListIteratorOfListOfShape occtShapeIterator(rkOcctShapes);
 				occtShapeIterator.More();
 				occtShapeIterator.Next())
 			{
 				occtBuilder.Add(occtCompound, occtShapeIterator.Value());
 			}
-			return Topology::ByOcctShape(occtCompound, "");
+			return occtCompound;
 		}
 		occtCellsBuilder.AddAllToResult();
 
@@ -2288,11 +2743,11 @@ namespace TopologicCore
 		TopoDS_Compound occtCompound;
 		BRep_Builder occtBuilder;
 		occtBuilder.MakeCompound(occtCompound);
-		for (TopTools_ListIteratorOfListOfShape occtFaceIterator(occtShapes);
+		for (TopTools_ListIteratorOfListOfShape occtFaceIterator(rkOcctShapes);
 			occtFaceIterator.More();
 			occtFaceIterator.Next())
 		{
-			TopoDS_Shape& rCurrent = occtFaceIterator.Value();
+			const TopoDS_Shape& rCurrent = occtFaceIterator.Value();
 			if (occtCellsBuilder.IsDeleted(rCurrent))
 			{
 				occtBuilder.Add(occtCompound, rCurrent);
@@ -2317,16 +2772,17 @@ namespace TopologicCore
 
 		// 5. Topology = VolumeMaker(Face[])--> first result
 		BOPAlgo_MakerVolume occtVolumeMaker;
-		Standard_Boolean bRunParallel = Standard_False; /* parallel or single mode (the default value is FALSE)*/
 		Standard_Boolean bIntersect = Standard_True; /* intersect or not the arguments (the default value is TRUE)*/
 		Standard_Real aTol = 0.0; /* fuzzy option (default value is 0)*/
 								  //
 		occtVolumeMaker.SetArguments(occtFaces);
-		occtVolumeMaker.SetRunParallel(bRunParallel);
+		ApplySelfMergeExecutionPolicy(kRunParallel, occtVolumeMaker);
 		occtVolumeMaker.SetIntersect(bIntersect);
 		occtVolumeMaker.SetFuzzyValue(aTol);
+		rkOptions.Apply(occtVolumeMaker);
 		//
-		occtVolumeMaker.Perform(); //perform the operation
+		occtVolumeMaker.Perform(ProgressMonitor::Start(rkOptions.progressMonitor, "SelfMerge: Making volumes")); //perform the operation
+		ProgressMonitor::Check(rkOptions.progressMonitor);
 
 		if (occtVolumeMaker.HasErrors() || occtVolumeMaker.HasWarnings()) { //check error status
 			
@@ -2351,7 +2807,7 @@ namespace TopologicCore
 
 		// 7. Get the rest from Topology[] --> third result
 		TopTools_ListOfShape occtOtherShapes; // for step #7
-		for (TopTools_ListIteratorOfListOfShape occtShapeIterator(occtShapes);
+		for (TopTools_ListIteratorOfListOfShape occtShapeIterator(rkOcctShapes);
 			occtShapeIterator.More();
 			occtShapeIterator.Next())
 		{
@@ -2371,12 +2827,14 @@ namespace TopologicCore
 
 		if (occtFinalArguments.Size() == 1)
 		{
-			return Topology::ByOcctShape(occtVolumeMaker.Shape(), "");
+			return occtVolumeMaker.Shape();
 		}
 		BOPAlgo_CellsBuilder occtCellsBuilder2;
 		occtCellsBuilder2.SetArguments(occtFinalArguments);
+		rkOptions.Apply(occtCellsBuilder2);
+		ApplySelfMergeExecutionPolicy(kRunParallel, occtCellsBuilder2);
 		try {
-			occtCellsBuilder2.Perform();
+			occtCellsBuilder2.Perform(ProgressMonitor::Start(rkOptions.progressMonitor, "SelfMerge: Merging"));
 		}
 		catch (Standard_Failure& e)
 		{
@@ -2388,6 +2846,7 @@ namespace TopologicCore
 			const char* str = e.what();
 			std::string stlStr(str);
 		}
+		ProgressMonitor::Check(rkOptions.progressMonitor);
 
 		if (occtCellsBuilder2.HasErrors())
 		{
@@ -2437,23 +2896,175 @@ namespace TopologicCore
 			occtFinalResult = occtPostprocessedShape;
 		}
 
+		rIsComplete = true;
+		if (ExecutionPolicy::GetInstance().GetTrustInput())
+		{
+			return occtFinalResult;
+		}
+
 		// Shape fix
 		ShapeFix_Shape occtShapeFix(occtFinalResult);
 		occtShapeFix.Perform();
-		TopoDS_Shape fixedFinalShape = occtShapeFix.Shape();
+		return occtShapeFix.Shape();
+	}
 
-		Topology::Ptr finalTopology = Topology::ByOcctShape(fixedFinalShape, "");
+	void Topology::SelfMergeTiles(const TopTools_ListOfShape& rkOcctShapes, const int kNumberOfTiles, const BooleanOptions& rkOptions, std::vector<TopTools_ListOfShape>& rOcctTiles)
+	{
+		const int kNumOfShapes = rkOcctShapes.Size();
+		if (kNumberOfTiles < 2 || kNumOfShapes < 2)
+		{
+			rOcctTiles.push_back(rkOcctShapes);
+			return;
+		}
 
-		// Copy dictionaries
-		AttributeManager::GetInstance().DeepCopyAttributes(GetOcctShape(), finalTopology->GetOcctShape());
+		// 1. Compute the bounding box of each member, enlarged by the tolerance of the operation.
+		const double kGap = Precision::Confusion() + rkOptions.fuzzyValue;
+		std::vector<TopoDS_Shape> occtShapes;
+		occtShapes.reserve(kNumOfShapes);
+		Handle(Bnd_HArray1OfBox) pOcctBoxes = new Bnd_HArray1OfBox(1, kNumOfShapes);
+		Bnd_Box occtCompleteBox;
+		int index = 1;
+		for (TopTools_ListIteratorOfListOfShape occtShapeIterator(rkOcctShapes);
+			occtShapeIterator.More();
+			occtShapeIterator.Next())
+		{
+			Bnd_Box occtBox;
+			BRepBndLib::Add(occtShapeIterator.Value(), occtBox);
+			if (occtBox.IsVoid())
+			{
+				// Cannot be located, so do not tile.
+				rOcctTiles.push_back(rkOcctShapes);
+				return;
+			}
 
-		// Copy contents
-		TransferContents(GetOcctShape(), finalTopology);
+			occtBox.Enlarge(kGap);
+			pOcctBoxes->SetValue(index++, occtBox);
+			occtCompleteBox.Add(occtBox);
+			occtShapes.push_back(occtShapeIterator.Value());
+		}
 
-		return finalTopology;
+		// 2. Group the members whose boxes interact, directly or through other members.
+		std::vector<int> parents(kNumOfShapes);
+		for (int i = 0; i < kNumOfShapes; ++i)
+		{
+			parents[i] = i;
+		}
+		auto findRoot = [&parents](int i)
+		{
+			while (parents[i] != i)
+			{
+				parents[i] = parents[parents[i]];
+				i = parents[i];
+			}
+			return i;
+		};
+
+		Bnd_BoundSortBox occtBoxSorter;
+		occtBoxSorter.Initialize(occtCompleteBox, pOcctBoxes);
+		for (int i = 1; i <= kNumOfShapes; ++i)
+		{
+			const TColStd_ListOfInteger& rkCandidateIndices = occtBoxSorter.Compare(pOcctBoxes->Value(i));
+			for (TColStd_ListIteratorOfListOfInteger candidateIterator(rkCandidateIndices);
+				candidateIterator.More();
+				candidateIterator.Next())
+			{
+				int rootA = findRoot(i - 1);
+				int rootB = findRoot(candidateIterator.Value() - 1);
+				if (rootA != rootB)
+				{
+					parents[std::max(rootA, rootB)] = std::min(rootA, rootB);
+				}
+			}
+		}
+
+		std::vector<int> groupIndices(kNumOfShapes, -1);
+		std::vector<std::vector<int>> groups;
+		std::vector<Bnd_Box> occtGroupBoxes;
+		for (int i = 0; i < kNumOfShapes; ++i)
+		{
+			int root = findRoot(i);
+			if (groupIndices[root] < 0)
+			{
+				groupIndices[root] = (int)groups.size();
+				groups.push_back(std::vector<int>());
+				occtGroupBoxes.push_back(Bnd_Box());
+			}
+			groups[groupIndices[root]].push_back(i);
+			occtGroupBoxes[groupIndices[root]].Add(pOcctBoxes->Value(i + 1));
+		}
+
+		if (groups.size() < 2)
+		{
+			rOcctTiles.push_back(rkOcctShapes);
+			return;
+		}
+
+		// 3. Assign the groups to the tiles by splitting their centres along the longest axis, so that the tiles have
+		// similar numbers of members.
+		std::vector<gp_Pnt> occtCentres;
+		for (const Bnd_Box& rkOcctGroupBox : occtGroupBoxes)
+		{
+			occtCentres.push_back(gp_Pnt((rkOcctGroupBox.CornerMin().XYZ() + rkOcctGroupBox.CornerMax().XYZ()) * 0.5));
+		}
+
+		std::vector<int> groupOrder(groups.size());
+		for (int i = 0; i < (int)groupOrder.size(); ++i)
+		{
+			groupOrder[i] = i;
+		}
+
+		std::function<void(const int, const int, const int)> splitGroups = [&](const int kBegin, const int kEnd, const int kNumOfTiles)
+		{
+			if (kNumOfTiles < 2 || kEnd - kBegin < 2)
+			{
+				TopTools_ListOfShape occtTile;
+				for (int i = kBegin; i < kEnd; ++i)
+				{
+					for (int shapeIndex : groups[groupOrder[i]])
+					{
+						occtTile.Append(occtShapes[shapeIndex]);
+					}
+				}
+				rOcctTiles.push_back(occtTile);
+				return;
+			}
+
+			Bnd_Box occtCentreBox;
+			int numOfMembers = 0;
+			for (int i = kBegin; i < kEnd; ++i)
+			{
+				occtCentreBox.Add(occtCentres[groupOrder[i]]);
+				numOfMembers += (int)groups[groupOrder[i]].size();
+			}
+
+			double xMin = 0.0, yMin = 0.0, zMin = 0.0, xMax = 0.0, yMax = 0.0, zMax = 0.0;
+			occtCentreBox.Get(xMin, yMin, zMin, xMax, yMax, zMax);
+			const double kExtents[3] = { xMax - xMin, yMax - yMin, zMax - zMin };
+			const int kAxis = (int)(std::max_element(kExtents, kExtents + 3) - kExtents) + 1;
+			std::sort(groupOrder.begin() + kBegin, groupOrder.begin() + kEnd, [&](const int kGroupA, const int kGroupB)
+			{
+				return occtCentres[kGroupA].Coord(kAxis) < occtCentres[kGroupB].Coord(kAxis);
+			});
+
+			// Split where the lower half holds its share of the members, keeping at least one group on each side.
+			const int kNumOfLowerTiles = kNumOfTiles / 2;
+			const int kNumOfLowerMembers = numOfMembers * kNumOfLowerTiles / kNumOfTiles;
+			int middle = kBegin + 1;
+			int numOfMembersBelow = (int)groups[groupOrder[kBegin]].size();
+			while (middle < kEnd - 1 && numOfMembersBelow + (int)groups[groupOrder[middle]].size() <= kNumOfLowerMembers)
+			{
+				numOfMembersBelow += (int)groups[groupOrder[middle]].size();
+				++middle;
+			}
+
+			splitGroups(kBegin, middle, kNumOfLowerTiles);
+			splitGroups(middle, kEnd, kNumOfTiles - kNumOfLowerTiles);
+		};
+
+		splitGroups(0, (int)groupOrder.size(), std::min(kNumberOfTiles, (int)groupOrder.size()));
 	}
 
-	Topology::Ptr Topology::Slice(const Topology::Ptr & kpTool, const bool kTransferDictionary)
+	Topology::Ptr Topology::Slice(const Topology::Ptr & kpTool, const bool kTransferDictionary, const BooleanOptions& rkOptions, const std::shared_ptr<BooleanHistory>& kpHistory)
 	{
 		if (kpTool == nullptr)
 		{
@@ -2464,8 +3075,20 @@ namespace TopologicCore
 		TopTools_ListOfShape occtArgumentsB;
 		AddBooleanOperands(kpTool, occtArgumentsA, occtArgumentsB);
 
+		TopTools_ListOfShape occtUntouchedArgumentsA;
+		TopTools_ListOfShape occtUntouchedArgumentsB;
+		PartitionBooleanOperands(kpTool, true, rkOptions, occtArgumentsA, occtArgumentsB, occtUntouchedArgumentsA, occtUntouchedArgumentsB);
+
+		// The operands of this Topology which do not interact are in the result as they are, the ones of the other
+		// Topology are not.
+		if (occtArgumentsA.IsEmpty())
+		{
+			TopoDS_Shape occtResultShape;
+			return BinaryBooleanResult(occtResultShape, occtUntouchedArgumentsA, kpTool, false, kTransferDictionary, nullptr, kpHistory);
+		}
+
 		BOPAlgo_CellsBuilder occtCellsBuilder;
-		NonRegularBooleanOperation(occtArgumentsA, occtArgumentsB, occtCellsBuilder);
+		NonRegularBooleanOperation(occtArgumentsA, occtArgumentsB, occtCellsBuilder, rkOptions);
 
 		// 2. Select the parts to be included in the final result.
 		TopTools_ListOfShape occtListToTake;
@@ -2484,22 +3107,10 @@ namespace TopologicCore
 		occtCellsBuilder.MakeContainers();
 
 		TopoDS_Shape occtResultShape = occtCellsBuilder.Shape();
-		TopoDS_Shape occtPostprocessedShape = occtResultShape.IsNull() ? occtResultShape : PostprocessBooleanResult(occtResultShape);
-		Topology::Ptr pPostprocessedShape = Topology::ByOcctShape(occtPostprocessedShape, "");
-		if (pPostprocessedShape == nullptr)
-		{
-			return nullptr;
-		}
-
-		TransferContents(GetOcctShape(), pPostprocessedShape);
-		if (kTransferDictionary)
-		{
-			BooleanTransferDictionary(this, kpTool.get(), pPostprocessedShape.get(), true);
-		}
-		return pPostprocessedShape;
+		return BinaryBooleanResult(occtResultShape, occtUntouchedArgumentsA, kpTool, false, kTransferDictionary, occtCellsBuilder.History(), kpHistory);
 	}
 
-	Topology::Ptr Topology::Union(const Topology::Ptr & kpOtherTopology, const bool kTransferDictionary)
+	Topology::Ptr Topology::Union(const Topology::Ptr & kpOtherTopology, const bool kTransferDictionary, const BooleanOptions& rkOptions, const std::shared_ptr<BooleanHistory>& kpHistory)
 	{
 		if (kpOtherTopology == nullptr)
 		{
@@ -2510,24 +3121,189 @@ namespace TopologicCore
 		TopTools_ListOfShape occtArgumentsB;
 		AddBooleanOperands(kpOtherTopology, occtArgumentsA, occtArgumentsB);
 
+		TopTools_ListOfShape occtUntouchedArgumentsA;
+		TopTools_ListOfShape occtUntouchedArgumentsB;
+		PartitionBooleanOperands(kpOtherTopology, true, rkOptions, occtArgumentsA, occtArgumentsB, occtUntouchedArgumentsA, occtUntouchedArgumentsB);
+		if (occtArgumentsA.IsEmpty() != occtArgumentsB.IsEmpty())
+		{
+			// Only the members of a Cluster interact with each other, but a regular operation needs arguments and tools,
+			// so fall back to all the operands.
+			AddOcctListShapeToAnotherList(occtUntouchedArgumentsA, occtArgumentsA);
+			AddOcctListShapeToAnotherList(occtUntouchedArgumentsB, occtArgumentsB);
+			occtUntouchedArgumentsA.Clear();
+			occtUntouchedArgumentsB.Clear();
+		}
+
+		// The operands which do not interact are in the result as they are.
+		TopTools_ListOfShape occtUntouchedArguments;
+		AddOcctListShapeToAnotherList(occtUntouchedArgumentsA, occtUntouchedArguments);
+		AddOcctListShapeToAnotherList(occtUntouchedArgumentsB, occtUntouchedArguments);
+		if (occtArgumentsA.IsEmpty() && occtArgumentsB.IsEmpty())
+		{
+			TopoDS_Shape occtResultShape;
+			return BinaryBooleanResult(occtResultShape, occtUntouchedArguments, kpOtherTopology, true, kTransferDictionary, nullptr, kpHistory);
+		}
+
 		BRepAlgoAPI_Fuse occtFuse;
-		RegularBooleanOperation(occtArgumentsA, occtArgumentsB, occtFuse);
+		RegularBooleanOperation(occtArgumentsA, occtArgumentsB, occtFuse, rkOptions);
 
 		TopoDS_Shape occtResultShape = occtFuse.Shape();
-		TopoDS_Shape occtPostprocessedShape = occtResultShape.IsNull() ? occtResultShape : PostprocessBooleanResult(occtResultShape);
-		Topology::Ptr pPostprocessedShape = Topology::ByOcctShape(occtPostprocessedShape, "");
-		if (pPostprocessedShape == nullptr)
+		return BinaryBooleanResult(occtResultShape, occtUntouchedArguments, kpOtherTopology, true, kTransferDictionary, occtFuse.History(), kpHistory);
+	}
+
+	Topology::Ptr Topology::MergeMany(const std::list<Topology::Ptr>& rkTopologies, const bool kTransferDictionary, const BooleanOptions& rkOptions)
+	{
+		std::list<Topology::Ptr> topologies;
+		AddNonNullTopologies(rkTopologies, topologies);
+		if (topologies.empty())
 		{
 			return nullptr;
 		}
+		if (topologies.size() == 1)
+		{
+			return Topology::ByOcctShape(topologies.front()->GetOcctShape(), topologies.front()->GetInstanceGUID());
+		}
 
-		TransferContents(GetOcctShape(), pPostprocessedShape);
-		TransferContents(kpOtherTopology->GetOcctShape(), pPostprocessedShape);
-		if (kTransferDictionary)
+		std::vector<TopTools_ListOfShape> occtOperands;
+		BOPAlgo_CellsBuilder occtCellsBuilder;
+		NonRegularBooleanOperation(topologies, occtOperands, occtCellsBuilder, rkOptions);
+
+		// Take every part of every operand.
+		TopTools_ListOfShape occtListToTake;
+		TopTools_ListOfShape occtListToAvoid;
+		for (const TopTools_ListOfShape& rkOcctTopologyOperands : occtOperands)
+		{
+			for (TopTools_ListIteratorOfListOfShape kOcctShapeIterator(rkOcctTopologyOperands);
+				kOcctShapeIterator.More();
+				kOcctShapeIterator.Next())
+			{
+				occtListToTake.Clear();
+				occtListToTake.Append(kOcctShapeIterator.Value());
+				occtCellsBuilder.AddToResult(occtListToTake, occtListToAvoid);
+			}
+		}
+
+		return NaryBooleanResult(occtCellsBuilder, topologies, topologies, kTransferDictionary);
+	}
+
+	Topology::Ptr Topology::UnionMany(const std::list<Topology::Ptr>& rkTopologies, const bool kTransferDictionary, const BooleanOptions& rkOptions)
+	{
+		std::list<Topology::Ptr> topologies;
+		AddNonNullTopologies(rkTopologies, topologies);
+		if (topologies.empty())
 		{
-			BooleanTransferDictionary(this, kpOtherTopology.get(), pPostprocessedShape.get(), true);
+			return nullptr;
 		}
-		return pPostprocessedShape;
+		if (topologies.size() == 1)
+		{
+			return Topology::ByOcctShape(topologies.front()->GetOcctShape(), topologies.front()->GetInstanceGUID());
+		}
+
+		std::vector<TopTools_ListOfShape> occtOperands;
+		BOPAlgo_CellsBuilder occtCellsBuilder;
+		NonRegularBooleanOperation(topologies, occtOperands, occtCellsBuilder, rkOptions);
+
+		// Take every part with the same material, so that the boundaries between them can be removed.
+		TopTools_ListOfShape occtListToTake;
+		TopTools_ListOfShape occtListToAvoid;
+		for (const TopTools_ListOfShape& rkOcctTopologyOperands : occtOperands)
+		{
+			for (TopTools_ListIteratorOfListOfShape kOcctShapeIterator(rkOcctTopologyOperands);
+				kOcctShapeIterator.More();
+				kOcctShapeIterator.Next())
+			{
+				occtListToTake.Clear();
+				occtListToTake.Append(kOcctShapeIterator.Value());
+				occtCellsBuilder.AddToResult(occtListToTake, occtListToAvoid, 1);
+			}
+		}
+		occtCellsBuilder.RemoveInternalBoundaries();
+
+		return NaryBooleanResult(occtCellsBuilder, topologies, topologies, kTransferDictionary);
+	}
+
+	Topology::Ptr Topology::ImposeMany(const std::list<Topology::Ptr>& rkTopologies, const bool kTransferDictionary, const BooleanOptions& rkOptions)
+	{
+		std::list<Topology::Ptr> topologies;
+		AddNonNullTopologies(rkTopologies, topologies);
+		if (topologies.empty())
+		{
+			return nullptr;
+		}
+		if (topologies.size() == 1)
+		{
+			return Topology::ByOcctShape(topologies.front()->GetOcctShape(), topologies.front()->GetInstanceGUID());
+		}
+
+		std::vector<TopTools_ListOfShape> occtOperands;
+		BOPAlgo_CellsBuilder occtCellsBuilder;
+		NonRegularBooleanOperation(topologies, occtOperands, occtCellsBuilder, rkOptions);
+
+		// Take the parts of each operand which are not covered by the Topologies after it. As in Impose, the parts of
+		// the host stay split, while each imposed operand gets its own material and is rebuilt as a whole.
+		TopTools_ListOfShape occtListToTake;
+		TopTools_ListOfShape occtListToAvoid;
+		int material = 1;
+		for (size_t i = 0; i < occtOperands.size(); ++i)
+		{
+			TopTools_ListOfShape occtLaterOperands;
+			for (size_t j = i + 1; j < occtOperands.size(); ++j)
+			{
+				AddOcctListShapeToAnotherList(occtOperands[j], occtLaterOperands);
+			}
+
+			for (TopTools_ListIteratorOfListOfShape kOcctShapeIterator(occtOperands[i]);
+				kOcctShapeIterator.More();
+				kOcctShapeIterator.Next())
+			{
+				occtListToTake.Clear();
+				occtListToTake.Append(kOcctShapeIterator.Value());
+				if (i == 0)
+				{
+					occtCellsBuilder.AddToResult(occtListToTake, occtLaterOperands);
+				}
+				else
+				{
+					occtCellsBuilder.AddToResult(occtListToTake, occtLaterOperands, material++, true);
+				}
+			}
+		}
+
+		return NaryBooleanResult(occtCellsBuilder, topologies, topologies, kTransferDictionary);
+	}
+
+	Topology::Ptr Topology::SliceMany(const std::list<Topology::Ptr>& rkTopologies, const bool kTransferDictionary, const BooleanOptions& rkOptions)
+	{
+		std::list<Topology::Ptr> topologies;
+		AddNonNullTopologies(rkTopologies, topologies);
+		if (topologies.empty())
+		{
+			return nullptr;
+		}
+		if (topologies.size() == 1)
+		{
+			return Topology::ByOcctShape(topologies.front()->GetOcctShape(), topologies.front()->GetInstanceGUID());
+		}
+
+		std::vector<TopTools_ListOfShape> occtOperands;
+		BOPAlgo_CellsBuilder occtCellsBuilder;
+		NonRegularBooleanOperation(topologies, occtOperands, occtCellsBuilder, rkOptions);
+
+		// Only take the parts of the sliced Topology.
+		TopTools_ListOfShape occtListToTake;
+		TopTools_ListOfShape occtListToAvoid;
+		for (TopTools_ListIteratorOfListOfShape kOcctShapeIterator(occtOperands.front());
+			kOcctShapeIterator.More();
+			kOcctShapeIterator.Next())
+		{
+			occtListToTake.Clear();
+			occtListToTake.Append(kOcctShapeIterator.Value());
+			occtCellsBuilder.AddToResult(occtListToTake, occtListToAvoid);
+		}
+
+		// As in Slice, only the contents of the sliced Topology are transferred.
+		std::list<Topology::Ptr> contentOrigins{ topologies.front() };
+		return NaryBooleanResult(occtCellsBuilder, contentOrigins, topologies, kTransferDictionary);
 	}
 
 	TopoDS_Shape Topology::FixBooleanOperandCell(const TopoDS_Shape& rkOcctShape)
@@ -2984,7 +3760,256 @@ namespace TopologicCore
 		}
 	}
 
-	Topology::Ptr Topology::XOR(const Topology::Ptr & kpOtherTopology, const bool kTransferDictionary)
+	void Topology::PartitionBooleanOperands(
+		const Topology::Ptr& kpOtherTopology,
+		const bool kTestClusterOperands,
+		const BooleanOptions& rkOptions,
+		TopTools_ListOfShape& rOcctOperandsA,
+		TopTools_ListOfShape& rOcctOperandsB,
+		TopTools_ListOfShape& rOcctUntouchedOperandsA,
+		TopTools_ListOfShape& rOcctUntouchedOperandsB) const
+	{
+		if (!rkOptions.prefilter || rOcctOperandsA.IsEmpty() || rOcctOperandsB.IsEmpty())
+		{
+			return;
+		}
+
+		// 1. Compute the bounding box of each operand once, enlarged by the tolerance of the operation.
+		// Index 0 is this Topology, index 1 is the other Topology.
+		TopTools_ListOfShape* pOcctOperands[2] = { &rOcctOperandsA, &rOcctOperandsB };
+		const bool kTestOwnOperands[2] = {
+			kTestClusterOperands && GetType() == TOPOLOGY_CLUSTER,
+			kTestClusterOperands && kpOtherTopology->GetType() == TOPOLOGY_CLUSTER };
+
+		const int kNumOfOperands = rOcctOperandsA.Size() + rOcctOperandsB.Size();
+		const double kGap = Precision::Confusion() + rkOptions.fuzzyValue;
+		std::vector<int> operandSides;
+		operandSides.reserve(kNumOfOperands);
+		std::vector<Bnd_OBB> occtOrientedBoxes;
+		Handle(Bnd_HArray1OfBox) pOcctBoxes = new Bnd_HArray1OfBox(1, kNumOfOperands);
+		Bnd_Box occtCompleteBox;
+		int index = 1;
+		for (int side = 0; side < 2; ++side)
+		{
+			for (TopTools_ListIteratorOfListOfShape occtOperandIterator(*pOcctOperands[side]);
+				occtOperandIterator.More();
+				occtOperandIterator.Next())
+			{
+				Bnd_Box occtBox;
+				BRepBndLib::Add(occtOperandIterator.Value(), occtBox);
+				occtBox.Enlarge(kGap);
+				pOcctBoxes->SetValue(index++, occtBox);
+				occtCompleteBox.Add(occtBox);
+				operandSides.push_back(side);
+
+				if (rkOptions.useOBB)
+				{
+					Bnd_OBB occtOrientedBox;
+					BRepBndLib::AddOBB(occtOperandIterator.Value(), occtOrientedBox);
+					occtOrientedBox.Enlarge(kGap);
+					occtOrientedBoxes.push_back(occtOrientedBox);
+				}
+			}
+		}
+
+		// 2. Find the pairs of interacting operands. An operand is only tested against the operands of the same
+		// Topology if that Topology is a Cluster, since the members of the other containers do not overlap.
+		std::vector<bool> isInteracting(kNumOfOperands, false);
+		Bnd_BoundSortBox occtBoxSorter;
+		occtBoxSorter.Initialize(occtCompleteBox, pOcctBoxes);
+		for (int i = 1; i <= kNumOfOperands; ++i)
+		{
+			const Bnd_Box& rkOcctBox = pOcctBoxes->Value(i);
+			if (rkOcctBox.IsVoid())
+			{
+				// Cannot be located, so leave it to the Boolean operation.
+				isInteracting[i - 1] = true;
+				continue;
+			}
+
+			const TColStd_ListOfInteger& rkCandidateIndices = occtBoxSorter.Compare(rkOcctBox);
+			for (TColStd_ListIteratorOfListOfInteger candidateIterator(rkCandidateIndices);
+				candidateIterator.More();
+				candidateIterator.Next())
+			{
+				int j = candidateIterator.Value();
+				if (j == i)
+				{
+					continue;
+				}
+
+				int side = operandSides[i - 1];
+				if (side == operandSides[j - 1] && !kTestOwnOperands[side])
+				{
+					continue;
+				}
+
+				if (rkOptions.useOBB && occtOrientedBoxes[i - 1].IsOut(occtOrientedBoxes[j - 1]))
+				{
+					continue;
+				}
+
+				isInteracting[i - 1] = true;
+				isInteracting[j - 1] = true;
+			}
+		}
+
+		// 3. Move the operands which do not interact to the untouched lists.
+		TopTools_ListOfShape* pOcctUntouchedOperands[2] = { &rOcctUntouchedOperandsA, &rOcctUntouchedOperandsB };
+		index = 0;
+		for (int side = 0; side < 2; ++side)
+		{
+			TopTools_ListOfShape occtInteractingOperands;
+			for (TopTools_ListIteratorOfListOfShape occtOperandIterator(*pOcctOperands[side]);
+				occtOperandIterator.More();
+				occtOperandIterator.Next())
+			{
+				if (isInteracting[index++])
+				{
+					occtInteractingOperands.Append(occtOperandIterator.Value());
+				}
+				else
+				{
+					pOcctUntouchedOperands[side]->Append(occtOperandIterator.Value());
+				}
+			}
+			*pOcctOperands[side] = occtInteractingOperands;
+		}
+	}
+
+	void AddSplicedParts(const TopoDS_Shape& rkOcctShape, TopTools_MapOfShape& rOcctVisitedParts, TopoDS_Compound (&rOcctParts)[4])
+	{
+		BRep_Builder occtBuilder;
+		switch (rkOcctShape.ShapeType())
+		{
+		case TopAbs_COMPOUND:
+		case TopAbs_COMPSOLID:
+		case TopAbs_SHELL:
+		case TopAbs_WIRE:
+			for (TopoDS_Iterator occtIterator(rkOcctShape); occtIterator.More(); occtIterator.Next())
+			{
+				AddSplicedParts(occtIterator.Value(), rOcctVisitedParts, rOcctParts);
+			}
+			break;
+		case TopAbs_SOLID:
+			if (rOcctVisitedParts.Add(rkOcctShape)) occtBuilder.Add(rOcctParts[0], rkOcctShape);
+			break;
+		case TopAbs_FACE:
+			if (rOcctVisitedParts.Add(rkOcctShape)) occtBuilder.Add(rOcctParts[1], rkOcctShape);
+			break;
+		case TopAbs_EDGE:
+			if (rOcctVisitedParts.Add(rkOcctShape)) occtBuilder.Add(rOcctParts[2], rkOcctShape);
+			break;
+		case TopAbs_VERTEX:
+			if (rOcctVisitedParts.Add(rkOcctShape)) occtBuilder.Add(rOcctParts[3], rkOcctShape);
+			break;
+		default:
+			break;
+		}
+	}
+
+	TopoDS_Shape Topology::SpliceBooleanResult(const TopoDS_Shape& rkOcctResultShape, const TopTools_ListOfShape& rkOcctUntouchedOperands)
+	{
+		if (rkOcctUntouchedOperands.IsEmpty())
+		{
+			return rkOcctResultShape;
+		}
+
+		// 1. Collect the Cells, Faces, Edges and Vertices of the result and of the untouched operands.
+		BRep_Builder occtBuilder;
+		TopoDS_Compound occtParts[4];
+		for (int i = 0; i < 4; ++i)
+		{
+			occtBuilder.MakeCompound(occtParts[i]);
+		}
+
+		TopTools_MapOfShape occtVisitedParts;
+		if (!rkOcctResultShape.IsNull())
+		{
+			AddSplicedParts(rkOcctResultShape, occtVisitedParts, occtParts);
+		}
+		for (TopTools_ListIteratorOfListOfShape occtUntouchedOperandIterator(rkOcctUntouchedOperands);
+			occtUntouchedOperandIterator.More();
+			occtUntouchedOperandIterator.Next())
+		{
+			AddSplicedParts(occtUntouchedOperandIterator.Value(), occtVisitedParts, occtParts);
+		}
+
+		// 2. Group the connected parts. The untouched operands which shared members with the other operands still
+		// share them with the result, so e.g. the Cells of a CellComplex are grouped again.
+		TopAbs_ShapeEnum occtConnectionTypes[3] = { TopAbs_FACE, TopAbs_EDGE, TopAbs_VERTEX };
+		TopAbs_ShapeEnum occtPartTypes[3] = { TopAbs_SOLID, TopAbs_FACE, TopAbs_EDGE };
+		TopAbs_ShapeEnum occtContainerTypes[3] = { TopAbs_COMPSOLID, TopAbs_SHELL, TopAbs_WIRE };
+
+		TopoDS_Compound occtSplicedShape;
+		occtBuilder.MakeCompound(occtSplicedShape);
+		for (int i = 0; i < 3; ++i)
+		{
+			TopTools_ListOfListOfShape occtConnexityBlocks;
+			BOPTools_AlgoTools::MakeConnexityBlocks(occtParts[i], occtConnectionTypes[i], occtPartTypes[i], occtConnexityBlocks);
+			for (TopTools_ListOfListOfShape::Iterator occtConnexityBlockIterator(occtConnexityBlocks);
+				occtConnexityBlockIterator.More();
+				occtConnexityBlockIterator.Next())
+			{
+				TopoDS_Shape occtContainer;
+				BOPTools_AlgoTools::MakeContainer(occtContainerTypes[i], occtContainer);
+				for (TopTools_ListIteratorOfListOfShape occtPartIterator(occtConnexityBlockIterator.Value());
+					occtPartIterator.More();
+					occtPartIterator.Next())
+				{
+					occtBuilder.Add(occtContainer, occtPartIterator.Value());
+				}
+				occtBuilder.Add(occtSplicedShape, occtContainer);
+			}
+		}
+
+		for (TopoDS_Iterator occtVertexIterator(occtParts[3]); occtVertexIterator.More(); occtVertexIterator.Next())
+		{
+			occtBuilder.Add(occtSplicedShape, occtVertexIterator.Value());
+		}
+
+		return occtSplicedShape;
+	}
+
+	Topology::Ptr Topology::BinaryBooleanResult(
+		TopoDS_Shape & rOcctResultShape,
+		const TopTools_ListOfShape & rkOcctUntouchedOperands,
+		const Topology::Ptr & kpOtherTopology,
+		const bool kTransferContentsOfOther,
+		const bool kTransferDictionary,
+		const Handle(BRepTools_History)& kpOcctHistory,
+		const std::shared_ptr<BooleanHistory>& kpHistory)
+	{
+		TopoDS_Shape occtResultShape = SpliceBooleanResult(rOcctResultShape, rkOcctUntouchedOperands);
+		TopoDS_Shape occtPostprocessedShape = occtResultShape.IsNull() ? occtResultShape : PostprocessBooleanResult(occtResultShape);
+		if (kpHistory != nullptr)
+		{
+			// The splicing and the postprocessing keep the members of the result, so the OCCT history still applies.
+			TopTools_ListOfShape occtOperands;
+			occtOperands.Append(GetOcctShape());
+			occtOperands.Append(kpOtherTopology->GetOcctShape());
+			kpHistory->Build(occtOperands, BooleanHistory::OcctHistorySteps(1, { kpOcctHistory }), occtPostprocessedShape);
+		}
+
+		Topology::Ptr pPostprocessedShape = Topology::ByOcctShape(occtPostprocessedShape, "");
+		if (pPostprocessedShape == nullptr)
+		{
+			return nullptr;
+		}
+
+		TransferContents(GetOcctShape(), pPostprocessedShape);
+		if (kTransferContentsOfOther)
+		{
+			TransferContents(kpOtherTopology->GetOcctShape(), pPostprocessedShape);
+		}
+		if (kTransferDictionary)
+		{
+			BooleanTransferDictionary(this, kpOtherTopology.get(), pPostprocessedShape.get(), true, rkOcctUntouchedOperands);
+		}
+		return pPostprocessedShape;
+	}
+
+	Topology::Ptr Topology::XOR(const Topology::Ptr & kpOtherTopology, const bool kTransferDictionary, const BooleanOptions& rkOptions, const std::shared_ptr<BooleanHistory>& kpHistory)
 	{
 		if (kpOtherTopology == nullptr)
 		{
@@ -2995,8 +4020,22 @@ namespace TopologicCore
 		TopTools_ListOfShape occtArgumentsB;
 		AddBooleanOperands(kpOtherTopology, occtArgumentsA, occtArgumentsB);
 
+		TopTools_ListOfShape occtUntouchedArgumentsA;
+		TopTools_ListOfShape occtUntouchedArgumentsB;
+		PartitionBooleanOperands(kpOtherTopology, true, rkOptions, occtArgumentsA, occtArgumentsB, occtUntouchedArgumentsA, occtUntouchedArgumentsB);
+
+		// The operands which do not interact are in the result as they are.
+		TopTools_ListOfShape occtUntouchedArguments;
+		AddOcctListShapeToAnotherList(occtUntouchedArgumentsA, occtUntouchedArguments);
+		AddOcctListShapeToAnotherList(occtUntouchedArgumentsB, occtUntouchedArguments);
+		if (occtArgumentsA.IsEmpty() && occtArgumentsB.IsEmpty())
+		{
+			TopoDS_Shape occtResultShape;
+			return BinaryBooleanResult(occtResultShape, occtUntouchedArguments, kpOtherTopology, true, kTransferDictionary, nullptr, kpHistory);
+		}
+
 		BOPAlgo_CellsBuilder occtCellsBuilder;
-		NonRegularBooleanOperation(occtArgumentsA, occtArgumentsB, occtCellsBuilder);
+		NonRegularBooleanOperation(occtArgumentsA, occtArgumentsB, occtCellsBuilder, rkOptions);
 
 		// 2. Select the parts to be included in the final result.
 		TopTools_ListOfShape occtListToTake;
@@ -3038,22 +4077,10 @@ namespace TopologicCore
 		occtCellsBuilder.MakeContainers();
 
 		TopoDS_Shape occtResultShape = occtCellsBuilder.Shape();
-		TopoDS_Shape occtPostprocessedShape = occtResultShape.IsNull() ? occtResultShape : PostprocessBooleanResult(occtResultShape);
-		Topology::Ptr pPostprocessedShape = Topology::ByOcctShape(occtPostprocessedShape, "");
-		if (pPostprocessedShape == nullptr)
-		{
-			return nullptr;
-		}
-		TransferContents(GetOcctShape(), pPostprocessedShape);
-		TransferContents(kpOtherTopology->GetOcctShape(), pPostprocessedShape);
-		if (kTransferDictionary)
-		{
-			BooleanTransferDictionary(this, kpOtherTopology.get(), pPostprocessedShape.get(), true);
-		}
-		return pPostprocessedShape;
+		return BinaryBooleanResult(occtResultShape, occtUntouchedArguments, kpOtherTopology, true, kTransferDictionary, occtCellsBuilder.History(), kpHistory);
 	}
 
-	Topology::Ptr Topology::Divide(const Topology::Ptr & kpTool, const bool kTransferDictionary)
+	Topology::Ptr Topology::Divide(const Topology::Ptr & kpTool, const bool kTransferDictionary, const BooleanOptions& rkOptions)
 	{
 		if (kpTool == nullptr)
 		{
@@ -3068,7 +4095,7 @@ namespace TopologicCore
 			return nullptr;
 		}
 
-		Topology::Ptr pSlicedTopology = Slice(kpTool);
+		Topology::Ptr pSlicedTopology = Slice(kpTool, false, rkOptions);
 
 		if (topologyType == TOPOLOGY_CELL)
 		{
@@ -3169,6 +4196,41 @@ namespace TopologicCore
 		Navigate(kpHostTopology, rCellComplexes);
 	}
 
+	void Topology::Shells(const Topology::Ptr& kpHostTopology, std::vector<std::shared_ptr<Shell>>& rShells) const
+	{
+		Navigate(kpHostTopology, rShells);
+	}
+
+	void Topology::Edges(const Topology::Ptr& kpHostTopology, std::vector<std::shared_ptr<Edge>>& rEdges) const
+	{
+		Navigate(kpHostTopology, rEdges);
+	}
+
+	void Topology::Faces(const Topology::Ptr& kpHostTopology, std::vector<std::shared_ptr<Face>>& rFaces) const
+	{
+		Navigate(kpHostTopology, rFaces);
+	}
+
+	void Topology::Vertices(const Topology::Ptr& kpHostTopology, std::vector<std::shared_ptr<Vertex>>& rVertices) const
+	{
+		Navigate(kpHostTopology, rVertices);
+	}
+
+	void Topology::Wires(const Topology::Ptr& kpHostTopology, std::vector<std::shared_ptr<Wire>>& rWires) const
+	{
+		Navigate(kpHostTopology, rWires);
+	}
+
+	void Topology::Cells(const Topology::Ptr& kpHostTopology, std::vector<std::shared_ptr<Cell>>& rCells) const
+	{
+		Navigate(kpHostTopology, rCells);
+	}
+
+	void Topology::CellComplexes(const Topology::Ptr& kpHostTopology, std::vector<std::shared_ptr<CellComplex>>& rCellComplexes) const
+	{
+		Navigate(kpHostTopology, rCellComplexes);
+	}
+
 	bool Topology::IsContainerType(const TopoDS_Shape& rkOcctShape)
 	{
 		TopAbs_ShapeEnum occtShapeType = rkOcctShape.ShapeType();
@@ -3367,6 +4429,28 @@ namespace TopologicCore
 		Handle(ShapeBuild_ReShape) occtReshaper = new ShapeBuild_ReShape();
 		occtReshaper->Replace(rkOcctOriginalSubshape, rkOcctNewSubshape);
 		TopoDS_Shape newShape = occtReshaper->Apply(GetOcctShape());
+		if (newShape.IsNull() || newShape.IsSame(GetOcctShape()) || newShape.ShapeType() != GetOcctShape().ShapeType())
+		{
+			return;
+		}
+
+		// Only the replaced subshape and its ancestors are rebuilt by the reshaper.
+		TopTools_ListOfShape occtModifiedSubshapes;
+		occtModifiedSubshapes.Append(rkOcctOriginalSubshape);
+		TopologyIndexManager::GetInstance().Replace(GetOcctShape(), occtModifiedSubshapes, newShape);
+
+		SetInstanceGUID(newShape, GetInstanceGUID());
+		SetOcctShape(newShape);
+	}
+
+	unsigned long long Topology::GetModificationStamp() const
+	{
+		return TopologyIndexManager::GetInstance().GetModificationStamp(GetOcctShape());
+	}
+
+	TopologyIndex::Ptr Topology::Index() const
+	{
+		return TopologyIndexManager::GetInstance().Find(GetOcctShape());
 	}
 
 	bool Topology::IsSame(const Topology::Ptr& kpTopology) const
@@ -0,0 +1,308 @@
+// This file is part of Topologic software library.
+// Copyright(C) 2019, Cardiff University and University College London
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+#include "TopologyIndex.h"
+
+#include <TopoDS_Iterator.hxx>
+
+#include <atomic>
+#include <queue>
+
+namespace TopologicCore
+{
+	TopologyIndex::TopologyIndex(const TopoDS_Shape& rkOcctShape)
+		: m_modificationStamp(NewModificationStamp())
+	{
+		Rebuild(rkOcctShape);
+	}
+
+	TopologyIndex::~TopologyIndex()
+	{
+
+	}
+
+	bool TopologyIndex::Contains(const TopoDS_Shape& rkOcctShape) const
+	{
+		return m_occtParents.IsBound(rkOcctShape);
+	}
+
+	int TopologyIndex::NumberOfMembers(const TopAbs_ShapeEnum kOcctShapeType) const
+	{
+		return m_occtMembers[kOcctShapeType].Extent();
+	}
+
+	void TopologyIndex::Members(const TopAbs_ShapeEnum kOcctShapeType, TopTools_ListOfShape& rOcctMembers) const
+	{
+		const TopTools_IndexedMapOfShape& rkOcctMembers = m_occtMembers[kOcctShapeType];
+		for (int i = 1; i <= rkOcctMembers.Extent(); ++i)
+		{
+			rOcctMembers.Append(rkOcctMembers(i));
+		}
+	}
+
+	void TopologyIndex::Parents(const TopoDS_Shape& rkOcctShape, TopTools_ListOfShape& rOcctParents) const
+	{
+		if (!m_occtParents.IsBound(rkOcctShape))
+		{
+			return;
+		}
+
+		// A member can occur more than once in the same parent (e.g. a seam Edge), so remove the duplicates.
+		TopTools_MapOfShape occtVisitedParents;
+		for (TopTools_ListIteratorOfListOfShape occtParentIterator(m_occtParents.Find(rkOcctShape));
+			occtParentIterator.More();
+			occtParentIterator.Next())
+		{
+			if (occtVisitedParents.Add(occtParentIterator.Value()))
+			{
+				rOcctParents.Append(occtParentIterator.Value());
+			}
+		}
+	}
+
+	void TopologyIndex::Ancestors(const TopoDS_Shape& rkOcctShape, const TopAbs_ShapeEnum kOcctAncestorType, TopTools_ListOfShape& rOcctAncestors) const
+	{
+		if (!m_occtParents.IsBound(rkOcctShape))
+		{
+			return;
+		}
+
+		TopTools_MapOfShape occtVisitedShapes;
+		std::queue<TopoDS_Shape> occtShapeQueue;
+		occtShapeQueue.push(rkOcctShape);
+		while (!occtShapeQueue.empty())
+		{
+			TopoDS_Shape occtCurrentShape = occtShapeQueue.front();
+			occtShapeQueue.pop();
+
+			for (TopTools_ListIteratorOfListOfShape occtParentIterator(m_occtParents.Find(occtCurrentShape));
+				occtParentIterator.More();
+				occtParentIterator.Next())
+			{
+				const TopoDS_Shape& rkOcctParent = occtParentIterator.Value();
+				if (!occtVisitedShapes.Add(rkOcctParent))
+				{
+					continue;
+				}
+
+				if (rkOcctParent.ShapeType() == kOcctAncestorType)
+				{
+					rOcctAncestors.Append(rkOcctParent);
+				}
+				occtShapeQueue.push(rkOcctParent);
+			}
+		}
+	}
+
+	void TopologyIndex::AddMember(const TopoDS_Shape& rkOcctParent, const TopoDS_Shape& rkOcctMember)
+	{
+		if (!m_occtParents.IsBound(rkOcctParent))
+		{
+			return;
+		}
+
+		Insert(rkOcctMember, rkOcctParent);
+		m_modificationStamp = NewModificationStamp();
+	}
+
+	void TopologyIndex::RemoveMember(const TopoDS_Shape& rkOcctParent, const TopoDS_Shape& rkOcctMember)
+	{
+		Unlink(rkOcctParent, rkOcctMember);
+		Erase(rkOcctMember);
+		m_modificationStamp = NewModificationStamp();
+	}
+
+	void TopologyIndex::Update(const TopTools_ListOfShape& rkOcctModifiedMembers, const TopoDS_Shape& rkOcctNewShape)
+	{
+		// 1. Collect the modified members and their ancestors; these are the only shapes which have been rebuilt.
+		TopTools_MapOfShape occtRebuiltShapes;
+		for (TopTools_ListIteratorOfListOfShape occtMemberIterator(rkOcctModifiedMembers);
+			occtMemberIterator.More();
+			occtMemberIterator.Next())
+		{
+			const TopoDS_Shape& rkOcctMember = occtMemberIterator.Value();
+			if (!m_occtParents.IsBound(rkOcctMember))
+			{
+				// Not a member, so the rebuilt shapes are unknown.
+				Rebuild(rkOcctNewShape);
+				m_modificationStamp = NewModificationStamp();
+				return;
+			}
+
+			std::queue<TopoDS_Shape> occtShapeQueue;
+			occtShapeQueue.push(rkOcctMember);
+			while (!occtShapeQueue.empty())
+			{
+				TopoDS_Shape occtCurrentShape = occtShapeQueue.front();
+				occtShapeQueue.pop();
+				if (!occtRebuiltShapes.Add(occtCurrentShape))
+				{
+					continue;
+				}
+
+				for (TopTools_ListIteratorOfListOfShape occtParentIterator(m_occtParents.Find(occtCurrentShape));
+					occtParentIterator.More();
+					occtParentIterator.Next())
+				{
+					occtShapeQueue.push(occtParentIterator.Value());
+				}
+			}
+		}
+
+		// 2. Index the new shape. The recursion stops at the members which are already indexed.
+		if (occtRebuiltShapes.Contains(rkOcctNewShape))
+		{
+			// The shape has not been rebuilt.
+			return;
+		}
+		Insert(rkOcctNewShape, TopoDS_Shape());
+		m_occtShape = rkOcctNewShape;
+
+		// A shape assumed to be rebuilt is still used by the new shape, so the modified members were not
+		// the only changes; fall back to indexing the new shape from scratch.
+		for (TopTools_MapIteratorOfMapOfShape occtRebuiltShapeIterator(occtRebuiltShapes);
+			occtRebuiltShapeIterator.More();
+			occtRebuiltShapeIterator.Next())
+		{
+			for (TopTools_ListIteratorOfListOfShape occtParentIterator(m_occtParents.Find(occtRebuiltShapeIterator.Value()));
+				occtParentIterator.More();
+				occtParentIterator.Next())
+			{
+				if (!occtRebuiltShapes.Contains(occtParentIterator.Value()))
+				{
+					Rebuild(rkOcctNewShape);
+					m_modificationStamp = NewModificationStamp();
+					return;
+				}
+			}
+		}
+
+		// 3. Unlink the rebuilt shapes from their members, then remove them and the members which become orphans.
+		TopTools_ListOfShape occtUnlinkedMembers;
+		for (TopTools_MapIteratorOfMapOfShape occtRebuiltShapeIterator(occtRebuiltShapes);
+			occtRebuiltShapeIterator.More();
+			occtRebuiltShapeIterator.Next())
+		{
+			const TopoDS_Shape& rkOcctRebuiltShape = occtRebuiltShapeIterator.Value();
+			for (TopoDS_Iterator occtIterator(rkOcctRebuiltShape); occtIterator.More(); occtIterator.Next())
+			{
+				Unlink(rkOcctRebuiltShape, occtIterator.Value());
+				occtUnlinkedMembers.Append(occtIterator.Value());
+			}
+		}
+
+		for (TopTools_MapIteratorOfMapOfShape occtRebuiltShapeIterator(occtRebuiltShapes);
+			occtRebuiltShapeIterator.More();
+			occtRebuiltShapeIterator.Next())
+		{
+			const TopoDS_Shape& rkOcctRebuiltShape = occtRebuiltShapeIterator.Value();
+			m_occtParents.UnBind(rkOcctRebuiltShape);
+			m_occtMembers[rkOcctRebuiltShape.ShapeType()].RemoveKey(rkOcctRebuiltShape);
+		}
+
+		for (TopTools_ListIteratorOfListOfShape occtMemberIterator(occtUnlinkedMembers);
+			occtMemberIterator.More();
+			occtMemberIterator.Next())
+		{
+			Erase(occtMemberIterator.Value());
+		}
+
+		m_modificationStamp = NewModificationStamp();
+	}
+
+	unsigned long long TopologyIndex::NewModificationStamp()
+	{
+		static std::atomic<unsigned long long> lastModificationStamp(0);
+		return ++lastModificationStamp;
+	}
+
+	void TopologyIndex::Insert(const TopoDS_Shape& rkOcctShape, const TopoDS_Shape& rkOcctParent)
+	{
+		if (m_occtParents.IsBound(rkOcctShape))
+		{
+			if (!rkOcctParent.IsNull())
+			{
+				m_occtParents.ChangeFind(rkOcctShape).Append(rkOcctParent);
+			}
+			return;
+		}
+
+		TopTools_ListOfShape occtParents;
+		if (!rkOcctParent.IsNull())
+		{
+			occtParents.Append(rkOcctParent);
+		}
+		m_occtParents.Bind(rkOcctShape, occtParents);
+		m_occtMembers[rkOcctShape.ShapeType()].Add(rkOcctShape);
+
+		for (TopoDS_Iterator occtIterator(rkOcctShape); occtIterator.More(); occtIterator.Next())
+		{
+			Insert(occtIterator.Value(), rkOcctShape);
+		}
+	}
+
+	void TopologyIndex::Erase(const TopoDS_Shape& rkOcctShape)
+	{
+		if (!m_occtParents.IsBound(rkOcctShape) || !m_occtParents.Find(rkOcctShape).IsEmpty() || rkOcctShape.IsSame(m_occtShape))
+		{
+			return;
+		}
+
+		m_occtParents.UnBind(rkOcctShape);
+		m_occtMembers[rkOcctShape.ShapeType()].RemoveKey(rkOcctShape);
+
+		for (TopoDS_Iterator occtIterator(rkOcctShape); occtIterator.More(); occtIterator.Next())
+		{
+			Unlink(rkOcctShape, occtIterator.Value());
+			Erase(occtIterator.Value());
+		}
+	}
+
+	void TopologyIndex::Unlink(const TopoDS_Shape& rkOcctParent, const TopoDS_Shape& rkOcctShape)
+	{
+		if (!m_occtParents.IsBound(rkOcctShape))
+		{
+			return;
+		}
+
+		TopTools_ListOfShape& rOcctParents = m_occtParents.ChangeFind(rkOcctShape);
+		for (TopTools_ListIteratorOfListOfShape occtParentIterator(rOcctParents);
+			occtParentIterator.More();
+			occtParentIterator.Next())
+		{
+			if (occtParentIterator.Value().IsSame(rkOcctParent))
+			{
+				rOcctParents.Remove(occtParentIterator);
+				return;
+			}
+		}
+	}
+
+	void TopologyIndex::Rebuild(const TopoDS_Shape& rkOcctShape)
+	{
+		m_occtParents.Clear();
+		for (int i = 0; i <= TopAbs_SHAPE; ++i)
+		{
+			m_occtMembers[i].Clear();
+		}
+
+		m_occtShape = rkOcctShape;
+		if (!rkOcctShape.IsNull())
+		{
+			Insert(rkOcctShape, TopoDS_Shape());
+		}
+	}
+}
@@ -0,0 +1,174 @@
+// This file is part of Topologic software library.
+// Copyright(C) 2019, Cardiff University and University College London
+//
+// This program is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Affero General Public License as published by
+// the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This program is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Affero General Public License for more details.
+//
+// You should have received a copy of the GNU Affero General Public License
+// along with this program. If not, see <https://www.gnu.org/licenses/>.
+
+#include "TopologyIndexManager.h"
+#include "TopologyIndex.h"
+
+namespace TopologicCore
+{
+	TopologyIndexManager& TopologyIndexManager::GetInstance()
+	{
+		static TopologyIndexManager instance;
+		return instance;
+	}
+
+	TopologyIndexManager::TopologyIndexManager()
+		: m_useClock(0)
+	{
+
+	}
+
+	unsigned long long TopologyIndexManager::GetModificationStamp(const TopoDS_Shape& rkOcctShape)
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		ShapeToStampMap::const_iterator kStampIterator = m_occtShapeToStampMap.find(rkOcctShape);
+		if (kStampIterator == m_occtShapeToStampMap.end())
+		{
+			return 0;
+		}
+		return kStampIterator->second;
+	}
+
+	TopologyIndex::Ptr TopologyIndexManager::Find(const TopoDS_Shape& rkOcctShape)
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		ShapeToIndexMap::iterator indexIterator = m_occtShapeToIndexMap.find(rkOcctShape);
+
+		// The comparator only uses the TShape addresses, so check that the index is really for this shape.
+		if (indexIterator == m_occtShapeToIndexMap.end() || !indexIterator->second.first->GetOcctShape().IsSame(rkOcctShape))
+		{
+			return nullptr;
+		}
+		indexIterator->second.second = ++m_useClock;
+		return indexIterator->second.first;
+	}
+
+	void TopologyIndexManager::AddMember(const TopoDS_Shape& rkOcctParent, const TopoDS_Shape& rkOcctMember)
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		Modified(rkOcctParent);
+
+		ShapeToIndexMap::iterator indexIterator = m_occtShapeToIndexMap.find(rkOcctParent);
+		if (indexIterator != m_occtShapeToIndexMap.end() && indexIterator->second.first->GetOcctShape().IsSame(rkOcctParent))
+		{
+			// The compound is edited in place, so only the added member needs to be indexed.
+			indexIterator->second.first->AddMember(rkOcctParent, rkOcctMember);
+			indexIterator->second.second = ++m_useClock;
+			return;
+		}
+		Insert(rkOcctParent, std::make_shared<TopologyIndex>(rkOcctParent));
+	}
+
+	void TopologyIndexManager::RemoveMember(const TopoDS_Shape& rkOcctParent, const TopoDS_Shape& rkOcctMember)
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		Modified(rkOcctParent);
+
+		ShapeToIndexMap::iterator indexIterator = m_occtShapeToIndexMap.find(rkOcctParent);
+		if (indexIterator != m_occtShapeToIndexMap.end() && indexIterator->second.first->GetOcctShape().IsSame(rkOcctParent))
+		{
+			indexIterator->second.first->RemoveMember(rkOcctParent, rkOcctMember);
+			indexIterator->second.second = ++m_useClock;
+			return;
+		}
+		Insert(rkOcctParent, std::make_shared<TopologyIndex>(rkOcctParent));
+	}
+
+	void TopologyIndexManager::Replace(const TopoDS_Shape& rkOcctOriginalShape, const TopTools_ListOfShape& rkOcctModifiedMembers, const TopoDS_Shape& rkOcctNewShape)
+	{
+		if (rkOcctNewShape.IsNull() || rkOcctNewShape.IsSame(rkOcctOriginalShape))
+		{
+			return;
+		}
+
+		std::lock_guard<std::mutex> lock(m_mutex);
+		const bool kHasStamp = m_occtShapeToStampMap.erase(rkOcctOriginalShape) > 0;
+
+		ShapeToIndexMap::iterator indexIterator = m_occtShapeToIndexMap.find(rkOcctOriginalShape);
+		TopologyIndex::Ptr pIndex = nullptr;
+		if (indexIterator != m_occtShapeToIndexMap.end())
+		{
+			if (indexIterator->second.first->GetOcctShape().IsSame(rkOcctOriginalShape))
+			{
+				pIndex = indexIterator->second.first;
+			}
+			m_occtShapeToIndexMap.erase(indexIterator);
+		}
+
+		if (!kHasStamp && pIndex == nullptr)
+		{
+			return;
+		}
+
+		m_occtShapeToStampMap[rkOcctNewShape] = TopologyIndex::NewModificationStamp();
+		if (pIndex != nullptr)
+		{
+			pIndex->Update(rkOcctModifiedMembers, rkOcctNewShape);
+			Insert(rkOcctNewShape, pIndex);
+		}
+	}
+
+	void TopologyIndexManager::ClearOne(const TopoDS_Shape& rkOcctShape)
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_occtShapeToStampMap.erase(rkOcctShape);
+		m_occtShapeToIndexMap.erase(rkOcctShape);
+	}
+
+	void TopologyIndexManager::ClearAll()
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_occtShapeToStampMap.clear();
+		m_occtShapeToIndexMap.clear();
+	}
+
+	void TopologyIndexManager::Modified(const TopoDS_Shape& rkOcctShape)
+	{
+		m_occtShapeToStampMap[rkOcctShape] = TopologyIndex::NewModificationStamp();
+
+		// The indices of the shapes containing the compound are stale. There are at most kMaxNumberOfIndices of them.
+		for (ShapeToIndexMap::iterator indexIterator = m_occtShapeToIndexMap.begin(); indexIterator != m_occtShapeToIndexMap.end();)
+		{
+			const TopologyIndex::Ptr& kpIndex = indexIterator->second.first;
+			if (!kpIndex->GetOcctShape().IsSame(rkOcctShape) && kpIndex->Contains(rkOcctShape))
+			{
+				indexIterator = m_occtShapeToIndexMap.erase(indexIterator);
+			}
+			else
+			{
+				++indexIterator;
+			}
+		}
+	}
+
+	void TopologyIndexManager::Insert(const TopoDS_Shape& rkOcctShape, const TopologyIndex::Ptr& kpIndex)
+	{
+		m_occtShapeToIndexMap.erase(rkOcctShape);
+		if ((int)m_occtShapeToIndexMap.size() >= kMaxNumberOfIndices)
+		{
+			ShapeToIndexMap::iterator leastRecentlyUsedIterator = m_occtShapeToIndexMap.begin();
+			for (ShapeToIndexMap::iterator indexIterator = m_occtShapeToIndexMap.begin(); indexIterator != m_occtShapeToIndexMap.end(); ++indexIterator)
+			{
+				if (indexIterator->second.second < leastRecentlyUsedIterator->second.second)
+				{
+					leastRecentlyUsedIterator = indexIterator;
+				}
+			}
+			m_occtShapeToIndexMap.erase(leastRecentlyUsedIterator);
+		}
+		m_occtShapeToIndexMap.insert(std::make_pair(rkOcctShape, std::make_pair(kpIndex, ++m_useClock)));
+	}
+}
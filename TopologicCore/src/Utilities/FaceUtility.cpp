@@ -346,6 +346,13 @@ namespace TopologicUtilities
 	}
 
 	void FaceUtility::Triangulate(const TopologicCore::Face::Ptr & kpFace, const double kDeflection, std::list<TopologicCore::Face::Ptr>& rTriangles)
+	{
+		std::vector<TopologicCore::Face::Ptr> triangles;
+		Triangulate(kpFace, kDeflection, triangles);
+		rTriangles.insert(rTriangles.end(), triangles.begin(), triangles.end());
+	}
+
+	void FaceUtility::Triangulate(const TopologicCore::Face::Ptr & kpFace, const double kDeflection, std::vector<TopologicCore::Face::Ptr>& rTriangles)
 	{
 		TopoDS_Face occtFace = kpFace->GetOcctFace();
 		BRepMesh_IncrementalMesh occtIncrementalMesh(occtFace, kDeflection);
@@ -356,6 +363,7 @@ namespace TopologicUtilities
 			throw std::runtime_error("No triangulation was produced.");
 		}
 		int numOfTriangles = pOcctTriangulation->NbTriangles();
+		rTriangles.reserve(rTriangles.size() + numOfTriangles);
 		for (int i = 1; i <= numOfTriangles; ++i)
 		{
 			int index1 = 0, index2 = 0, index3 = 0;
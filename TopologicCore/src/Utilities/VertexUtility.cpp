@@ -56,6 +56,19 @@ namespace TopologicUtilities
 		}
 	}
 
+	void VertexUtility::AdjacentEdges(
+		const TopologicCore::Vertex::Ptr & kpVertex,
+		const TopologicCore::Topology::Ptr & kpParentTopology,
+		std::vector<TopologicCore::Edge::Ptr>& rCoreAdjacentEdges)
+	{
+		AdjacentEdges(kpVertex, kpParentTopology.get(), rCoreAdjacentEdges);
+	}
+
+	void VertexUtility::AdjacentEdges(const TopologicCore::Vertex::Ptr & kpVertex, TopologicCore::Topology const * const kpkParentTopology, std::vector<TopologicCore::Edge::Ptr>& rCoreAdjacentEdges)
+	{
+		kpVertex->UpwardNavigation(kpkParentTopology->GetOcctShape(), rCoreAdjacentEdges);
+	}
+
 	double DistanceVertexVertex(
 		const TopologicCore::Vertex::Ptr& kpVertex1,
 		const TopologicCore::Vertex::Ptr& kpVertex2)
@@ -77,7 +90,7 @@ namespace TopologicUtilities
 		const TopologicCore::Wire::Ptr& kpWire)
 	{
 		double minDistance = std::numeric_limits<double>::max();
-		std::list<TopologicCore::Edge::Ptr> edges;
+		std::vector<TopologicCore::Edge::Ptr> edges;
 		kpWire->Edges(nullptr, edges);
 
 		for (const TopologicCore::Edge::Ptr& kpEdge : edges)
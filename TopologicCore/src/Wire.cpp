@@ -51,7 +51,7 @@ namespace TopologicCore
 		else
 		{
             // This only works for manifold wire with a flow
-			std::list<Vertex::Ptr> vertices;
+			std::vector<Vertex::Ptr> vertices;
 			DownwardNavigation<Vertex>(vertices);
 			if (vertices.empty())
 			{
@@ -67,7 +67,7 @@ namespace TopologicCore
 			{
 				for (const Vertex::Ptr& kpVertex : vertices)
 				{
-					std::list<Edge::Ptr> adjacentEdges;
+					std::vector<Edge::Ptr> adjacentEdges;
 					//kpVertex->Edges(adjacentEdges);
 					TopologicUtilities::VertexUtility::AdjacentEdges(kpVertex, this, adjacentEdges);
 
@@ -94,7 +94,7 @@ namespace TopologicCore
 			Vertex::Ptr currentVertex = startingVertex;
 			Edge::Ptr previousEdge = nullptr;
 			do {
-				std::list<Edge::Ptr> adjacentEdges;
+				std::vector<Edge::Ptr> adjacentEdges;
 				TopologicUtilities::VertexUtility::AdjacentEdges(currentVertex, this, adjacentEdges);
 
 				Edge::Ptr currentEdge = nullptr;
@@ -122,7 +122,7 @@ namespace TopologicCore
 				previousEdge = currentEdge;
 
 				// Get the other vertex
-				std::list<Vertex::Ptr> vertices;
+				std::vector<Vertex::Ptr> vertices;
 				currentEdge->Vertices(nullptr, vertices);
 
 				for (const Vertex::Ptr& kpVertex : vertices)
@@ -204,6 +204,30 @@ namespace TopologicCore
 		}
 	}
 
+	void Wire::Edges(const Topology::Ptr& kpHostTopology, std::vector<Edge::Ptr>& rEdges) const
+	{
+		if (!IsManifold(nullptr))
+		{
+			DownwardNavigation(rEdges);
+			return;
+		}
+
+		// The ordered traversal only appends at the end, so reuse it and copy the result in one allocation.
+		std::list<Edge::Ptr> edges;
+		Edges(kpHostTopology, edges);
+		rEdges.reserve(rEdges.size() + edges.size());
+		rEdges.insert(rEdges.end(), edges.begin(), edges.end());
+	}
+
+	void Wire::Vertices(const Topology::Ptr& kpHostTopology, std::vector<Vertex::Ptr>& rVertices) const
+	{
+		// The list overload reorders the first Vertices, which is cheap on a list.
+		std::list<Vertex::Ptr> vertices;
+		Vertices(kpHostTopology, vertices);
+		rVertices.reserve(rVertices.size() + vertices.size());
+		rVertices.insert(rVertices.end(), vertices.begin(), vertices.end());
+	}
+
 	// This method may involve making copies of the edges if they originally do not share vertices.
 	Wire::Ptr Wire::ByEdges(const std::list<Edge::Ptr>& rkEdges, const bool kCopyAttributes)
 	{
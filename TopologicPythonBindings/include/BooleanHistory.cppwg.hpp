@@ -0,0 +1,6 @@
+#ifndef BooleanHistory_hpp__pyplusplus_wrapper
+#define BooleanHistory_hpp__pyplusplus_wrapper
+
+namespace py = pybind11;
+void register_BooleanHistory_class(py::module &m);
+#endif // BooleanHistory_hpp__pyplusplus_wrapper
@@ -0,0 +1,6 @@
+#ifndef BooleanOptions_hpp__pyplusplus_wrapper
+#define BooleanOptions_hpp__pyplusplus_wrapper
+
+namespace py = pybind11;
+void register_BooleanOptions_class(py::module &m);
+#endif // BooleanOptions_hpp__pyplusplus_wrapper
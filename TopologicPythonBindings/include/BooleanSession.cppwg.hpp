@@ -0,0 +1,6 @@
+#ifndef BooleanSession_hpp__pyplusplus_wrapper
+#define BooleanSession_hpp__pyplusplus_wrapper
+
+namespace py = pybind11;
+void register_BooleanSession_class(py::module &m);
+#endif // BooleanSession_hpp__pyplusplus_wrapper
@@ -0,0 +1,6 @@
+#ifndef ExecutionPolicy_hpp__pyplusplus_wrapper
+#define ExecutionPolicy_hpp__pyplusplus_wrapper
+
+namespace py = pybind11;
+void register_ExecutionPolicy_class(py::module &m);
+#endif // ExecutionPolicy_hpp__pyplusplus_wrapper
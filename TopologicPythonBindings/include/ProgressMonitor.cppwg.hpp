@@ -0,0 +1,6 @@
+#ifndef ProgressMonitor_hpp__pyplusplus_wrapper
+#define ProgressMonitor_hpp__pyplusplus_wrapper
+
+namespace py = pybind11;
+void register_ProgressMonitor_class(py::module &m);
+#endif // ProgressMonitor_hpp__pyplusplus_wrapper
@@ -11,6 +11,11 @@
 #include "ShellFactory.h"
 #include "Geometry.h"
 #include "Edge.h"
+#include "ExecutionPolicy.h"
+#include "BooleanHistory.h"
+#include "BooleanOptions.h"
+#include "BooleanSession.h"
+#include "ProgressMonitor.h"
 #include "Utilities.h"
 #include "IntAttribute.h"
 #include "AttributeManager.h"
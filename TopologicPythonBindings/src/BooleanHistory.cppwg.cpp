@@ -0,0 +1,49 @@
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+#include "wrapper_header_collection.hpp"
+
+#include "BooleanHistory.cppwg.hpp"
+
+namespace py = pybind11;
+PYBIND11_DECLARE_HOLDER_TYPE(T, std::shared_ptr<T>);
+
+void register_BooleanHistory_class(py::module &m){
+py::class_<BooleanHistory  , std::shared_ptr<BooleanHistory >   >(m, "BooleanHistory")
+        .def(py::init< >())
+        .def(
+            "Modified",
+            [](const BooleanHistory& obj, ::TopologicCore::Topology::Ptr const& kpInput, py::list& rModified) {
+        std::list<Topology::Ptr> local;
+        obj.Modified(kpInput, local);
+        for (auto& x : local)
+            rModified.append(x);
+    },
+            " ", py::arg("kpInput"), py::arg("rModified"))
+        .def(
+            "Generated",
+            [](const BooleanHistory& obj, ::TopologicCore::Topology::Ptr const& kpInput, py::list& rGenerated) {
+        std::list<Topology::Ptr> local;
+        obj.Generated(kpInput, local);
+        for (auto& x : local)
+            rGenerated.append(x);
+    },
+            " ", py::arg("kpInput"), py::arg("rGenerated"))
+        .def(
+            "IsDeleted",
+            (bool(BooleanHistory::*)(::TopologicCore::Topology::Ptr const&) const) &BooleanHistory::IsDeleted,
+            " ", py::arg("kpInput"))
+        .def(
+            "Origins",
+            [](const BooleanHistory& obj, ::TopologicCore::Topology::Ptr const& kpOutput, py::list& rOrigins) {
+        std::list<Topology::Ptr> local;
+        obj.Origins(kpOutput, local);
+        for (auto& x : local)
+            rOrigins.append(x);
+    },
+            " ", py::arg("kpOutput"), py::arg("rOrigins"))
+        .def(
+            "Clear",
+            (void(BooleanHistory::*)()) &BooleanHistory::Clear,
+            " ")
+    ;
+}
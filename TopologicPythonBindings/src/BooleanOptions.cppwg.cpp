@@ -0,0 +1,26 @@
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+#include "wrapper_header_collection.hpp"
+
+#include "BooleanOptions.cppwg.hpp"
+
+namespace py = pybind11;
+PYBIND11_DECLARE_HOLDER_TYPE(T, std::shared_ptr<T>);
+
+void register_BooleanOptions_class(py::module &m){
+py::enum_<BOPAlgo_GlueEnum>(m, "GlueMode")
+        .value("GlueOff", BOPAlgo_GlueOff)
+        .value("GlueShift", BOPAlgo_GlueShift)
+        .value("GlueFull", BOPAlgo_GlueFull)
+    ;
+py::class_<BooleanOptions  , std::shared_ptr<BooleanOptions >   >(m, "BooleanOptions")
+        .def(py::init< >())
+        .def_readwrite("fuzzyValue", &BooleanOptions::fuzzyValue)
+        .def_readwrite("glue", &BooleanOptions::glue)
+        .def_readwrite("nonDestructive", &BooleanOptions::nonDestructive)
+        .def_readwrite("useOBB", &BooleanOptions::useOBB)
+        .def_readwrite("prefilter", &BooleanOptions::prefilter)
+        .def_readwrite("tiledSelfMerge", &BooleanOptions::tiledSelfMerge)
+        .def_readwrite("progressMonitor", &BooleanOptions::progressMonitor)
+    ;
+}
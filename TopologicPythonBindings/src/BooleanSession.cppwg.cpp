@@ -0,0 +1,46 @@
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+#include "wrapper_header_collection.hpp"
+
+#include "BooleanSession.cppwg.hpp"
+
+namespace py = pybind11;
+PYBIND11_DECLARE_HOLDER_TYPE(T, std::shared_ptr<T>);
+
+void register_BooleanSession_class(py::module &m){
+py::class_<BooleanSession  , std::shared_ptr<BooleanSession >   >(m, "BooleanSession")
+        .def(py::init<::TopologicCore::Topology::Ptr const &, ::TopologicCore::Topology::Ptr const &, bool const, ::TopologicCore::BooleanOptions const & >(), py::arg("kpTopologyA"), py::arg("kpTopologyB"), py::arg("kFixOperands") = false, py::arg("rkOptions") = BooleanOptions())
+        .def(
+            "Difference", 
+            (::TopologicCore::Topology::Ptr(BooleanSession::*)(bool const)) &BooleanSession::Difference, 
+            " " , py::arg("kTransferDictionary") = false )
+        .def(
+            "Impose", 
+            (::TopologicCore::Topology::Ptr(BooleanSession::*)(bool const)) &BooleanSession::Impose, 
+            " " , py::arg("kTransferDictionary") = false )
+        .def(
+            "Imprint", 
+            (::TopologicCore::Topology::Ptr(BooleanSession::*)(bool const)) &BooleanSession::Imprint, 
+            " " , py::arg("kTransferDictionary") = false )
+        .def(
+            "Intersect", 
+            (::TopologicCore::Topology::Ptr(BooleanSession::*)(bool const)) &BooleanSession::Intersect, 
+            " " , py::arg("kTransferDictionary") = false )
+        .def(
+            "Merge", 
+            (::TopologicCore::Topology::Ptr(BooleanSession::*)(bool const)) &BooleanSession::Merge, 
+            " " , py::arg("kTransferDictionary") = false )
+        .def(
+            "Slice", 
+            (::TopologicCore::Topology::Ptr(BooleanSession::*)(bool const)) &BooleanSession::Slice, 
+            " " , py::arg("kTransferDictionary") = false )
+        .def(
+            "Union", 
+            (::TopologicCore::Topology::Ptr(BooleanSession::*)(bool const)) &BooleanSession::Union, 
+            " " , py::arg("kTransferDictionary") = false )
+        .def(
+            "XOR", 
+            (::TopologicCore::Topology::Ptr(BooleanSession::*)(bool const)) &BooleanSession::XOR, 
+            " " , py::arg("kTransferDictionary") = false )
+    ;
+}
@@ -131,7 +131,7 @@ py::class_<Cell , Cell_Overloads , std::shared_ptr<Cell >  , Topology  >(m, "Cel
         .def(
          "Vertices",
             [](const Cell& obj, ::TopologicCore::Topology::Ptr const& kpHostTopology, py::list& rVertices) {
-                std::list<Vertex::Ptr> local;
+                std::vector<Vertex::Ptr> local;
                 obj.Vertices(kpHostTopology, local);
                 for (auto& x : local)
                     rVertices.append(x);
@@ -140,7 +140,7 @@ py::class_<Cell , Cell_Overloads , std::shared_ptr<Cell >  , Topology  >(m, "Cel
         .def(
             "Edges",
             [](const Cell& obj, ::TopologicCore::Topology::Ptr const& kpHostTopology, py::list& rEdges) {
-                std::list<Edge::Ptr> local;
+                std::vector<Edge::Ptr> local;
                 obj.Edges(kpHostTopology, local);
                 for (auto& x : local)
                     rEdges.append(x);
@@ -150,7 +150,7 @@ py::class_<Cell , Cell_Overloads , std::shared_ptr<Cell >  , Topology  >(m, "Cel
         .def(
             "Wires",
             [](const Cell& obj, ::TopologicCore::Topology::Ptr const& kpHostTopology, py::list& rWires) {
-                std::list<Wire::Ptr> local;
+                std::vector<Wire::Ptr> local;
                 obj.Wires(kpHostTopology, local);
                 for (auto& x : local)
                     rWires.append(x);
@@ -159,7 +159,7 @@ py::class_<Cell , Cell_Overloads , std::shared_ptr<Cell >  , Topology  >(m, "Cel
         .def(
             "Faces",
             [](const Cell& obj, ::TopologicCore::Topology::Ptr const& kpHostTopology, py::list& rFaces) {
-                std::list<Face::Ptr> local;
+                std::vector<Face::Ptr> local;
                 obj.Faces(kpHostTopology, local);
                 for (auto& x : local)
                     rFaces.append(x);
@@ -168,7 +168,7 @@ py::class_<Cell , Cell_Overloads , std::shared_ptr<Cell >  , Topology  >(m, "Cel
         .def(
             "Shells",
             [](const Cell& obj, ::TopologicCore::Topology::Ptr const& kpHostTopology, py::list& rShells) {
-                std::list<Shell::Ptr> local;
+                std::vector<Shell::Ptr> local;
                 obj.Shells(kpHostTopology, local);
                 for (auto& x : local)
                     rShells.append(x);
@@ -177,7 +177,7 @@ py::class_<Cell , Cell_Overloads , std::shared_ptr<Cell >  , Topology  >(m, "Cel
         .def(
             "Cells",
             [](const Cell& obj, ::TopologicCore::Topology::Ptr const& kpHostTopology, py::list& rCells) {
-                std::list<Cell::Ptr> local;
+                std::vector<Cell::Ptr> local;
                 obj.Cells(kpHostTopology, local);
                 for (auto& x : local)
                     rCells.append(x);
@@ -186,7 +186,7 @@ py::class_<Cell , Cell_Overloads , std::shared_ptr<Cell >  , Topology  >(m, "Cel
         .def(
             "CellComplexes",
             [](const Cell& obj, ::TopologicCore::Topology::Ptr const& kpHostTopology, py::list& rCellComplexes) {
-                std::list<CellComplex::Ptr> local;
+                std::vector<CellComplex::Ptr> local;
                 obj.CellComplexes(kpHostTopology, local);
                 for (auto& x : local)
                     rCellComplexes.append(x);
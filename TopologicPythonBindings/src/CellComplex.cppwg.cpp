@@ -118,7 +118,7 @@ py::class_<CellComplex , CellComplex_Overloads , std::shared_ptr<CellComplex >
         .def(
         "Vertices",
         [](const CellComplex& obj, ::TopologicCore::Topology::Ptr const& kpHostTopology, py::list& rVertices) {
-            std::list<Vertex::Ptr> local;
+            std::vector<Vertex::Ptr> local;
             obj.Vertices(kpHostTopology, local);
             for (auto& x : local)
                 rVertices.append(x);
@@ -127,7 +127,7 @@ py::class_<CellComplex , CellComplex_Overloads , std::shared_ptr<CellComplex >
         .def(
             "Edges",
             [](const CellComplex& obj, ::TopologicCore::Topology::Ptr const& kpHostTopology, py::list& rEdges) {
-                std::list<Edge::Ptr> local;
+                std::vector<Edge::Ptr> local;
                 obj.Edges(kpHostTopology, local);
                 for (auto& x : local)
                     rEdges.append(x);
@@ -137,7 +137,7 @@ py::class_<CellComplex , CellComplex_Overloads , std::shared_ptr<CellComplex >
         .def(
             "Wires",
             [](const CellComplex& obj, ::TopologicCore::Topology::Ptr const& kpHostTopology, py::list& rWires) {
-                std::list<Wire::Ptr> local;
+                std::vector<Wire::Ptr> local;
                 obj.Wires(kpHostTopology, local);
                 for (auto& x : local)
                     rWires.append(x);
@@ -146,7 +146,7 @@ py::class_<CellComplex , CellComplex_Overloads , std::shared_ptr<CellComplex >
         .def(
             "Faces",
             [](const CellComplex& obj, ::TopologicCore::Topology::Ptr const& kpHostTopology, py::list& rFaces) {
-                std::list<Face::Ptr> local;
+                std::vector<Face::Ptr> local;
                 obj.Faces(kpHostTopology, local);
                 for (auto& x : local)
                     rFaces.append(x);
@@ -155,7 +155,7 @@ py::class_<CellComplex , CellComplex_Overloads , std::shared_ptr<CellComplex >
         .def(
             "Shells",
             [](const CellComplex& obj, ::TopologicCore::Topology::Ptr const& kpHostTopology, py::list& rShells) {
-                std::list<Shell::Ptr> local;
+                std::vector<Shell::Ptr> local;
                 obj.Shells(kpHostTopology, local);
                 for (auto& x : local)
                     rShells.append(x);
@@ -164,7 +164,7 @@ py::class_<CellComplex , CellComplex_Overloads , std::shared_ptr<CellComplex >
         .def(
             "Cells",
             [](const CellComplex& obj, ::TopologicCore::Topology::Ptr const& kpHostTopology, py::list& rCells) {
-                std::list<Cell::Ptr> local;
+                std::vector<Cell::Ptr> local;
                 obj.Cells(kpHostTopology, local);
                 for (auto& x : local)
                     rCells.append(x);
@@ -173,7 +173,7 @@ py::class_<CellComplex , CellComplex_Overloads , std::shared_ptr<CellComplex >
         .def(
             "CellComplexes",
             [](const CellComplex& obj, ::TopologicCore::Topology::Ptr const& kpHostTopology, py::list& rCellComplexes) {
-                std::list<CellComplex::Ptr> local;
+                std::vector<CellComplex::Ptr> local;
                 obj.CellComplexes(kpHostTopology, local);
                 for (auto& x : local)
                     rCellComplexes.append(x);
@@ -189,8 +189,8 @@ py::class_<CellComplex , CellComplex_Overloads , std::shared_ptr<CellComplex >
             " " , py::arg("rkOcctSolids") )
         .def_static(
             "ByFaces", 
-            (::std::shared_ptr<TopologicCore::CellComplex>(*)(::std::list<std::shared_ptr<TopologicCore::Face>, std::allocator<std::shared_ptr<TopologicCore::Face>>> const &, double const, bool const)) &CellComplex::ByFaces, 
-            " " , py::arg("rkFaces"), py::arg("kTolerance"), py::arg("kCopyAttributes") = false)
+            (::std::shared_ptr<TopologicCore::CellComplex>(*)(::std::list<std::shared_ptr<TopologicCore::Face>, std::allocator<std::shared_ptr<TopologicCore::Face>>> const &, double const, bool const, ::TopologicCore::BooleanOptions const &)) &CellComplex::ByFaces, 
+            " " , py::arg("rkFaces"), py::arg("kTolerance"), py::arg("kCopyAttributes") = false, py::arg("rkOptions") = BooleanOptions())
         .def(
             "ExternalBoundary", 
             (::std::shared_ptr<TopologicCore::Cell>(CellComplex::*)() const ) &CellComplex::ExternalBoundary, 
@@ -208,6 +208,27 @@ py::class_<CellComplex , CellComplex_Overloads , std::shared_ptr<CellComplex >
                     rInternalFaces.append(x);
             },
             " ", py::arg("rInternalFaces"))
+        .def(
+            "CellAdjacency",
+            [](const CellComplex& obj, py::list& rCells, py::list& rSharedFaces, py::list& rAdjacencyOffsets, py::list& rAdjacentCellIndices, py::list& rSharedFaceIndices) {
+                std::vector<Cell::Ptr> cells;
+                std::vector<Face::Ptr> sharedFaces;
+                std::vector<int> adjacencyOffsets;
+                std::vector<int> adjacentCellIndices;
+                std::vector<int> sharedFaceIndices;
+                obj.CellAdjacency(cells, sharedFaces, adjacencyOffsets, adjacentCellIndices, sharedFaceIndices);
+                for (auto& x : cells)
+                    rCells.append(x);
+                for (auto& x : sharedFaces)
+                    rSharedFaces.append(x);
+                for (auto& x : adjacencyOffsets)
+                    rAdjacencyOffsets.append(x);
+                for (auto& x : adjacentCellIndices)
+                    rAdjacentCellIndices.append(x);
+                for (auto& x : sharedFaceIndices)
+                    rSharedFaceIndices.append(x);
+            },
+            " ", py::arg("rCells"), py::arg("rSharedFaces"), py::arg("rAdjacencyOffsets"), py::arg("rAdjacentCellIndices"), py::arg("rSharedFaceIndices"))
         .def(
             "IsManifold", 
             (bool(CellComplex::*)(const Topology::Ptr&) const ) &CellComplex::IsManifold,
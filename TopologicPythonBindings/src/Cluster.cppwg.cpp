@@ -162,7 +162,7 @@ py::class_<Cluster , Cluster_Overloads , std::shared_ptr<Cluster >  , Topology
         .def(
             "Vertices",
             [](const Cluster& obj, ::TopologicCore::Topology::Ptr const& kpHostTopology, py::list& rVertices) {
-                std::list<Vertex::Ptr> local;
+                std::vector<Vertex::Ptr> local;
                 obj.Vertices(kpHostTopology, local);
                 for (auto& x : local)
                     rVertices.append(x);
@@ -171,7 +171,7 @@ py::class_<Cluster , Cluster_Overloads , std::shared_ptr<Cluster >  , Topology
         .def(
             "Edges",
             [](const Cluster& obj, ::TopologicCore::Topology::Ptr const& kpHostTopology, py::list& rEdges) {
-                std::list<Edge::Ptr> local;
+                std::vector<Edge::Ptr> local;
                 obj.Edges(kpHostTopology, local);
                 for (auto& x : local)
                     rEdges.append(x);
@@ -181,7 +181,7 @@ py::class_<Cluster , Cluster_Overloads , std::shared_ptr<Cluster >  , Topology
         .def(
             "Wires",
             [](const Cluster& obj, ::TopologicCore::Topology::Ptr const& kpHostTopology, py::list& rWires) {
-                std::list<Wire::Ptr> local;
+                std::vector<Wire::Ptr> local;
                 obj.Wires(kpHostTopology, local);
                 for (auto& x : local)
                     rWires.append(x);
@@ -190,7 +190,7 @@ py::class_<Cluster , Cluster_Overloads , std::shared_ptr<Cluster >  , Topology
         .def(
             "Faces",
             [](const Cluster& obj, ::TopologicCore::Topology::Ptr const& kpHostTopology, py::list& rFaces) {
-                std::list<Face::Ptr> local;
+                std::vector<Face::Ptr> local;
                 obj.Faces(kpHostTopology, local);
                 for (auto& x : local)
                     rFaces.append(x);
@@ -199,7 +199,7 @@ py::class_<Cluster , Cluster_Overloads , std::shared_ptr<Cluster >  , Topology
         .def(
             "Shells",
             [](const Cluster& obj, ::TopologicCore::Topology::Ptr const& kpHostTopology, py::list& rShells) {
-                std::list<Shell::Ptr> local;
+                std::vector<Shell::Ptr> local;
                 obj.Shells(kpHostTopology, local);
                 for (auto& x : local)
                     rShells.append(x);
@@ -208,7 +208,7 @@ py::class_<Cluster , Cluster_Overloads , std::shared_ptr<Cluster >  , Topology
         .def(
             "Cells",
             [](const Cluster& obj, ::TopologicCore::Topology::Ptr const& kpHostTopology, py::list& rCells) {
-                std::list<Cell::Ptr> local;
+                std::vector<Cell::Ptr> local;
                 obj.Cells(kpHostTopology, local);
                 for (auto& x : local)
                     rCells.append(x);
@@ -217,7 +217,7 @@ py::class_<Cluster , Cluster_Overloads , std::shared_ptr<Cluster >  , Topology
         .def(
             "CellComplexes",
             [](const Cluster& obj, ::TopologicCore::Topology::Ptr const& kpHostTopology, py::list& rCellComplexes) {
-                std::list<CellComplex::Ptr> local;
+                std::vector<CellComplex::Ptr> local;
                 obj.CellComplexes(kpHostTopology, local);
                 for (auto& x : local)
                     rCellComplexes.append(x);
@@ -142,7 +142,7 @@ py::class_<Edge , Edge_Overloads , std::shared_ptr<Edge >  , Topology  >(m, "Edg
         .def(
             "Vertices",
             [](const Edge& obj, ::TopologicCore::Topology::Ptr const& kpHostTopology, py::list& rVertices) {
-                std::list<Vertex::Ptr> local;
+                std::vector<Vertex::Ptr> local;
                 obj.Vertices(kpHostTopology, local);
                 for (auto& x : local)
                     rVertices.append(x);
@@ -151,7 +151,7 @@ py::class_<Edge , Edge_Overloads , std::shared_ptr<Edge >  , Topology  >(m, "Edg
         .def(
             "Edges",
             [](const Edge& obj, ::TopologicCore::Topology::Ptr const& kpHostTopology, py::list& rEdges) {
-                std::list<Edge::Ptr> local;
+                std::vector<Edge::Ptr> local;
                 obj.Edges(kpHostTopology, local);
                 for (auto& x : local)
                     rEdges.append(x);
@@ -161,7 +161,7 @@ py::class_<Edge , Edge_Overloads , std::shared_ptr<Edge >  , Topology  >(m, "Edg
         .def(
             "Wires",
             [](const Edge& obj, ::TopologicCore::Topology::Ptr const& kpHostTopology, py::list& rWires) {
-                std::list<Wire::Ptr> local;
+                std::vector<Wire::Ptr> local;
                 obj.Wires(kpHostTopology, local);
                 for (auto& x : local)
                     rWires.append(x);
@@ -170,7 +170,7 @@ py::class_<Edge , Edge_Overloads , std::shared_ptr<Edge >  , Topology  >(m, "Edg
         .def(
             "Faces",
             [](const Edge& obj, ::TopologicCore::Topology::Ptr const& kpHostTopology, py::list& rFaces) {
-                std::list<Face::Ptr> local;
+                std::vector<Face::Ptr> local;
                 obj.Faces(kpHostTopology, local);
                 for (auto& x : local)
                     rFaces.append(x);
@@ -179,7 +179,7 @@ py::class_<Edge , Edge_Overloads , std::shared_ptr<Edge >  , Topology  >(m, "Edg
         .def(
             "Shells",
             [](const Edge& obj, ::TopologicCore::Topology::Ptr const& kpHostTopology, py::list& rShells) {
-                std::list<Shell::Ptr> local;
+                std::vector<Shell::Ptr> local;
                 obj.Shells(kpHostTopology, local);
                 for (auto& x : local)
                     rShells.append(x);
@@ -188,7 +188,7 @@ py::class_<Edge , Edge_Overloads , std::shared_ptr<Edge >  , Topology  >(m, "Edg
         .def(
             "Cells",
             [](const Edge& obj, ::TopologicCore::Topology::Ptr const& kpHostTopology, py::list& rCells) {
-                std::list<Cell::Ptr> local;
+                std::vector<Cell::Ptr> local;
                 obj.Cells(kpHostTopology, local);
                 for (auto& x : local)
                     rCells.append(x);
@@ -197,7 +197,7 @@ py::class_<Edge , Edge_Overloads , std::shared_ptr<Edge >  , Topology  >(m, "Edg
         .def(
             "CellComplexes",
             [](const Edge& obj, ::TopologicCore::Topology::Ptr const& kpHostTopology, py::list& rCellComplexes) {
-                std::list<CellComplex::Ptr> local;
+                std::vector<CellComplex::Ptr> local;
                 obj.CellComplexes(kpHostTopology, local);
                 for (auto& x : local)
                     rCellComplexes.append(x);
@@ -0,0 +1,49 @@
+#include <pybind11/pybind11.h>
+#include <pybind11/stl.h>
+#include "wrapper_header_collection.hpp"
+
+#include "ExecutionPolicy.cppwg.hpp"
+
+namespace py = pybind11;
+PYBIND11_DECLARE_HOLDER_TYPE(T, std::shared_ptr<T>);
+
+void register_ExecutionPolicy_class(py::module &m){
+py::class_<ExecutionPolicy  , std::shared_ptr<ExecutionPolicy >   >(m, "ExecutionPolicy")
+        .def_static(
+            "GetInstance", 
+            (::TopologicCore::ExecutionPolicy &(*)()) &ExecutionPolicy::GetInstance, 
+            " " , py::return_value_policy::reference )
+        .def(
+            "SetRunParallel", 
+            (void(ExecutionPolicy::*)(bool const)) &ExecutionPolicy::SetRunParallel, 
+            " " , py::arg("kRunParallel") )
+        .def(
+            "GetRunParallel", 
+            (bool(ExecutionPolicy::*)() const ) &ExecutionPolicy::GetRunParallel, 
+            " "  )
+        .def(
+            "SetNumberOfThreads", 
+            (void(ExecutionPolicy::*)(int const)) &ExecutionPolicy::SetNumberOfThreads, 
+            " " , py::arg("kNumberOfThreads") )
+        .def(
+            "GetNumberOfThreads", 
+            (int(ExecutionPolicy::*)() const ) &ExecutionPolicy::GetNumberOfThreads, 
+            " "  )
+        .def(
+            "SetUseOcctThreads", 
+            (void(ExecutionPolicy::*)(bool const)) &ExecutionPolicy::SetUseOcctThreads, 
+            " " , py::arg("kUseOcctThreads") )
+        .def(
+            "GetUseOcctThreads", 
+            (bool(ExecutionPolicy::*)() const ) &ExecutionPolicy::GetUseOcctThreads, 
+            " "  )
+        .def(
+            "SetTrustInput", 
+            (void(ExecutionPolicy::*)(bool const)) &ExecutionPolicy::SetTrustInput, 
+            " " , py::arg("kTrustInput") )
+        .def(
+            "GetTrustInput", 
+            (bool(ExecutionPolicy::*)() const ) &ExecutionPolicy::GetTrustInput, 
+            " "  )
+    ;
+}
@@ -127,7 +127,7 @@ py::class_<Face , Face_Overloads , std::shared_ptr<Face >  , Topology  >(m, "Fac
         .def(
             "Vertices",
             [](const Face& obj, ::TopologicCore::Topology::Ptr const& kpHostTopology, py::list& rVertices) {
-                std::list<Vertex::Ptr> local;
+                std::vector<Vertex::Ptr> local;
                 obj.Vertices(kpHostTopology, local);
                 for (auto& x : local)
                     rVertices.append(x);
@@ -136,7 +136,7 @@ py::class_<Face , Face_Overloads , std::shared_ptr<Face >  , Topology  >(m, "Fac
         .def(
             "Edges",
             [](const Face& obj, ::TopologicCore::Topology::Ptr const& kpHostTopology, py::list& rEdges) {
-                std::list<Edge::Ptr> local;
+                std::vector<Edge::Ptr> local;
                 obj.Edges(kpHostTopology, local);
                 for (auto& x : local)
                     rEdges.append(x);
@@ -146,7 +146,7 @@ py::class_<Face , Face_Overloads , std::shared_ptr<Face >  , Topology  >(m, "Fac
         .def(
             "Wires",
             [](const Face& obj, ::TopologicCore::Topology::Ptr const& kpHostTopology, py::list& rWires) {
-                std::list<Wire::Ptr> local;
+                std::vector<Wire::Ptr> local;
                 obj.Wires(kpHostTopology, local);
                 for (auto& x : local)
                     rWires.append(x);
@@ -155,7 +155,7 @@ py::class_<Face , Face_Overloads , std::shared_ptr<Face >  , Topology  >(m, "Fac
         .def(
             "Faces",
             [](const Face& obj, ::TopologicCore::Topology::Ptr const& kpHostTopology, py::list& rFaces) {
-                std::list<Face::Ptr> local;
+                std::vector<Face::Ptr> local;
                 obj.Faces(kpHostTopology, local);
                 for (auto& x : local)
                     rFaces.append(x);
@@ -164,7 +164,7 @@ py::class_<Face , Face_Overloads , std::shared_ptr<Face >  , Topology  >(m, "Fac
         .def(
             "Shells",
             [](const Face& obj, ::TopologicCore::Topology::Ptr const& kpHostTopology, py::list& rShells) {
-                std::list<Shell::Ptr> local;
+                std::vector<Shell::Ptr> local;
                 obj.Shells(kpHostTopology, local);
                 for (auto& x : local)
                     rShells.append(x);
@@ -173,7 +173,7 @@ py::class_<Face , Face_Overloads , std::shared_ptr<Face >  , Topology  >(m, "Fac
         .def(
             "Cells",
             [](const Face& obj, ::TopologicCore::Topology::Ptr const& kpHostTopology, py::list& rCells) {
-                std::list<Cell::Ptr> local;
+                std::vector<Cell::Ptr> local;
                 obj.Cells(kpHostTopology, local);
                 for (auto& x : local)
                     rCells.append(x);
@@ -182,7 +182,7 @@ py::class_<Face , Face_Overloads , std::shared_ptr<Face >  , Topology  >(m, "Fac
         .def(
             "CellComplexes",
             [](const Face& obj, ::TopologicCore::Topology::Ptr const& kpHostTopology, py::list& rCellComplexes) {
-                std::list<CellComplex::Ptr> local;
+                std::vector<CellComplex::Ptr> local;
                 obj.CellComplexes(kpHostTopology, local);
                 for (auto& x : local)
                     rCellComplexes.append(x);
@@ -101,7 +101,7 @@ void register_FaceUtility_class(py::module& m) {
             [](const TopologicCore::Face::Ptr& kpFace, const double kDeflection, 
                 py::list& rTriangles)
             {
-                std::list<TopologicCore::Face::Ptr> rTrianglesLocal;
+                std::vector<TopologicCore::Face::Ptr> rTrianglesLocal;
                 FaceUtility::Triangulate(kpFace, kDeflection, rTrianglesLocal);
                 for (auto& x : rTrianglesLocal)
                     rTriangles.append(x);
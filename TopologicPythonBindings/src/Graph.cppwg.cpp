@@ -1,4 +1,5 @@
 #include <pybind11/pybind11.h>
+#include <pybind11/numpy.h>
 #include <pybind11/stl.h>
 #include "wrapper_header_collection.hpp"
 
@@ -8,6 +9,16 @@ namespace py = pybind11;
 //typedef TopologicCore::Graph Graph;
 PYBIND11_DECLARE_HOLDER_TYPE(T, std::shared_ptr<T>);
 
+// Hands a row-major matrix over to a NumPy array without copying it.
+template <typename T>
+py::array MatrixToNumPy(std::vector<T>&& rValues, const size_t kNumOfColumns)
+{
+    std::vector<T>* pValues = new std::vector<T>(std::move(rValues));
+    py::capsule owner(pValues, [](void* p) { delete reinterpret_cast<std::vector<T>*>(p); });
+    size_t numOfRows = kNumOfColumns == 0 ? 0 : pValues->size() / kNumOfColumns;
+    return py::array_t<T>({ numOfRows, kNumOfColumns }, pValues->data(), owner);
+}
+
 void register_Graph_class(py::module &m){
 py::class_<Graph  , std::shared_ptr<Graph >   >(m, "Graph")
         .def(py::init<::std::list<std::shared_ptr<TopologicCore::Vertex>, std::allocator<std::shared_ptr<TopologicCore::Vertex>>> const &, ::std::list<std::shared_ptr<TopologicCore::Edge>, std::allocator<std::shared_ptr<TopologicCore::Edge>>> const & >(), py::arg("rkVertices"), py::arg("rkEdges"))
@@ -18,8 +29,8 @@ py::class_<Graph  , std::shared_ptr<Graph >   >(m, "Graph")
             " " , py::arg("rkVertices"), py::arg("rkEdges") )
         .def_static(
             "ByTopology", 
-            (::TopologicCore::Graph::Ptr(*)(::TopologicCore::Topology::Ptr const, bool const, bool const, bool const, bool const, bool const, bool const, double const)) &Graph::ByTopology, 
-            " " , py::arg("topology"), py::arg("kDirect"), py::arg("kViaSharedTopologies"), py::arg("kViaSharedApertures"), py::arg("kToExteriorTopologies"), py::arg("kToExteriorApertures"), py::arg("useFaceInternalVertex"), py::arg("kTolerance") )
+            (::TopologicCore::Graph::Ptr(*)(::TopologicCore::Topology::Ptr const, bool const, bool const, bool const, bool const, bool const, bool const, double const, ::TopologicCore::ProgressMonitor::Ptr const&)) &Graph::ByTopology, 
+            " " , py::arg("topology"), py::arg("kDirect"), py::arg("kViaSharedTopologies"), py::arg("kViaSharedApertures"), py::arg("kToExteriorTopologies"), py::arg("kToExteriorApertures"), py::arg("useFaceInternalVertex"), py::arg("kTolerance"), py::arg("kpProgressMonitor") = nullptr )
         .def(
             "Topology", 
             (::TopologicCore::Topology::Ptr(Graph::*)() const ) &Graph::Topology, 
@@ -28,10 +39,18 @@ py::class_<Graph  , std::shared_ptr<Graph >   >(m, "Graph")
             "Vertices", 
             (void(Graph::*)(::std::list<std::shared_ptr<TopologicCore::Vertex>, std::allocator<std::shared_ptr<TopologicCore::Vertex>>> &) const ) &Graph::Vertices, 
             " " , py::arg("rVertices") )*/
+        .def(
+            "NumberOfVertices",
+            (int(Graph::*)() const ) &Graph::NumberOfVertices,
+            " "  )
+        .def(
+            "NumberOfEdges",
+            (int(Graph::*)() const ) &Graph::NumberOfEdges,
+            " "  )
         .def(
             "Vertices",
             [](const Graph& obj, py::list& rVertices) {
-                std::list<Vertex::Ptr> local;
+                std::vector<Vertex::Ptr> local;
                 obj.Vertices(local);
                 for (auto& x : local)
                     rVertices.append(x);
@@ -44,7 +63,7 @@ py::class_<Graph  , std::shared_ptr<Graph >   >(m, "Graph")
         .def(
             "Edges",
             [](const Graph& obj, py::list& rEdges, double const kTolerance) {
-                std::list<Edge::Ptr> local;
+                std::vector<Edge::Ptr> local;
                 obj.Edges(local, kTolerance);
                 for (auto& x : local)
                     rEdges.append(x);
@@ -57,8 +76,9 @@ py::class_<Graph  , std::shared_ptr<Graph >   >(m, "Graph")
         .def(
             "Edges",
             [](const Graph& obj, ::std::list<std::shared_ptr<TopologicCore::Vertex>, std::allocator<std::shared_ptr<TopologicCore::Vertex>>> const & rkVertices, double const kTolerance, py::list& rEdges) {
-                std::list<Edge::Ptr> local;
-                obj.Edges(rkVertices, kTolerance, local);
+                std::vector<Vertex::Ptr> vertices(rkVertices.begin(), rkVertices.end());
+                std::vector<Edge::Ptr> local;
+                obj.Edges(vertices, kTolerance, local);
                 for (auto& x : local)
                     rEdges.append(x);
             },
@@ -175,6 +195,16 @@ py::class_<Graph  , std::shared_ptr<Graph >   >(m, "Graph")
             "AllPaths", 
             (void(Graph::*)(::TopologicCore::Vertex::Ptr const &, ::TopologicCore::Vertex::Ptr const &, bool const, int const, ::std::chrono::system_clock::time_point const &, ::std::list<std::shared_ptr<TopologicCore::Vertex>, std::allocator<std::shared_ptr<TopologicCore::Vertex>>> &, ::std::list<std::shared_ptr<TopologicCore::Wire>, std::allocator<std::shared_ptr<TopologicCore::Wire>>> &) const ) &Graph::AllPaths, 
             " " , py::arg("kpStartVertex"), py::arg("kpEndVertex"), py::arg("kUseTimeLimit"), py::arg("kTimeLimitInSeconds"), py::arg("rkStartingTime"), py::arg("rPath"), py::arg("rPaths") )
+        .def(
+            "AllPaths",
+            [](const Graph& obj, ::TopologicCore::Vertex::Ptr const& kpStartVertex, ::TopologicCore::Vertex::Ptr const& kpEndVertex, int const kMaxNumberOfPaths, int const kMaxNumberOfEdges, double const kTimeLimitInSeconds, py::function callback) {
+                // A callback which returns nothing continues the search.
+                return obj.AllPaths(kpStartVertex, kpEndVertex, kMaxNumberOfPaths, kMaxNumberOfEdges, kTimeLimitInSeconds, [&](const std::vector<int>& rkPathVertexIndices) {
+                    py::object result = callback(py::cast(rkPathVertexIndices));
+                    return result.is_none() || result.cast<bool>();
+                });
+            },
+            " ", py::arg("kpStartVertex"), py::arg("kpEndVertex"), py::arg("kMaxNumberOfPaths"), py::arg("kMaxNumberOfEdges"), py::arg("kTimeLimitInSeconds"), py::arg("callback"))
         .def(
             "Path", 
             (::std::shared_ptr<TopologicCore::Wire>(Graph::*)(::TopologicCore::Vertex::Ptr const &, ::TopologicCore::Vertex::Ptr const &) const ) &Graph::Path, 
@@ -208,10 +238,98 @@ py::class_<Graph  , std::shared_ptr<Graph >   >(m, "Graph")
             "ShortestPaths", 
             (void(Graph::*)(::TopoDS_Vertex const &, ::TopoDS_Vertex const &, ::std::string const &, ::std::string const &, bool const, int const, ::std::list<std::shared_ptr<TopologicCore::Wire>, std::allocator<std::shared_ptr<TopologicCore::Wire>>> &) const ) &Graph::ShortestPaths, 
             " " , py::arg("rkOcctStartVertex"), py::arg("rkOcctEndVertex"), py::arg("rkVertexKey"), py::arg("rkEdgeKey"), py::arg("kUseTimeLimit"), py::arg("kTimeLimitInSeconds"), py::arg("rPaths") )
+        .def(
+            "KShortestPaths",
+            [](const Graph& obj, ::TopologicCore::Vertex::Ptr const& kpStartVertex, ::TopologicCore::Vertex::Ptr const& kpEndVertex, ::std::string const& rkVertexKey, ::std::string const& rkEdgeKey, int const kMaxNumberOfPaths, double const kMaxCost, py::list& rPathVertexIndices, py::list& rPathCosts) {
+                std::vector<std::vector<int>> localPathVertexIndices;
+                std::vector<double> localPathCosts;
+                obj.KShortestPaths(kpStartVertex, kpEndVertex, rkVertexKey, rkEdgeKey, kMaxNumberOfPaths, kMaxCost, localPathVertexIndices, localPathCosts);
+                for (auto& x : localPathVertexIndices)
+                    rPathVertexIndices.append(py::cast(x));
+                for (auto& x : localPathCosts)
+                    rPathCosts.append(x);
+            },
+            " ", py::arg("kpStartVertex"), py::arg("kpEndVertex"), py::arg("rkVertexKey"), py::arg("rkEdgeKey"), py::arg("kMaxNumberOfPaths"), py::arg("kMaxCost"), py::arg("rPathVertexIndices"), py::arg("rPathCosts"))
+        .def(
+            "KShortestPathWires",
+            [](const Graph& obj, ::TopologicCore::Vertex::Ptr const& kpStartVertex, ::TopologicCore::Vertex::Ptr const& kpEndVertex, ::std::string const& rkVertexKey, ::std::string const& rkEdgeKey, int const kMaxNumberOfPaths, double const kMaxCost, py::list& rPaths) {
+                std::list<Wire::Ptr> local;
+                obj.KShortestPaths(kpStartVertex, kpEndVertex, rkVertexKey, rkEdgeKey, kMaxNumberOfPaths, kMaxCost, local);
+                for (auto& x : local)
+                    rPaths.append(x);
+            },
+            " ", py::arg("kpStartVertex"), py::arg("kpEndVertex"), py::arg("rkVertexKey"), py::arg("rkEdgeKey"), py::arg("kMaxNumberOfPaths"), py::arg("kMaxCost"), py::arg("rPaths"))
         .def(
             "Diameter", 
             (int(Graph::*)() const ) &Graph::Diameter, 
             " "  )
+        .def(
+            "Eccentricities",
+            [](const Graph& obj, py::list& rEccentricities, py::list& rCenterVertices) {
+                std::list<int> localEccentricities;
+                int diameter = 0, radius = 0;
+                std::list<Vertex::Ptr> localCenterVertices;
+                obj.Eccentricities(localEccentricities, diameter, radius, localCenterVertices);
+                for (auto& x : localEccentricities)
+                    rEccentricities.append(x);
+                for (auto& x : localCenterVertices)
+                    rCenterVertices.append(x);
+                return py::make_tuple(diameter, radius);
+            },
+            " ", py::arg("rEccentricities"), py::arg("rCenterVertices"))
+        .def(
+            "Radius",
+            (int(Graph::*)() const ) &Graph::Radius,
+            " "  )
+        .def(
+            "Center",
+            [](const Graph& obj, py::list& rCenterVertices) {
+                std::list<Vertex::Ptr> local;
+                obj.Center(local);
+                for (auto& x : local)
+                    rCenterVertices.append(x);
+            },
+            " ", py::arg("rCenterVertices"))
+        .def(
+            "DistanceMatrix",
+            [](const Graph& obj, ::std::list<std::shared_ptr<TopologicCore::Vertex>> const& rkSourceVertices, ::std::string const& rkVertexKey, ::std::string const& rkEdgeKey, bool const kSinglePrecision) {
+                size_t numOfVertices = (size_t)obj.NumberOfVertices();
+                if (kSinglePrecision)
+                {
+                    std::vector<float> distances;
+                    {
+                        py::gil_scoped_release release;
+                        obj.DistanceMatrix(rkSourceVertices, rkVertexKey, rkEdgeKey, distances);
+                    }
+                    return MatrixToNumPy(std::move(distances), numOfVertices);
+                }
+
+                std::vector<double> distances;
+                {
+                    py::gil_scoped_release release;
+                    obj.DistanceMatrix(rkSourceVertices, rkVertexKey, rkEdgeKey, distances);
+                }
+                return MatrixToNumPy(std::move(distances), numOfVertices);
+            },
+            " ", py::arg("rkSourceVertices"), py::arg("rkVertexKey") = "", py::arg("rkEdgeKey") = "", py::arg("kSinglePrecision") = false)
+        .def(
+            "BetweennessCentrality",
+            [](const Graph& obj, py::list& rCentralities, ::std::string const& rkVertexKey, ::std::string const& rkEdgeKey, bool const kNormalize, int const kNumberOfSamples, ::std::string const& rkDictionaryKey) {
+                std::vector<double> local;
+                obj.BetweennessCentrality(rkVertexKey, rkEdgeKey, kNormalize, kNumberOfSamples, rkDictionaryKey, local);
+                for (auto& x : local)
+                    rCentralities.append(x);
+            },
+            " ", py::arg("rCentralities"), py::arg("rkVertexKey") = "", py::arg("rkEdgeKey") = "", py::arg("kNormalize") = true, py::arg("kNumberOfSamples") = 0, py::arg("rkDictionaryKey") = "")
+        .def(
+            "ClosenessCentrality",
+            [](const Graph& obj, py::list& rCentralities, ::std::string const& rkVertexKey, ::std::string const& rkEdgeKey, ::std::string const& rkDictionaryKey) {
+                std::vector<double> local;
+                obj.ClosenessCentrality(rkVertexKey, rkEdgeKey, rkDictionaryKey, local);
+                for (auto& x : local)
+                    rCentralities.append(x);
+            },
+            " ", py::arg("rCentralities"), py::arg("rkVertexKey") = "", py::arg("rkEdgeKey") = "", py::arg("rkDictionaryKey") = "")
         .def(
             "TopologicalDistance", 
             (int(Graph::*)(::std::shared_ptr<TopologicCore::Vertex> const &, ::std::shared_ptr<TopologicCore::Vertex> const &, double const) const ) &Graph::TopologicalDistance, 
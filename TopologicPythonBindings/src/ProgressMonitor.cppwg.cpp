@@ -0,0 +1,55 @@
+#include <pybind11/pybind11.h>
+#include <pybind11/functional.h>
+#include <pybind11/stl.h>
+#include "wrapper_header_collection.hpp"
+
+#include "ProgressMonitor.cppwg.hpp"
+
+namespace py = pybind11;
+PYBIND11_DECLARE_HOLDER_TYPE(T, std::shared_ptr<T>);
+
+void register_ProgressMonitor_class(py::module &m){
+py::class_<ProgressMonitor  , std::shared_ptr<ProgressMonitor >   >(m, "ProgressMonitor")
+        .def(py::init< >())
+        .def(
+            "SetCallback",
+            [](ProgressMonitor& obj, py::object callback) {
+        if (callback.is_none())
+        {
+            obj.SetCallback(ProgressMonitor::Callback());
+            return;
+        }
+
+        // The callback is called while the operation holds the GIL. An exception raised by it cancels the operation.
+        ProgressMonitor* pMonitor = &obj;
+        py::function function = callback.cast<py::function>();
+        obj.SetCallback([function, pMonitor](const std::string& rkStage, const double kPercent) {
+            py::gil_scoped_acquire gil;
+            try {
+                function(rkStage, kPercent);
+            }
+            catch (py::error_already_set&)
+            {
+                pMonitor->Cancel();
+            }
+        });
+    },
+            " ", py::arg("callback"))
+        .def(
+            "SetTimeLimit",
+            (void(ProgressMonitor::*)(double const)) &ProgressMonitor::SetTimeLimit,
+            " " , py::arg("kSeconds") )
+        .def(
+            "Cancel",
+            (void(ProgressMonitor::*)()) &ProgressMonitor::Cancel,
+            " "  )
+        .def(
+            "Reset",
+            (void(ProgressMonitor::*)()) &ProgressMonitor::Reset,
+            " "  )
+        .def(
+            "IsCancelled",
+            (bool(ProgressMonitor::*)() const ) &ProgressMonitor::IsCancelled,
+            " "  )
+    ;
+}
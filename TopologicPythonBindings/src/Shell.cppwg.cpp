@@ -118,7 +118,7 @@ py::class_<Shell , Shell_Overloads , std::shared_ptr<Shell >  , Topology  >(m, "
         .def(
             "Vertices",
             [](const Shell& obj, ::TopologicCore::Topology::Ptr const& kpHostTopology, py::list& rVertices) {
-                std::list<Vertex::Ptr> local;
+                std::vector<Vertex::Ptr> local;
                 obj.Vertices(kpHostTopology, local);
                 for (auto& x : local)
                     rVertices.append(x);
@@ -127,7 +127,7 @@ py::class_<Shell , Shell_Overloads , std::shared_ptr<Shell >  , Topology  >(m, "
         .def(
             "Edges",
             [](const Shell& obj, ::TopologicCore::Topology::Ptr const& kpHostTopology, py::list& rEdges) {
-            std::list<Edge::Ptr> local;
+            std::vector<Edge::Ptr> local;
             obj.Edges(kpHostTopology, local);
             for (auto& x : local)
                 rEdges.append(x);
@@ -137,7 +137,7 @@ py::class_<Shell , Shell_Overloads , std::shared_ptr<Shell >  , Topology  >(m, "
         .def(
             "Wires",
             [](const Shell& obj, ::TopologicCore::Topology::Ptr const& kpHostTopology, py::list& rWires) {
-            std::list<Wire::Ptr> local;
+            std::vector<Wire::Ptr> local;
             obj.Wires(kpHostTopology, local);
             for (auto& x : local)
                 rWires.append(x);
@@ -146,7 +146,7 @@ py::class_<Shell , Shell_Overloads , std::shared_ptr<Shell >  , Topology  >(m, "
         .def(
             "Faces",
             [](const Shell& obj, ::TopologicCore::Topology::Ptr const& kpHostTopology, py::list& rFaces) {
-            std::list<Face::Ptr> local;
+            std::vector<Face::Ptr> local;
             obj.Faces(kpHostTopology, local);
             for (auto& x : local)
                 rFaces.append(x);
@@ -155,7 +155,7 @@ py::class_<Shell , Shell_Overloads , std::shared_ptr<Shell >  , Topology  >(m, "
         .def(
             "Shells",
             [](const Shell& obj, ::TopologicCore::Topology::Ptr const& kpHostTopology, py::list& rShells) {
-            std::list<Shell::Ptr> local;
+            std::vector<Shell::Ptr> local;
             obj.Shells(kpHostTopology, local);
             for (auto& x : local)
                 rShells.append(x);
@@ -164,7 +164,7 @@ py::class_<Shell , Shell_Overloads , std::shared_ptr<Shell >  , Topology  >(m, "
         .def(
             "Cells",
             [](const Shell& obj, ::TopologicCore::Topology::Ptr const& kpHostTopology, py::list& rCells) {
-            std::list<Cell::Ptr> local;
+            std::vector<Cell::Ptr> local;
             obj.Cells(kpHostTopology, local);
             for (auto& x : local)
                 rCells.append(x);
@@ -173,7 +173,7 @@ py::class_<Shell , Shell_Overloads , std::shared_ptr<Shell >  , Topology  >(m, "
         .def(
             "CellComplexes",
             [](const Shell& obj, ::TopologicCore::Topology::Ptr const& kpHostTopology, py::list& rCellComplexes) {
-            std::list<CellComplex::Ptr> local;
+            std::vector<CellComplex::Ptr> local;
             obj.CellComplexes(kpHostTopology, local);
             for (auto& x : local)
                 rCellComplexes.append(x);
@@ -174,6 +174,20 @@ void register_Topology_class(py::module& m) {
             rSharedTopologies.append(x);
     },
             " ", py::arg("kpTopology"), py::arg("kFilterType"), py::arg("rSharedTopologies"))
+        .def_static(
+            "PairwiseSharedTopologies",
+            [](::std::list<std::shared_ptr<TopologicCore::Topology>> const& rkTopologies, int const kFilterType, py::dict& rSharedTopologies) {
+        std::map<std::pair<int, int>, std::list<Topology::Ptr>> local;
+        Topology::PairwiseSharedTopologies(rkTopologies, kFilterType, local);
+        for (auto& x : local)
+        {
+            py::list sharedTopologies;
+            for (auto& y : x.second)
+                sharedTopologies.append(y);
+            rSharedTopologies[py::make_tuple(x.first.first, x.first.second)] = sharedTopologies;
+        }
+    },
+            " ", py::arg("rkTopologies"), py::arg("kFilterType"), py::arg("rSharedTopologies"))
         .def(
             "SetDictionaries",
             (::TopologicCore::Topology::Ptr(Topology::*)(::std::list<std::shared_ptr<TopologicCore::Vertex>, std::allocator<std::shared_ptr<TopologicCore::Vertex>>> const&, ::std::list<std::map<std::basic_string<char>, std::shared_ptr<TopologicCore::Attribute>, std::less<std::basic_string<char>>, std::allocator<std::pair<const std::basic_string<char>, std::shared_ptr<TopologicCore::Attribute>>>>, std::allocator<std::map<std::basic_string<char>, std::shared_ptr<TopologicCore::Attribute>, std::less<std::basic_string<char>>, std::allocator<std::pair<const std::basic_string<char>, std::shared_ptr<TopologicCore::Attribute>>>>>> const&, int const)) & Topology::SetDictionaries,
@@ -188,44 +202,60 @@ void register_Topology_class(py::module& m) {
             " ", py::arg("rkOcctFaces"), py::arg("kTolerance") = 0.001)
         .def(
             "Difference",
-            (::TopologicCore::Topology::Ptr(Topology::*)(::TopologicCore::Topology::Ptr const&, bool const)) & Topology::Difference,
-            " ", py::arg("kpOtherTopology") = nullptr, py::arg("kTransferDictionary") = false)
+            (::TopologicCore::Topology::Ptr(Topology::*)(::TopologicCore::Topology::Ptr const&, bool const, ::TopologicCore::BooleanOptions const&, std::shared_ptr<TopologicCore::BooleanHistory> const&)) & Topology::Difference,
+            " ", py::arg("kpOtherTopology") = nullptr, py::arg("kTransferDictionary") = false, py::arg("rkOptions") = BooleanOptions(), py::arg("kpHistory") = nullptr)
         .def(
             "Impose",
-            (::TopologicCore::Topology::Ptr(Topology::*)(::TopologicCore::Topology::Ptr const&, bool const)) & Topology::Impose,
-            " ", py::arg("kpTool") = nullptr, py::arg("kTransferDictionary") = false)
+            (::TopologicCore::Topology::Ptr(Topology::*)(::TopologicCore::Topology::Ptr const&, bool const, ::TopologicCore::BooleanOptions const&, std::shared_ptr<TopologicCore::BooleanHistory> const&)) & Topology::Impose,
+            " ", py::arg("kpTool") = nullptr, py::arg("kTransferDictionary") = false, py::arg("rkOptions") = BooleanOptions(), py::arg("kpHistory") = nullptr)
         .def(
             "Imprint",
-            (::TopologicCore::Topology::Ptr(Topology::*)(::TopologicCore::Topology::Ptr const&, bool const)) & Topology::Imprint,
-            " ", py::arg("kpTool") = nullptr, py::arg("kTransferDictionary") = false)
+            (::TopologicCore::Topology::Ptr(Topology::*)(::TopologicCore::Topology::Ptr const&, bool const, ::TopologicCore::BooleanOptions const&, std::shared_ptr<TopologicCore::BooleanHistory> const&)) & Topology::Imprint,
+            " ", py::arg("kpTool") = nullptr, py::arg("kTransferDictionary") = false, py::arg("rkOptions") = BooleanOptions(), py::arg("kpHistory") = nullptr)
         .def(
             "Intersect",
-            (::TopologicCore::Topology::Ptr(Topology::*)(::TopologicCore::Topology::Ptr const&, bool const)) & Topology::Intersect,
-            " ", py::arg("kpOtherTopology") = nullptr, py::arg("kTransferDictionary") = false)
+            (::TopologicCore::Topology::Ptr(Topology::*)(::TopologicCore::Topology::Ptr const&, bool const, ::TopologicCore::BooleanOptions const&, std::shared_ptr<TopologicCore::BooleanHistory> const&)) & Topology::Intersect,
+            " ", py::arg("kpOtherTopology") = nullptr, py::arg("kTransferDictionary") = false, py::arg("rkOptions") = BooleanOptions(), py::arg("kpHistory") = nullptr)
         .def(
             "Merge",
-            (::TopologicCore::Topology::Ptr(Topology::*)(::TopologicCore::Topology::Ptr const&, bool const)) & Topology::Merge,
-            " ", py::arg("kpOtherTopology") = nullptr, py::arg("kTransferDictionary") = false)
+            (::TopologicCore::Topology::Ptr(Topology::*)(::TopologicCore::Topology::Ptr const&, bool const, ::TopologicCore::BooleanOptions const&, std::shared_ptr<TopologicCore::BooleanHistory> const&)) & Topology::Merge,
+            " ", py::arg("kpOtherTopology") = nullptr, py::arg("kTransferDictionary") = false, py::arg("rkOptions") = BooleanOptions(), py::arg("kpHistory") = nullptr)
         .def(
             "SelfMerge",
-            (::TopologicCore::Topology::Ptr(Topology::*)()) & Topology::SelfMerge,
-            " ")
+            (::TopologicCore::Topology::Ptr(Topology::*)(::TopologicCore::BooleanOptions const&)) & Topology::SelfMerge,
+            " ", py::arg("rkOptions") = BooleanOptions())
         .def(
             "Slice",
-            (::TopologicCore::Topology::Ptr(Topology::*)(::TopologicCore::Topology::Ptr const&, bool const)) & Topology::Slice,
-            " ", py::arg("kpTool") = nullptr, py::arg("kTransferDictionary") = false)
+            (::TopologicCore::Topology::Ptr(Topology::*)(::TopologicCore::Topology::Ptr const&, bool const, ::TopologicCore::BooleanOptions const&, std::shared_ptr<TopologicCore::BooleanHistory> const&)) & Topology::Slice,
+            " ", py::arg("kpTool") = nullptr, py::arg("kTransferDictionary") = false, py::arg("rkOptions") = BooleanOptions(), py::arg("kpHistory") = nullptr)
         .def(
             "Union",
-            (::TopologicCore::Topology::Ptr(Topology::*)(::TopologicCore::Topology::Ptr const&, bool const)) & Topology::Union,
-            " ", py::arg("kpOtherTopology") = nullptr, py::arg("kTransferDictionary") = false)
+            (::TopologicCore::Topology::Ptr(Topology::*)(::TopologicCore::Topology::Ptr const&, bool const, ::TopologicCore::BooleanOptions const&, std::shared_ptr<TopologicCore::BooleanHistory> const&)) & Topology::Union,
+            " ", py::arg("kpOtherTopology") = nullptr, py::arg("kTransferDictionary") = false, py::arg("rkOptions") = BooleanOptions(), py::arg("kpHistory") = nullptr)
         .def(
             "XOR",
-            (::TopologicCore::Topology::Ptr(Topology::*)(::TopologicCore::Topology::Ptr const&, bool const)) & Topology::XOR,
-            " ", py::arg("kpOtherTopology") = nullptr, py::arg("kTransferDictionary") = false)
+            (::TopologicCore::Topology::Ptr(Topology::*)(::TopologicCore::Topology::Ptr const&, bool const, ::TopologicCore::BooleanOptions const&, std::shared_ptr<TopologicCore::BooleanHistory> const&)) & Topology::XOR,
+            " ", py::arg("kpOtherTopology") = nullptr, py::arg("kTransferDictionary") = false, py::arg("rkOptions") = BooleanOptions(), py::arg("kpHistory") = nullptr)
         .def(
             "Divide",
-            (::TopologicCore::Topology::Ptr(Topology::*)(::TopologicCore::Topology::Ptr const&, bool const)) & Topology::Divide,
-            " ", py::arg("kpTool") = nullptr, py::arg("kTransferDictionary") = false)
+            (::TopologicCore::Topology::Ptr(Topology::*)(::TopologicCore::Topology::Ptr const&, bool const, ::TopologicCore::BooleanOptions const&)) & Topology::Divide,
+            " ", py::arg("kpTool") = nullptr, py::arg("kTransferDictionary") = false, py::arg("rkOptions") = BooleanOptions())
+        .def_static(
+            "MergeMany",
+            (::TopologicCore::Topology::Ptr(*)(::std::list<std::shared_ptr<TopologicCore::Topology>> const&, bool const, ::TopologicCore::BooleanOptions const&)) & Topology::MergeMany,
+            " ", py::arg("rkTopologies"), py::arg("kTransferDictionary") = false, py::arg("rkOptions") = BooleanOptions())
+        .def_static(
+            "UnionMany",
+            (::TopologicCore::Topology::Ptr(*)(::std::list<std::shared_ptr<TopologicCore::Topology>> const&, bool const, ::TopologicCore::BooleanOptions const&)) & Topology::UnionMany,
+            " ", py::arg("rkTopologies"), py::arg("kTransferDictionary") = false, py::arg("rkOptions") = BooleanOptions())
+        .def_static(
+            "ImposeMany",
+            (::TopologicCore::Topology::Ptr(*)(::std::list<std::shared_ptr<TopologicCore::Topology>> const&, bool const, ::TopologicCore::BooleanOptions const&)) & Topology::ImposeMany,
+            " ", py::arg("rkTopologies"), py::arg("kTransferDictionary") = false, py::arg("rkOptions") = BooleanOptions())
+        .def_static(
+            "SliceMany",
+            (::TopologicCore::Topology::Ptr(*)(::std::list<std::shared_ptr<TopologicCore::Topology>> const&, bool const, ::TopologicCore::BooleanOptions const&)) & Topology::SliceMany,
+            " ", py::arg("rkTopologies"), py::arg("kTransferDictionary") = false, py::arg("rkOptions") = BooleanOptions())
         .def_static(
             "TransferContents",
             (void(*)(::TopoDS_Shape const&, ::TopologicCore::Topology::Ptr const&)) & Topology::TransferContents,
@@ -326,6 +356,20 @@ void register_Topology_class(py::module& m) {
             "Analyze",
             (::std::string(Topology::*)()) & Topology::Analyze,
             " ")
+        .def(
+            "IsValid",
+            (bool(Topology::*)() const) & Topology::IsValid,
+            " ")
+        .def_static(
+            "Validate",
+            [](::std::list<std::shared_ptr<TopologicCore::Topology>> const& rkTopologies, py::list& rInvalidTopologies) {
+        std::list<Topology::Ptr> local;
+        bool isValid = Topology::Validate(rkTopologies, local);
+        for (auto& x : local)
+            rInvalidTopologies.append(x);
+        return isValid;
+    },
+            " ", py::arg("rkTopologies"), py::arg("rInvalidTopologies"))
         .def(
             "Dimensionality",
             (int(Topology::*)() const) & Topology::Dimensionality,
@@ -390,7 +434,7 @@ void register_Topology_class(py::module& m) {
         .def(
             "CellComplexes",
             [](const Topology& obj, ::TopologicCore::Topology::Ptr const& kpHostTopology, py::list& rCellComplexes) {
-        std::list<CellComplex::Ptr> local;
+        std::vector<CellComplex::Ptr> local;
         obj.CellComplexes(kpHostTopology, local);
         for (auto& x : local)
             rCellComplexes.append(x);
@@ -400,7 +444,7 @@ void register_Topology_class(py::module& m) {
         .def(
             "Shells",
             [](const Topology& obj, ::TopologicCore::Topology::Ptr const& kpHostTopology, py::list& rShells) {
-        std::list<Shell::Ptr> local;
+        std::vector<Shell::Ptr> local;
         obj.Shells(kpHostTopology, local);
         for (auto& x : local)
             rShells.append(x);
@@ -410,7 +454,7 @@ void register_Topology_class(py::module& m) {
         .def(
             "Edges",
             [](const Topology& obj, ::TopologicCore::Topology::Ptr const& kpHostTopology, py::list& rEdges) {
-        std::list<Edge::Ptr> local;
+        std::vector<Edge::Ptr> local;
         obj.Edges(kpHostTopology, local);
         for (auto& x : local)
             rEdges.append(x);
@@ -420,7 +464,7 @@ void register_Topology_class(py::module& m) {
         .def(
             "Faces",
             [](const Topology& obj, ::TopologicCore::Topology::Ptr const& kpHostTopology, py::list& rFaces) {
-        std::list<Face::Ptr> local;
+        std::vector<Face::Ptr> local;
         obj.Faces(kpHostTopology, local);
         for (auto& x : local)
             rFaces.append(x);
@@ -430,7 +474,7 @@ void register_Topology_class(py::module& m) {
         .def(
             "Vertices",
             [](const Topology& obj, ::TopologicCore::Topology::Ptr const& kpHostTopology, py::list& rVertices) {
-        std::list<Vertex::Ptr> local;
+        std::vector<Vertex::Ptr> local;
         obj.Vertices(kpHostTopology, local);
         for (auto& x : local)
             rVertices.append(x);
@@ -440,7 +484,7 @@ void register_Topology_class(py::module& m) {
         .def(
             "Wires",
             [](const Topology& obj, ::TopologicCore::Topology::Ptr const& kpHostTopology, py::list& rWires) {
-        std::list<Wire::Ptr> local;
+        std::vector<Wire::Ptr> local;
         obj.Wires(kpHostTopology, local);
         for (auto& x : local)
             rWires.append(x);
@@ -450,7 +494,7 @@ void register_Topology_class(py::module& m) {
         .def(
             "Cells",
             [](const Topology& obj, ::TopologicCore::Topology::Ptr const& kpHostTopology, py::list& rCells) {
-        std::list<Cell::Ptr> local;
+        std::vector<Cell::Ptr> local;
         obj.Cells(kpHostTopology, local);
         for (auto& x : local)
             rCells.append(x);
@@ -489,6 +533,10 @@ void register_Topology_class(py::module& m) {
             "IsSame",
             (bool(Topology::*)(::TopologicCore::Topology::Ptr const&) const) & Topology::IsSame,
             " ", py::arg("kpTopology"))
+        .def(
+            "GetModificationStamp",
+            (unsigned long long(Topology::*)() const) & Topology::GetModificationStamp,
+            " ")
         .def(
             "Members",
             (void(Topology::*)(::TopTools_ListOfShape&) const) & Topology::Members,
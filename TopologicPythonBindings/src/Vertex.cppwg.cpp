@@ -144,7 +144,7 @@ py::class_<Vertex , Vertex_Overloads , std::shared_ptr<Vertex >  , Topology  >(m
         .def(
             "Vertices",
             [](const Vertex& obj, ::TopologicCore::Topology::Ptr const& kpHostTopology, py::list& rVertices) {
-                    std::list<Vertex::Ptr> local;
+                    std::vector<Vertex::Ptr> local;
                     obj.Vertices(kpHostTopology, local);
                     for (auto& x : local)
                         rVertices.append(x);
@@ -153,7 +153,7 @@ py::class_<Vertex , Vertex_Overloads , std::shared_ptr<Vertex >  , Topology  >(m
         .def(
             "Edges",
             [](const Vertex& obj, ::TopologicCore::Topology::Ptr const& kpHostTopology, py::list& rEdges) {
-                std::list<Edge::Ptr> local;
+                std::vector<Edge::Ptr> local;
                 obj.Edges(kpHostTopology, local);
                 for (auto& x : local)
                     rEdges.append(x);
@@ -163,7 +163,7 @@ py::class_<Vertex , Vertex_Overloads , std::shared_ptr<Vertex >  , Topology  >(m
         .def(
             "Wires",
             [](const Vertex& obj, ::TopologicCore::Topology::Ptr const& kpHostTopology, py::list& rWires) {
-                std::list<Wire::Ptr> local;
+                std::vector<Wire::Ptr> local;
                 obj.Wires(kpHostTopology, local);
                 for (auto& x : local)
                     rWires.append(x);
@@ -172,7 +172,7 @@ py::class_<Vertex , Vertex_Overloads , std::shared_ptr<Vertex >  , Topology  >(m
         .def(
             "Faces",
             [](const Vertex& obj, ::TopologicCore::Topology::Ptr const& kpHostTopology, py::list& rFaces) {
-                std::list<Face::Ptr> local;
+                std::vector<Face::Ptr> local;
                 obj.Faces(kpHostTopology, local);
                 for (auto& x : local)
                     rFaces.append(x);
@@ -181,7 +181,7 @@ py::class_<Vertex , Vertex_Overloads , std::shared_ptr<Vertex >  , Topology  >(m
         .def(
             "Shells",
             [](const Vertex& obj, ::TopologicCore::Topology::Ptr const& kpHostTopology, py::list& rShells) {
-                std::list<Shell::Ptr> local;
+                std::vector<Shell::Ptr> local;
                 obj.Shells(kpHostTopology, local);
                 for (auto& x : local)
                     rShells.append(x);
@@ -190,7 +190,7 @@ py::class_<Vertex , Vertex_Overloads , std::shared_ptr<Vertex >  , Topology  >(m
         .def(
             "Cells",
             [](const Vertex& obj, ::TopologicCore::Topology::Ptr const& kpHostTopology, py::list& rCells) {
-                std::list<Cell::Ptr> local;
+                std::vector<Cell::Ptr> local;
                 obj.Cells(kpHostTopology, local);
                 for (auto& x : local)
                     rCells.append(x);
@@ -199,7 +199,7 @@ py::class_<Vertex , Vertex_Overloads , std::shared_ptr<Vertex >  , Topology  >(m
         .def(
             "CellComplexes",
             [](const Vertex& obj, ::TopologicCore::Topology::Ptr const& kpHostTopology, py::list& rCellComplexes) {
-                std::list<CellComplex::Ptr> local;
+                std::vector<CellComplex::Ptr> local;
                 obj.CellComplexes(kpHostTopology, local);
                 for (auto& x : local)
                     rCellComplexes.append(x);
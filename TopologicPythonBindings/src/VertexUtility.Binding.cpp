@@ -14,7 +14,7 @@ void register_VertexUtility_class(py::module& m) {
             "AdjacentEdges",
             [](const TopologicCore::Vertex::Ptr& kpVertex, const TopologicCore::Topology::Ptr& kpParentTopology, py::list& rCoreAdjacentEdges)
             {
-                std::list<TopologicCore::Edge::Ptr> rCoreAdjacentEdgesLocal;
+                std::vector<TopologicCore::Edge::Ptr> rCoreAdjacentEdgesLocal;
                 VertexUtility::AdjacentEdges(
                     kpVertex, kpParentTopology.get(), rCoreAdjacentEdgesLocal);
                 for (auto& x : rCoreAdjacentEdgesLocal)
@@ -25,7 +25,7 @@ void register_VertexUtility_class(py::module& m) {
             "AdjacentEdges",
             [](const TopologicCore::Vertex::Ptr& kpVertex, TopologicCore::Topology const* const kpkParentTopology, py::list& rCoreAdjacentEdges)
             {
-                std::list<TopologicCore::Edge::Ptr> rCoreAdjacentEdgesLocal;
+                std::vector<TopologicCore::Edge::Ptr> rCoreAdjacentEdgesLocal;
                 VertexUtility::AdjacentEdges(
                     kpVertex, kpkParentTopology, rCoreAdjacentEdgesLocal);
                 for (auto& x : rCoreAdjacentEdgesLocal)
@@ -128,7 +128,7 @@ py::class_<Wire , Wire_Overloads , std::shared_ptr<Wire >  , Topology  >(m, "Wir
         .def(
             "Edges",
             [](const Wire& obj, const TopologicCore::Topology::Ptr& kpHostTopology, py::list& rEdges) {
-                std::list<Edge::Ptr> local;
+                std::vector<Edge::Ptr> local;
                 obj.Edges(kpHostTopology, local);
                 for (auto& x : local)
                     rEdges.append(x);
@@ -154,7 +154,7 @@ py::class_<Wire , Wire_Overloads , std::shared_ptr<Wire >  , Topology  >(m, "Wir
         .def(
             "Vertices",
             [](const Wire& obj, const TopologicCore::Topology::Ptr& kpHostTopology, py::list& rVertices) {
-                std::list<Vertex::Ptr> local;
+                std::vector<Vertex::Ptr> local;
                 obj.Vertices(kpHostTopology, local);
                 for (auto& x : local)
                     rVertices.append(x);
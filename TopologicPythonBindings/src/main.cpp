@@ -17,6 +17,11 @@ namespace py = pybind11;
 #include "Dictionary.cppwg.hpp"
 #include "Shell.cppwg.hpp"
 #include "ContentManager.cppwg.hpp"
+#include "ExecutionPolicy.cppwg.hpp"
+#include "BooleanOptions.cppwg.hpp"
+#include "BooleanSession.cppwg.hpp"
+#include "BooleanHistory.cppwg.hpp"
+#include "ProgressMonitor.cppwg.hpp"
 #include "Context.cppwg.hpp"
 #include "IntAttribute.cppwg.hpp"
 #include "DoubleAttribute.cppwg.hpp"
@@ -34,6 +39,8 @@ PYBIND11_MODULE(topologic_core, m)
 {
     register_TopoDS_Shape_class(m);
     register_TopologicalQuery_class(m);
+    register_ProgressMonitor_class(m);
+    register_BooleanOptions_class(m);
     register_Topology_class(m);
     register_Vertex_class(m);
     register_Edge_class(m);
@@ -48,6 +55,9 @@ PYBIND11_MODULE(topologic_core, m)
     register_Dictionary_class(m);
     register_Shell_class(m);
     register_ContentManager_class(m);
+    register_ExecutionPolicy_class(m);
+    register_BooleanSession_class(m);
+    register_BooleanHistory_class(m);
     register_Context_class(m);
     register_IntAttribute_class(m);
     register_DoubleAttribute_class(m);
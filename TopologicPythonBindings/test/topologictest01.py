@@ -6,7 +6,7 @@ release = os.path.join(home, "topologicbim", "Topologic", "output", "x64", "Rele
 print(release)
 sys.path.append(release) ; sys.path.append(".")
 
-from topologic_core import Vertex, Edge, Wire, Face, Shell, Cell, CellComplex, Cluster, Aperture, Dictionary, Topology
+from topologic_core import Vertex, Edge, Wire, Face, Shell, Cell, CellComplex, Cluster, Aperture, Dictionary, Topology, ExecutionPolicy, BooleanSession, BooleanOptions, GlueMode, TopologyUtility, BooleanHistory, ProgressMonitor, Graph
 
 # Check
 if str(type(Vertex.ByCoordinates(10,20,30))) != "<class 'topologic_core.Vertex'>":
@@ -169,4 +169,271 @@ path = os.path.join(home, "CellComplex.brep")
 cc1.ExportToBRep(path, 3)
 print("BREP file exported to: "+path)
 print("Done")
+
+# Test the Cell adjacency of the CellComplex
+print("Testing CellComplex Cell adjacency...")
+cells = []
+sharedFaces = []
+offsets = []
+adjacentCells = []
+sharedFaceIndices = []
+cc1.CellAdjacency(cells, sharedFaces, offsets, adjacentCells, sharedFaceIndices)
+if len(cells) != 2 or len(sharedFaces) != 1 or offsets != [0, 1, 2] or adjacentCells != [1, 0] or sharedFaceIndices != [0, 0]:
+    print("Test failed! Unexpected Cell adjacency.")
+    sys.exit(1)
+print("Done")
+# Test the shared Faces of the Cells of the CellComplex
+print("Testing shared Faces...")
+sharedFaces = []
+cells[0].SharedFaces(cells[1], sharedFaces)
+pairwiseSharedFaces = {}
+Topology.PairwiseSharedTopologies(cells, 8, pairwiseSharedFaces)
+if len(sharedFaces) != 1 or list(pairwiseSharedFaces.keys()) != [(0, 1)] or len(pairwiseSharedFaces[(0, 1)]) != 1:
+    print("Test failed! Unexpected shared Faces.")
+    sys.exit(1)
+print("Done")
+# Test the CellComplexes of a Cell
+print("Testing the CellComplexes of a Cell...")
+hostCellComplexes = []
+cells[0].CellComplexes(cc1, hostCellComplexes)
+noHostCellComplexes = []
+cells[0].CellComplexes(None, noHostCellComplexes)
+if len(hostCellComplexes) != 1 or len(noHostCellComplexes) != 0:
+    print("Test failed! Unexpected CellComplexes of a Cell.")
+    sys.exit(1)
+print("Done")
+# Test the modification stamps and the shared Topologies of an edited Cluster
+print("Testing the modification stamps...")
+cellFaces = []
+cells[0].Faces(None, cellFaces)
+unsharedFaces = [face for face in cellFaces if not face.IsSame(sharedFaces[0])]
+editedCluster = Cluster.ByTopologies([unsharedFaces[0]])
+sharedFacesBefore = []
+editedCluster.SharedTopologies(cells[1], 8, sharedFacesBefore)
+stampBefore = editedCluster.GetModificationStamp()
+editedCluster.AddTopology(sharedFaces[0])
+sharedFacesAfter = []
+editedCluster.SharedTopologies(cells[1], 8, sharedFacesAfter)
+if editedCluster.GetModificationStamp() <= stampBefore or len(sharedFacesBefore) != 0 or len(sharedFacesAfter) != 1:
+    print("Test failed! Unexpected modification stamp or shared Faces after editing a Cluster.")
+    sys.exit(1)
+print("Done")
+# Test the parallel execution policy
+print("Testing parallel Merge...")
+policy = ExecutionPolicy.GetInstance()
+policy.SetRunParallel(True)
+policy.SetNumberOfThreads(2)
+usedOcctThreads = policy.GetUseOcctThreads() and policy.GetNumberOfThreads() == 2
+cc2 = cellComplexByCells([c1, c2])
+policy.SetRunParallel(False)
+policy.SetNumberOfThreads(0)
+policy.SetUseOcctThreads(False)
+cc2Cells = []
+cc2.Cells(None, cc2Cells)
+if ExecutionPolicy.GetInstance().GetRunParallel() or not usedOcctThreads or len(cc2Cells) != 2:
+    print("Test failed! Unexpected parallel Merge result.")
+    sys.exit(1)
+print("Done")
+# Test the n-ary Boolean operations
+print("Testing MergeMany and UnionMany...")
+merged = fixTopologyClass(Topology.MergeMany([c1, c2], False))
+mergedCells = []
+merged.Cells(None, mergedCells)
+united = fixTopologyClass(Topology.UnionMany([c1, c2], False))
+unitedCells = []
+united.Cells(None, unitedCells)
+if len(mergedCells) != 2 or len(unitedCells) != 1:
+    print("Test failed! Unexpected MergeMany or UnionMany result.")
+    sys.exit(1)
+print("Done")
+# Test the Boolean session
+print("Testing BooleanSession...")
+session = BooleanSession(c1, c2)
+sessionMerged = fixTopologyClass(session.Merge(False))
+sessionMergedCells = []
+sessionMerged.Cells(None, sessionMergedCells)
+sessionUnited = fixTopologyClass(session.Union(False))
+sessionUnitedCells = []
+sessionUnited.Cells(None, sessionUnitedCells)
+if len(sessionMergedCells) != 2 or len(sessionUnitedCells) != 1:
+    print("Test failed! Unexpected BooleanSession result.")
+    sys.exit(1)
+print("Done")
+# Test the Boolean options
+print("Testing Merge with BooleanOptions...")
+options = BooleanOptions()
+options.glue = GlueMode.GlueShift
+options.fuzzyValue = 0.0001
+glued = fixTopologyClass(c1.Merge(c2, False, options))
+gluedCells = []
+glued.Cells(None, gluedCells)
+if len(gluedCells) != 2:
+    print("Test failed! Unexpected glued Merge result.")
+    sys.exit(1)
+print("Done")
+# Test the bounding box prefilter of the Boolean operations
+print("Testing Merge and Intersect with a distant Cell...")
+c3 = fixTopologyClass(TopologyUtility.Translate(c1, 100, 0, 0))
+prefilteredOptions = BooleanOptions()
+prefilteredOptions.prefilter = True
+prefiltered = fixTopologyClass(cc1.Merge(c3, False, prefilteredOptions))
+prefilteredCells = []
+prefiltered.Cells(None, prefilteredCells)
+prefilteredFaces = []
+prefiltered.Faces(None, prefilteredFaces)
+unfiltered = fixTopologyClass(cc1.Merge(c3, False))
+unfilteredCells = []
+unfiltered.Cells(None, unfilteredCells)
+unfilteredFaces = []
+unfiltered.Faces(None, unfilteredFaces)
+if BooleanOptions().prefilter or len(prefilteredCells) != 3 or len(unfilteredCells) != 3 or len(prefilteredFaces) != len(unfilteredFaces) or cc1.Intersect(c3, False, prefilteredOptions) != None or cc1.Intersect(c3, False) != None:
+    print("Test failed! Unexpected prefiltered Boolean result.")
+    sys.exit(1)
+print("Done")
+# Test the Boolean history
+print("Testing Merge with BooleanHistory...")
+history = BooleanHistory()
+merged = fixTopologyClass(c1.Merge(c2, False, BooleanOptions(), history))
+mergedFaces = []
+merged.Faces(None, mergedFaces)
+for mergedFace in mergedFaces:
+    origins = []
+    history.Origins(mergedFace, origins)
+    if len(origins) == 0:
+        print("Test failed! A merged Face has no origin.")
+        sys.exit(1)
+print("Done")
+# Test the tiled SelfMerge
+print("Testing tiled SelfMerge...")
+cluster = Cluster.ByTopologies([c1, c2, c3], False)
+tiledOptions = BooleanOptions()
+tiledOptions.tiledSelfMerge = True
+tiledCells = []
+fixTopologyClass(cluster.SelfMerge(tiledOptions)).Cells(None, tiledCells)
+untiledCells = []
+fixTopologyClass(cluster.SelfMerge()).Cells(None, untiledCells)
+if len(tiledCells) != 3 or len(untiledCells) != 3:
+    print("Test failed! Unexpected tiled SelfMerge result.")
+    sys.exit(1)
+print("Done")
+# Test the trusted-input mode and the validation
+print("Testing trusted input and Validate...")
+ExecutionPolicy.GetInstance().SetTrustInput(True)
+trustedVertex = Vertex.ByCoordinates(1, 2, 3)
+ExecutionPolicy.GetInstance().SetTrustInput(False)
+invalidTopologies = []
+if not Topology.Validate([trustedVertex, cc1], invalidTopologies) or len(invalidTopologies) != 0 or not trustedVertex.IsValid():
+    print("Test failed! Unexpected invalid Topology.")
+    sys.exit(1)
+print("Done")
+# Test the progress reporting and the cancellation
+print("Testing ProgressMonitor...")
+progressStages = []
+monitor = ProgressMonitor()
+monitor.SetCallback(lambda stage, percent: progressStages.append(stage))
+progressOptions = BooleanOptions()
+progressOptions.progressMonitor = monitor
+c1.Merge(c2, False, progressOptions)
+monitor.Cancel()
+isCancelled = False
+try:
+    c1.Merge(c2, False, progressOptions)
+except Exception:
+    isCancelled = True
+if len(progressStages) == 0 or not isCancelled:
+    print("Test failed! Unexpected progress report or cancellation.")
+    sys.exit(1)
+replacedStages = []
+replacingMonitor = ProgressMonitor()
+def replaceCallback(stage, percent):
+    replacedStages.append(stage)
+    replacingMonitor.SetCallback(lambda stage, percent: None)
+replacingMonitor.SetCallback(replaceCallback)
+replacingOptions = BooleanOptions()
+replacingOptions.progressMonitor = replacingMonitor
+c1.Merge(c2, False, replacingOptions)
+if len(replacedStages) != 1:
+    print("Test failed! Unexpected progress callback replacement.")
+    sys.exit(1)
+print("Done")
+# Test the Graph
+print("Testing Graph...")
+gridVertices = [Vertex.ByCoordinates(x, y, 0) for y in range(3) for x in range(3)]
+gridEdges = []
+for y in range(3):
+    for x in range(3):
+        if x < 2:
+            gridEdges.append(Edge.ByStartVertexEndVertex(gridVertices[3 * y + x], gridVertices[3 * y + x + 1]))
+        if y < 2:
+            gridEdges.append(Edge.ByStartVertexEndVertex(gridVertices[3 * y + x], gridVertices[3 * y + x + 3]))
+graph = Graph.ByVerticesEdges(gridVertices, gridEdges)
+graphVertices = []
+graph.Vertices(graphVertices)
+graphEdges = []
+graph.Edges(graphEdges)
+pathEdges = []
+graph.ShortestPath(gridVertices[0], gridVertices[8], "", "").Edges(None, pathEdges)
+if len(graphVertices) != 9 or len(graphEdges) != 12 or len(pathEdges) != 4 or graph.TopologicalDistance(gridVertices[0], gridVertices[8]) != 4 or graph.VertexDegree(gridVertices[4]) != 4:
+    print("Test failed! Unexpected Graph.")
+    sys.exit(1)
+lengthPathEdges = []
+graph.ShortestPath(gridVertices[0], gridVertices[8], "", "length").Edges(None, lengthPathEdges)
+if len(lengthPathEdges) != 4:
+    print("Test failed! Unexpected Graph shortest path by length.")
+    sys.exit(1)
+tiedPaths = []
+graph.ShortestPaths(gridVertices[0], gridVertices[8], "", "", True, 10, tiedPaths)
+kPathVertexIndices = []
+kPathCosts = []
+graph.KShortestPaths(gridVertices[0], gridVertices[8], "", "", 100, -1.0, kPathVertexIndices, kPathCosts)
+cappedPathWires = []
+graph.KShortestPathWires(gridVertices[0], gridVertices[8], "", "", 100, 6.0, cappedPathWires)
+if len(tiedPaths) != 6 or len(kPathVertexIndices) != 12 or kPathCosts != sorted(kPathCosts) or kPathCosts[0] != 4.0 or kPathCosts[-1] != 8.0 or len(cappedPathWires) != 10:
+    print("Test failed! Unexpected Graph k shortest paths.")
+    sys.exit(1)
+allPathWires = []
+graph.AllPaths(gridVertices[0], gridVertices[8], True, 10, allPathWires)
+streamedPaths = []
+numberOfShortPaths = graph.AllPaths(gridVertices[0], gridVertices[8], 0, 4, 10.0, lambda pathVertexIndices: streamedPaths.append(pathVertexIndices))
+numberOfFirstPaths = graph.AllPaths(gridVertices[0], gridVertices[8], 3, 0, 0.0, lambda pathVertexIndices: True)
+if len(allPathWires) != 12 or numberOfShortPaths != 6 or len(streamedPaths) != 6 or any(len(path) != 5 for path in streamedPaths) or numberOfFirstPaths != 3:
+    print("Test failed! Unexpected Graph paths.")
+    sys.exit(1)
+eccentricities = []
+centerVertices = []
+diameter, radius = graph.Eccentricities(eccentricities, centerVertices)
+if diameter != 4 or radius != 2 or graph.Diameter() != 4 or len(centerVertices) != 1 or sorted(eccentricities) != [2, 3, 3, 3, 3, 4, 4, 4, 4]:
+    print("Test failed! Unexpected Graph eccentricities.")
+    sys.exit(1)
+try:
+    import numpy
+    hopMatrix = graph.DistanceMatrix([])
+    lengthMatrix = graph.DistanceMatrix([gridVertices[0]], "", "length", True)
+    if hopMatrix.shape != (9, 9) or hopMatrix[0][8] != 4 or lengthMatrix.shape != (1, 9) or lengthMatrix.dtype != numpy.float32 or abs(lengthMatrix[0][8] - 4.0) > 0.0001:
+        print("Test failed! Unexpected Graph distance matrix.")
+        sys.exit(1)
+except ImportError:
+    print("NumPy is not installed, skipping the distance matrix.")
+betweenness = []
+graph.BetweennessCentrality(betweenness, "", "", True, 0, "betweenness")
+closeness = []
+graph.ClosenessCentrality(closeness)
+graphVertices = []
+graph.Vertices(graphVertices)
+if abs(max(betweenness) - 8.0 / 21.0) > 0.0001 or abs(min(betweenness) - 1.0 / 21.0) > 0.0001 or abs(max(closeness) - 2.0 / 3.0) > 0.0001 or abs(min(closeness) - 4.0 / 9.0) > 0.0001:
+    print("Test failed! Unexpected Graph centralities.")
+    sys.exit(1)
+if abs(graphVertices[0].GetDictionary().ValueAtKey("betweenness").DoubleValue() - betweenness[0]) > 0.0001:
+    print("Test failed! Unexpected Graph centrality in a Vertex dictionary.")
+    sys.exit(1)
+graph.RemoveVertices([gridVertices[4]])
+graphEdges = []
+graph.Edges(graphEdges)
+if len(graphEdges) != 8 or graph.TopologicalDistance(gridVertices[1], gridVertices[7]) != 4:
+    print("Test failed! Unexpected Graph after removing a Vertex.")
+    sys.exit(1)
+if graph.ContainsVertex(Vertex.ByCoordinates(0.001, 0, 0), 0.0001) or not graph.ContainsVertex(Vertex.ByCoordinates(0.00001, 0, 0), 0.0001):
+    print("Test failed! Unexpected coincident Vertex.")
+    sys.exit(1)
+print("Done")
 print("Congratulations! Test is successful.")